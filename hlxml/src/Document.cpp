@@ -66,7 +66,7 @@ namespace hlxml
 	{
 		int dataSize = (int)stream.size();
 		this->data = new char[dataSize + 1];
-		int read = stream.readRaw(this->data, dataSize);
+		int read = (int)stream.readRaw(this->data, (int64_t)dataSize);
 		this->data[read] = 0;
 		this->realFilename = realFilename;
 	}
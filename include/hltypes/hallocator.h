@@ -0,0 +1,373 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+///
+/// @section DESCRIPTION
+///
+/// Provides memory arenas, pools and allocators that can be used with containers.
+
+#ifndef HLTYPES_ALLOCATOR_H
+#define HLTYPES_ALLOCATOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "hltypesExport.h"
+#include "hmutex.h"
+
+namespace hltypes
+{
+	/// @brief Bump allocator that hands out memory from large blocks and frees everything at once.
+	/// @note Memory of single allocations cannot be freed. Use reset() to free all allocations at once.
+	/// @note An Arena is not thread-safe.
+	class hltypesExport Arena
+	{
+	public:
+		/// @brief Basic constructor.
+		/// @param[in] blockSize Size of the memory blocks that are allocated from the heap.
+		Arena(int blockSize = 65536);
+		/// @brief Destructor.
+		~Arena();
+
+		/// @brief Gets the size of the memory blocks that are allocated from the heap.
+		/// @return Size of the memory blocks.
+		inline int getBlockSize() const { return this->blockSize; }
+		/// @brief Gets the number of bytes that have been allocated since the last reset.
+		/// @return Number of allocated bytes including alignment padding.
+		inline int64_t getUsedSize() const { return this->usedSize; }
+		/// @brief Gets the number of bytes that are held by the Arena.
+		/// @return Number of bytes held by the Arena.
+		int64_t getCapacity() const;
+
+		/// @brief Allocates memory.
+		/// @param[in] size Number of bytes.
+		/// @param[in] alignment Alignment of the memory. Has to be a power of 2.
+		/// @return Pointer to the memory.
+		/// @note Allocations larger than the block size get a block of their own.
+		void* allocate(size_t size, size_t alignment = sizeof(void*) * 2);
+		/// @brief Frees all allocations at once.
+		/// @note The memory blocks are kept and reused for new allocations.
+		/// @note Objects that were constructed in the memory are not destroyed.
+		void reset();
+		/// @brief Frees all allocations and releases the memory blocks.
+		void clear();
+
+	protected:
+		/// @brief A memory block.
+		struct Block
+		{
+			/// @brief Pointer to the memory.
+			unsigned char* data;
+			/// @brief Size of the memory.
+			size_t size;
+		};
+
+		/// @brief Size of the memory blocks that are allocated from the heap.
+		int blockSize;
+		/// @brief Memory blocks.
+		std::vector<Block> blocks;
+		/// @brief Index of the block from which memory is currently taken.
+		int blockIndex;
+		/// @brief Offset of the free memory in the current block.
+		size_t offset;
+		/// @brief Number of bytes that have been allocated since the last reset.
+		int64_t usedSize;
+
+	private:
+		/// @brief Copy constructor.
+		/// @note Usage is not allowed and it will throw an exception.
+		Arena(const Arena& other);
+		/// @brief Assignment operator.
+		/// @note Usage is not allowed and it will throw an exception.
+		Arena& operator=(Arena& other);
+
+	};
+
+	/// @brief Allocator for elements of a fixed size that keeps freed elements in a free list for reuse.
+	/// @note Elements are allocated in chunks so they are stored close to each other in memory.
+	/// @note A Pool is not thread-safe.
+	class hltypesExport Pool
+	{
+	public:
+		/// @brief Basic constructor.
+		/// @param[in] elementSize Size of a single element.
+		/// @param[in] alignment Alignment of the elements. Has to be a power of 2.
+		/// @param[in] chunkCapacity Number of elements per chunk that is allocated from the heap.
+		Pool(int elementSize, int alignment = sizeof(void*), int chunkCapacity = 256);
+		/// @brief Destructor.
+		~Pool();
+
+		/// @brief Gets the size of a single element.
+		/// @return Size of a single element including padding.
+		inline int getElementSize() const { return this->elementSize; }
+		/// @brief Gets the number of allocated chunks.
+		/// @return Number of allocated chunks.
+		inline int getChunkCount() const { return (int)this->chunks.size(); }
+
+		/// @brief Allocates memory for one element.
+		/// @return Pointer to the memory.
+		void* allocate();
+		/// @brief Returns the memory of one element to the Pool.
+		/// @param[in] pointer Pointer to the memory.
+		void deallocate(void* pointer);
+		/// @brief Releases all chunks.
+		/// @note All memory allocated from this Pool becomes invalid.
+		void clear();
+
+	protected:
+		/// @brief Size of a single element including padding.
+		int elementSize;
+		/// @brief Number of elements per chunk.
+		int chunkCapacity;
+		/// @brief Allocated chunks.
+		std::vector<unsigned char*> chunks;
+		/// @brief First free element.
+		void* freeList;
+
+	private:
+		/// @brief Copy constructor.
+		/// @note Usage is not allowed and it will throw an exception.
+		Pool(const Pool& other);
+		/// @brief Assignment operator.
+		/// @note Usage is not allowed and it will throw an exception.
+		Pool& operator=(Pool& other);
+
+	};
+
+	/// @brief Standard allocator that takes memory from an Arena.
+	/// @note If no Arena is set, memory is taken from the heap.
+	/// @note Deallocation of Arena memory does nothing, the memory is freed with Arena::reset().
+	/// @note Containers using this allocator must not be used after the Arena has been reset.
+	template <typename T>
+	class ArenaAllocator
+	{
+	public:
+		typedef T value_type;
+		typedef std::false_type propagate_on_container_copy_assignment;
+		typedef std::true_type propagate_on_container_move_assignment;
+		typedef std::true_type propagate_on_container_swap;
+
+		/// @brief The Arena.
+		Arena* arena;
+
+		/// @brief Basic constructor.
+		/// @param[in] arena The Arena.
+		inline ArenaAllocator(Arena* arena = NULL) : arena(arena)
+		{
+		}
+		/// @brief Rebinding copy constructor.
+		/// @param[in] other Allocator for another type.
+		template <typename S>
+		inline ArenaAllocator(const ArenaAllocator<S>& other) : arena(other.arena)
+		{
+		}
+		/// @brief Rebinding helper for compilers without full allocator_traits support.
+		template <typename S>
+		struct rebind
+		{
+			typedef ArenaAllocator<S> other;
+		};
+
+		/// @brief Allocates memory for elements.
+		/// @param[in] count Number of elements.
+		/// @return Pointer to the memory.
+		inline T* allocate(size_t count)
+		{
+			if (this->arena != NULL)
+			{
+				return (T*)this->arena->allocate(sizeof(T) * count, std::alignment_of<T>::value);
+			}
+			return (T*)::operator new(sizeof(T) * count);
+		}
+		/// @brief Frees memory of elements.
+		/// @param[in] pointer Pointer to the memory.
+		/// @param[in] count Number of elements.
+		inline void deallocate(T* pointer, size_t count)
+		{
+			if (this->arena == NULL)
+			{
+				::operator delete(pointer);
+			}
+		}
+
+	};
+
+	template <typename T, typename S>
+	inline bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<S>& b)
+	{
+		return (a.arena == b.arena);
+	}
+	template <typename T, typename S>
+	inline bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<S>& b)
+	{
+		return (a.arena != b.arena);
+	}
+
+	/// @brief Standard allocator that takes single elements from a shared Pool per element type.
+	/// @note Intended for node based containers like List and Map where every node is allocated separately.
+	/// @note Allocations of multiple elements at once are taken from the heap.
+	/// @note The shared Pools are never freed so they outlive static containers.
+	/// @note Every element type has its own Pool with its own Mutex, so only containers with the same node type contend for a lock.
+	/// @note Every single element allocation and deallocation locks that Mutex. Use ArenaAllocator where this cost matters.
+	template <typename T>
+	class PoolAllocator
+	{
+	public:
+		typedef T value_type;
+
+		/// @brief Basic constructor.
+		inline PoolAllocator()
+		{
+		}
+		/// @brief Rebinding copy constructor.
+		/// @param[in] other Allocator for another type.
+		template <typename S>
+		inline PoolAllocator(const PoolAllocator<S>& other)
+		{
+		}
+		/// @brief Rebinding helper for compilers without full allocator_traits support.
+		template <typename S>
+		struct rebind
+		{
+			typedef PoolAllocator<S> other;
+		};
+
+		/// @brief Allocates memory for elements.
+		/// @param[in] count Number of elements.
+		/// @return Pointer to the memory.
+		inline T* allocate(size_t count)
+		{
+			if (count != 1)
+			{
+				return (T*)::operator new(sizeof(T) * count);
+			}
+			_SharedPool& shared = PoolAllocator<T>::_getSharedPool();
+			Mutex::ScopeLock lock(&shared.mutex);
+			return (T*)shared.pool.allocate();
+		}
+		/// @brief Frees memory of elements.
+		/// @param[in] pointer Pointer to the memory.
+		/// @param[in] count Number of elements.
+		inline void deallocate(T* pointer, size_t count)
+		{
+			if (count != 1)
+			{
+				::operator delete(pointer);
+				return;
+			}
+			_SharedPool& shared = PoolAllocator<T>::_getSharedPool();
+			Mutex::ScopeLock lock(&shared.mutex);
+			shared.pool.deallocate(pointer);
+		}
+
+	protected:
+		/// @brief Pool shared by all PoolAllocators of one element type and the Mutex protecting it.
+		struct _SharedPool
+		{
+			/// @brief The Pool.
+			Pool pool;
+			/// @brief The Mutex protecting the Pool.
+			Mutex mutex;
+
+			inline _SharedPool() : pool(sizeof(T), std::alignment_of<T>::value), mutex("hltypes::PoolAllocator")
+			{
+			}
+		};
+
+		/// @brief Gets the shared Pool for elements of type T.
+		/// @return The shared Pool.
+		static inline _SharedPool& _getSharedPool()
+		{
+			static _SharedPool* shared = new _SharedPool();
+			return (*shared);
+		}
+
+	};
+
+	template <typename T, typename S>
+	inline bool operator==(const PoolAllocator<T>& a, const PoolAllocator<S>& b)
+	{
+		return true;
+	}
+	template <typename T, typename S>
+	inline bool operator!=(const PoolAllocator<T>& a, const PoolAllocator<S>& b)
+	{
+		return false;
+	}
+
+	/// @brief Standard allocator that aligns every allocation to a fixed boundary.
+	/// @note Intended for contiguous containers whose data is processed in blocks, e.g. with SIMD.
+	/// @note The original heap pointer is stored right before the aligned memory.
+	template <typename T, int Alignment>
+	class AlignedAllocator
+	{
+	public:
+		typedef T value_type;
+
+		/// @brief Basic constructor.
+		inline AlignedAllocator()
+		{
+		}
+		/// @brief Rebinding copy constructor.
+		/// @param[in] other Allocator for another type.
+		template <typename S>
+		inline AlignedAllocator(const AlignedAllocator<S, Alignment>& other)
+		{
+		}
+		/// @brief Rebinding helper, required since the alignment is not a type parameter.
+		template <typename S>
+		struct rebind
+		{
+			typedef AlignedAllocator<S, Alignment> other;
+		};
+
+		/// @brief Allocates memory for elements.
+		/// @param[in] count Number of elements.
+		/// @return Pointer to the memory.
+		inline T* allocate(size_t count)
+		{
+			static_assert(Alignment > 0 && (Alignment & (Alignment - 1)) == 0, "Alignment has to be a power of 2.");
+			unsigned char* memory = (unsigned char*)::operator new(sizeof(T) * count + Alignment + sizeof(void*));
+			uintptr_t address = ((uintptr_t)(memory + sizeof(void*)) + Alignment - 1) & ~(uintptr_t)(Alignment - 1);
+			((void**)address)[-1] = memory;
+			return (T*)address;
+		}
+		/// @brief Frees memory of elements.
+		/// @param[in] pointer Pointer to the memory.
+		/// @param[in] count Number of elements.
+		inline void deallocate(T* pointer, size_t count)
+		{
+			if (pointer != NULL)
+			{
+				::operator delete(((void**)pointer)[-1]);
+			}
+		}
+
+	};
+
+	template <typename T, typename S, int Alignment>
+	inline bool operator==(const AlignedAllocator<T, Alignment>& a, const AlignedAllocator<S, Alignment>& b)
+	{
+		return true;
+	}
+	template <typename T, typename S, int Alignment>
+	inline bool operator!=(const AlignedAllocator<T, Alignment>& a, const AlignedAllocator<S, Alignment>& b)
+	{
+		return false;
+	}
+
+}
+
+/// @brief Alias for simpler code.
+typedef hltypes::Arena harena;
+/// @brief Alias for simpler code.
+typedef hltypes::Pool hpool;
+
+#endif
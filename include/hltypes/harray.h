@@ -13,11 +13,13 @@
 #ifndef HLTYPES_ARRAY_H
 #define HLTYPES_ARRAY_H
 
+#include <functional>
 #include <vector>
 
 #include "hcontainer.h"
 #include "hexception.h"
 #include "hltypesUtil.h"
+#include "hspan.h"
 #include "hstring.h"
 
 /// @brief Provides a simpler syntax to iterate through an Array.
@@ -32,55 +34,71 @@
 namespace hltypes
 {
 	/// @brief Encapsulates std::vector and adds high level methods.
-	template <typename T>
-	class Array : public Container<std::vector<T>, T>
+	/// @note A is the allocator type. It defaults to std::allocator<T> in the forward declaration in hstring.h.
+	template <typename T, typename A>
+	class Array : public Container<std::vector<T, A>, T>
 	{
 	public:
+		template <typename S, typename B> friend class Array;
+
 		/// @brief Empty constructor.
 		inline Array() :
-			Container<std::vector<T>, T>()
+			Container<std::vector<T, A>, T>()
+		{
+		}
+		/// @brief Constructor with allocator.
+		/// @param[in] allocator Allocator used for the elements.
+		inline explicit Array(const A& allocator) :
+			Container<std::vector<T, A>, T>(allocator)
 		{
 		}
 		/// @brief Copy constructor.
 		/// @param[in] other Container to copy.
-		inline Array(const Container<std::vector<T>, T>& other) :
-			Container<std::vector<T>, T>(other)
+		inline Array(const Container<std::vector<T, A>, T>& other) :
+			Container<std::vector<T, A>, T>(other)
+		{
+		}
+		/// @brief Move constructor.
+		/// @param[in] other Container to move.
+		/// @note other is left empty.
+		inline Array(Container<std::vector<T, A>, T>&& other) :
+			Container<std::vector<T, A>, T>(std::move(other))
 		{
 		}
 		/// @brief Constructor from single element.
 		/// @param[in] element Element to insert.
 		/// @note The explicit prevents "var = element" from working.
 		inline explicit Array(const T& element) :
-			Container<std::vector<T>, T>(element)
+			Container<std::vector<T, A>, T>(element)
 		{
 		}
 		/// @brief Constructor from single element.
 		/// @param[in] element Element to insert.
 		/// @param[in] times Number of times to insert element.
 		inline Array(const T& element, int times) :
-			Container<std::vector<T>, T>(element, times)
+			Container<std::vector<T, A>, T>(element, times)
 		{
 		}
 		/// @brief Constructor from another Container.
 		/// @param[in] other Container to copy.
 		/// @param[in] count Number of elements to copy.
-		inline Array(const Container<std::vector<T>, T>& other, const int count) :
-			Container<std::vector<T>, T>(other, count)
+		inline Array(const Container<std::vector<T, A>, T>& other, const int count) :
+			Container<std::vector<T, A>, T>(other, count)
 		{
 		}
 		/// @brief Constructor from another Container.
 		/// @param[in] other Container to copy.
 		/// @param[in] start Start index of elements to copy.
 		/// @param[in] count Number of elements to copy.
-		inline Array(const Container<std::vector<T>, T>& other, const int start, const int count) :
-			Container<std::vector<T>, T>(other, start, count)
+		inline Array(const Container<std::vector<T, A>, T>& other, const int start, const int count) :
+			Container<std::vector<T, A>, T>(other, start, count)
 		{
 		}
 		/// @brief Constructor from C-type array.
 		/// @param[in] other C-type array to copy.
 		/// @param[in] count Number of elements to copy.
 		inline Array(const T other[], const int count) :
-			Container<std::vector<T>, T>(other, count)
+			Container<std::vector<T, A>, T>(other, count)
 		{
 		}
 		/// @brief Constructor from C-type array.
@@ -88,8 +106,467 @@ namespace hltypes
 		/// @param[in] start Start index of elements to copy.
 		/// @param[in] count Number of elements to copy.
 		inline Array(const T other[], const int start, const int count) :
-			Container<std::vector<T>, T>(other, start, count)
+			Container<std::vector<T, A>, T>(other, start, count)
+		{
+		}
+		/// @brief Reserves memory for a number of elements.
+		/// @param[in] count Number of elements to reserve memory for.
+		/// @note Use this to avoid repeated reallocations when the final size is known in advance.
+		inline void reserve(int count)
+		{
+			this->_reserve(count);
+		}
+		/// @brief Gets the number of elements memory has been reserved for.
+		/// @return The number of elements memory has been reserved for.
+		inline int capacity() const
+		{
+			return this->_capacity();
+		}
+		/// @brief Releases reserved memory that is not used by any element.
+		inline void shrinkToFit()
+		{
+			this->_shrinkToFit();
+		}
+		/// @brief Gets the pointer to the elements.
+		/// @return Pointer to the first element.
+		/// @note The pointer becomes invalid when the Array reallocates.
+		/// @note Does not work with bool as T.
+		inline T* data()
+		{
+			return this->_data();
+		}
+		/// @brief Gets the pointer to the elements.
+		/// @return Pointer to the first element.
+		/// @note The pointer becomes invalid when the Array reallocates.
+		/// @note Does not work with bool as T.
+		inline const T* data() const
+		{
+			return this->_data();
+		}
+		/// @brief Creates a Span of all elements without copying them.
+		/// @return A Span of all elements.
+		/// @note The Span becomes invalid when the Array reallocates.
+		inline Span<T> span()
+		{
+			return Span<T>(this->data(), this->size());
+		}
+		/// @brief Creates a Span of all elements without copying them.
+		/// @return A Span of all elements.
+		/// @note The Span becomes invalid when the Array reallocates.
+		inline Span<const T> span() const
+		{
+			return Span<const T>(this->data(), this->size());
+		}
+		/// @brief Creates a Span of a part of the elements without copying them.
+		/// @param[in] start Start index of the elements.
+		/// @param[in] count Number of elements.
+		/// @return A Span of the elements.
+		/// @note This is the non-copying variant of operator()(int, int).
+		/// @note The Span becomes invalid when the Array reallocates.
+		inline Span<T> span(int start, const int count)
+		{
+			return this->span().sub(start, count);
+		}
+		/// @brief Creates a Span of a part of the elements without copying them.
+		/// @param[in] start Start index of the elements.
+		/// @param[in] count Number of elements.
+		/// @return A Span of the elements.
+		/// @note This is the non-copying variant of operator()(int, int).
+		/// @note The Span becomes invalid when the Array reallocates.
+		inline Span<const T> span(int start, const int count) const
+		{
+			return this->span().sub(start, count);
+		}
+		/// @brief Sorts elements in Array without preserving the order of equal elements.
+		/// @note The sorting order is ascending.
+		/// @note Faster than sort() and does not need a temporary buffer.
+		inline void sortUnstable()
+		{
+			this->_sortUnstable();
+		}
+		/// @brief Sorts elements in Array without preserving the order of equal elements.
+		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @note The sorting order is ascending.
+		/// @note compareFunction should return true if first element is less than the second element.
+		inline void sortUnstable(bool (*compareFunction)(T const&, T const&))
+		{
+			this->_sortUnstable(compareFunction);
+		}
+		/// @brief Sorts only the first elements in Array.
+		/// @param[in] count Number of smallest elements that are moved to the front in sorted order.
+		/// @note The order of the remaining elements is unspecified.
+		inline void partialSort(int count)
+		{
+			this->_partialSort(count);
+		}
+		/// @brief Sorts only the first elements in Array.
+		/// @param[in] count Number of smallest elements that are moved to the front in sorted order.
+		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @note The order of the remaining elements is unspecified.
+		/// @note compareFunction should return true if first element is less than the second element.
+		inline void partialSort(int count, bool (*compareFunction)(T const&, T const&))
+		{
+			this->_partialSort(count, compareFunction);
+		}
+		/// @brief Places the element that would be at the given index in a sorted Array at that index.
+		/// @param[in] index Index of the element.
+		/// @note All elements before index are not greater and all elements after index are not less than the element at index.
+		inline void nthElement(int index)
+		{
+			this->_nthElement(index);
+		}
+		/// @brief Places the element that would be at the given index in a sorted Array at that index.
+		/// @param[in] index Index of the element.
+		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @note All elements before index are not greater and all elements after index are not less than the element at index.
+		/// @note compareFunction should return true if first element is less than the second element.
+		inline void nthElement(int index, bool (*compareFunction)(T const&, T const&))
+		{
+			this->_nthElement(index, compareFunction);
+		}
+		/// @brief Sorts elements in Array using an LSD radix sort.
+		/// @note The sorting order is ascending.
+		/// @note The sort is stable and runs in linear time.
+		/// @note Only available for integral types, float and double.
+		inline void radixSort()
+		{
+			this->_radixSort();
+		}
+		/// @brief Sorts elements in Array using an LSD radix sort on a key.
+		/// @param[in] keyFunction Function pointer that takes an element of type T and returns its integral, float or double key.
+		/// @note The sorting order is ascending.
+		/// @note The sort is stable and runs in linear time.
+		template <typename K>
+		inline void radixSort(K (*keyFunction)(T const&))
+		{
+			this->_radixSort(keyFunction);
+		}
+		/// @brief Finds an element in a sorted Array using binary search.
+		/// @param[in] element Element to search for.
+		/// @return Index of an element equal to the given element or -1 if it was not found.
+		/// @note The Array has to be sorted in ascending order.
+		/// @note If there are several equal elements, the index of the first one is returned.
+		inline int binarySearch(const T& element) const
+		{
+			return this->binarySearch(element, std::less<T>());
+		}
+		/// @brief Finds an element in a sorted Array using binary search.
+		/// @param[in] element Element to search for.
+		/// @param[in] compare Comparison callable that takes two elements of type T and returns bool, e.g. a lambda.
+		/// @return Index of an element equivalent to the given element or -1 if it was not found.
+		/// @note The Array has to be sorted with the same comparison.
+		/// @note compare should return true if first element is less than the second element.
+		/// @note If there are several equivalent elements, the index of the first one is returned.
+		template <typename C>
+		inline int binarySearch(const T& element, C compare) const
+		{
+			int index = this->lowerBound(element, compare);
+			if (index < this->size() && !compare(element, this->begin()[index]))
+			{
+				return index;
+			}
+			return -1;
+		}
+		/// @brief Finds an element in a sorted Array using binary search.
+		/// @param[in] element Element to search for.
+		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @return Index of an element equivalent to the given element or -1 if it was not found.
+		/// @note The Array has to be sorted with the same compareFunction.
+		/// @note compareFunction should return true if first element is less than the second element.
+		inline int binarySearch(const T& element, bool (*compareFunction)(T const&, T const&)) const
+		{
+			return this->template binarySearch<bool (*)(T const&, T const&)>(element, compareFunction);
+		}
+		/// @brief Gets the index of the first element in a sorted Array that is not less than the given element.
+		/// @param[in] element The element.
+		/// @return Index of the first element that is not less than the given element or size() if there is none.
+		/// @note The Array has to be sorted in ascending order.
+		inline int lowerBound(const T& element) const
+		{
+			return this->lowerBound(element, std::less<T>());
+		}
+		/// @brief Gets the index of the first element in a sorted Array that is not less than the given element.
+		/// @param[in] element The element.
+		/// @param[in] compare Comparison callable that takes two elements of type T and returns bool, e.g. a lambda.
+		/// @return Index of the first element that is not less than the given element or size() if there is none.
+		/// @note The Array has to be sorted with the same comparison.
+		template <typename C>
+		inline int lowerBound(const T& element, C compare) const
+		{
+			return (int)(std::lower_bound(this->begin(), this->end(), element, compare) - this->begin());
+		}
+		/// @brief Gets the index of the first element in a sorted Array that is not less than the given element.
+		/// @param[in] element The element.
+		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @return Index of the first element that is not less than the given element or size() if there is none.
+		/// @note The Array has to be sorted with the same compareFunction.
+		inline int lowerBound(const T& element, bool (*compareFunction)(T const&, T const&)) const
+		{
+			return this->template lowerBound<bool (*)(T const&, T const&)>(element, compareFunction);
+		}
+		/// @brief Gets the index of the first element in a sorted Array that is greater than the given element.
+		/// @param[in] element The element.
+		/// @return Index of the first element that is greater than the given element or size() if there is none.
+		/// @note The Array has to be sorted in ascending order.
+		inline int upperBound(const T& element) const
+		{
+			return this->upperBound(element, std::less<T>());
+		}
+		/// @brief Gets the index of the first element in a sorted Array that is greater than the given element.
+		/// @param[in] element The element.
+		/// @param[in] compare Comparison callable that takes two elements of type T and returns bool, e.g. a lambda.
+		/// @return Index of the first element that is greater than the given element or size() if there is none.
+		/// @note The Array has to be sorted with the same comparison.
+		template <typename C>
+		inline int upperBound(const T& element, C compare) const
+		{
+			return (int)(std::upper_bound(this->begin(), this->end(), element, compare) - this->begin());
+		}
+		/// @brief Gets the index of the first element in a sorted Array that is greater than the given element.
+		/// @param[in] element The element.
+		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @return Index of the first element that is greater than the given element or size() if there is none.
+		/// @note The Array has to be sorted with the same compareFunction.
+		inline int upperBound(const T& element, bool (*compareFunction)(T const&, T const&)) const
+		{
+			return this->template upperBound<bool (*)(T const&, T const&)>(element, compareFunction);
+		}
+		/// @brief Inserts an element into a sorted Array so it stays sorted.
+		/// @param[in] element Element to insert.
+		/// @return Index of the inserted element.
+		/// @note The Array has to be sorted in ascending order.
+		/// @note The element is inserted after all equal elements.
+		inline int insertSorted(const T& element)
+		{
+			return this->insertSorted(element, std::less<T>());
+		}
+		/// @brief Inserts an element into a sorted Array so it stays sorted.
+		/// @param[in] element Element to insert.
+		/// @param[in] compare Comparison callable that takes two elements of type T and returns bool, e.g. a lambda.
+		/// @return Index of the inserted element.
+		/// @note The Array has to be sorted with the same comparison.
+		/// @note The element is inserted after all equivalent elements.
+		template <typename C>
+		inline int insertSorted(const T& element, C compare)
+		{
+			int index = this->upperBound(element, compare);
+			this->insertAt(index, element);
+			return index;
+		}
+		/// @brief Inserts an element into a sorted Array so it stays sorted.
+		/// @param[in] element Element to insert.
+		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @return Index of the inserted element.
+		/// @note The Array has to be sorted with the same compareFunction.
+		/// @note The element is inserted after all equivalent elements.
+		inline int insertSorted(const T& element, bool (*compareFunction)(T const&, T const&))
+		{
+			return this->template insertSorted<bool (*)(T const&, T const&)>(element, compareFunction);
+		}
+		/// @brief Merges the elements of another sorted Array into this sorted Array.
+		/// @param[in] other Another sorted Array.
+		/// @note Both Arrays have to be sorted in ascending order.
+		/// @note Runs in linear time. Equal elements of this Array come before the ones of other.
+		inline void mergeSorted(const Array<T, A>& other)
+		{
+			this->mergeSorted(other, std::less<T>());
+		}
+		/// @brief Merges the elements of another sorted Array into this sorted Array.
+		/// @param[in] other Another sorted Array.
+		/// @param[in] compare Comparison callable that takes two elements of type T and returns bool, e.g. a lambda.
+		/// @note Both Arrays have to be sorted with the same comparison.
+		/// @note Runs in linear time. Equivalent elements of this Array come before the ones of other.
+		template <typename C>
+		inline void mergeSorted(const Array<T, A>& other, C compare)
+		{
+			int size = this->size();
+			this->add(other);
+			std::inplace_merge(this->begin(), this->begin() + size, this->end(), compare);
+		}
+		/// @brief Merges the elements of another sorted Array into this sorted Array.
+		/// @param[in] other Another sorted Array.
+		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @note Both Arrays have to be sorted with the same compareFunction.
+		/// @note Runs in linear time. Equivalent elements of this Array come before the ones of other.
+		inline void mergeSorted(const Array<T, A>& other, bool (*compareFunction)(T const&, T const&))
+		{
+			this->template mergeSorted<bool (*)(T const&, T const&)>(other, compareFunction);
+		}
+		/// @brief Creates a new sorted Array from the elements of this sorted Array and another sorted Array.
+		/// @param[in] other Another sorted Array.
+		/// @return A new Array.
+		/// @see mergeSorted
+		inline Array<T, A> mergedSorted(const Array<T, A>& other) const
+		{
+			return this->mergedSorted(other, std::less<T>());
+		}
+		/// @brief Creates a new sorted Array from the elements of this sorted Array and another sorted Array.
+		/// @param[in] other Another sorted Array.
+		/// @param[in] compare Comparison callable that takes two elements of type T and returns bool, e.g. a lambda.
+		/// @return A new Array.
+		/// @see mergeSorted
+		template <typename C>
+		inline Array<T, A> mergedSorted(const Array<T, A>& other, C compare) const
+		{
+			Array<T, A> result(*this);
+			result.mergeSorted(other, compare);
+			return result;
+		}
+		/// @brief Creates a new sorted Array from the elements of this sorted Array and another sorted Array.
+		/// @param[in] other Another sorted Array.
+		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @return A new Array.
+		/// @see mergeSorted
+		inline Array<T, A> mergedSorted(const Array<T, A>& other, bool (*compareFunction)(T const&, T const&)) const
+		{
+			return this->template mergedSorted<bool (*)(T const&, T const&)>(other, compareFunction);
+		}
+		/// @brief Unites elements of this sorted Array with another sorted Array.
+		/// @param[in] other Another sorted Array.
+		/// @note Both Arrays have to be sorted in ascending order.
+		/// @note Removes duplicates and runs in linear time. The result is the same as with unite() followed by sort().
+		inline void uniteSorted(const Array<T, A>& other)
+		{
+			(*this) = this->unitedSorted(other, std::less<T>());
+		}
+		/// @brief Unites elements of this sorted Array with another sorted Array.
+		/// @param[in] other Another sorted Array.
+		/// @param[in] compare Comparison callable that takes two elements of type T and returns bool, e.g. a lambda.
+		/// @note Both Arrays have to be sorted with the same comparison.
+		/// @note Removes equivalent elements and runs in linear time.
+		template <typename C>
+		inline void uniteSorted(const Array<T, A>& other, C compare)
+		{
+			(*this) = this->unitedSorted(other, compare);
+		}
+		/// @brief Unites elements of this sorted Array with another sorted Array.
+		/// @param[in] other Another sorted Array.
+		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @note Both Arrays have to be sorted with the same compareFunction.
+		/// @note Removes equivalent elements and runs in linear time.
+		inline void uniteSorted(const Array<T, A>& other, bool (*compareFunction)(T const&, T const&))
+		{
+			this->template uniteSorted<bool (*)(T const&, T const&)>(other, compareFunction);
+		}
+		/// @brief Creates a new Array as union of this sorted Array with another sorted Array.
+		/// @param[in] other Another sorted Array.
+		/// @return A new sorted Array.
+		/// @see uniteSorted
+		inline Array<T, A> unitedSorted(const Array<T, A>& other) const
+		{
+			return this->unitedSorted(other, std::less<T>());
+		}
+		/// @brief Creates a new Array as union of this sorted Array with another sorted Array.
+		/// @param[in] other Another sorted Array.
+		/// @param[in] compare Comparison callable that takes two elements of type T and returns bool, e.g. a lambda.
+		/// @return A new sorted Array.
+		/// @see uniteSorted
+		template <typename C>
+		inline Array<T, A> unitedSorted(const Array<T, A>& other, C compare) const
+		{
+			Array<T, A> result(this->get_allocator());
+			result.reserve(this->size() + other.size());
+			typename Array<T, A>::const_iterator_t it = this->begin();
+			typename Array<T, A>::const_iterator_t end = this->end();
+			typename Array<T, A>::const_iterator_t otherIt = other.begin();
+			typename Array<T, A>::const_iterator_t otherEnd = other.end();
+			const T* next = NULL;
+			while (it != end || otherIt != otherEnd)
+			{
+				if (otherIt == otherEnd || (it != end && !compare(*otherIt, *it)))
+				{
+					next = &(*it);
+					++it;
+				}
+				else
+				{
+					next = &(*otherIt);
+					++otherIt;
+				}
+				// the inputs are sorted so next is never less than the last element
+				if (result.size() == 0 || compare(result.last(), *next))
+				{
+					result.add(*next);
+				}
+			}
+			return result;
+		}
+		/// @brief Creates a new Array as union of this sorted Array with another sorted Array.
+		/// @param[in] other Another sorted Array.
+		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @return A new sorted Array.
+		/// @see uniteSorted
+		inline Array<T, A> unitedSorted(const Array<T, A>& other, bool (*compareFunction)(T const&, T const&)) const
+		{
+			return this->template unitedSorted<bool (*)(T const&, T const&)>(other, compareFunction);
+		}
+		/// @brief Intersects elements of this sorted Array with another sorted Array.
+		/// @param[in] other Another sorted Array.
+		/// @note Both Arrays have to be sorted in ascending order.
+		/// @note Does not remove duplicates and runs in linear time. The result is the same as with intersect().
+		inline void intersectSorted(const Array<T, A>& other)
+		{
+			(*this) = this->intersectedSorted(other, std::less<T>());
+		}
+		/// @brief Intersects elements of this sorted Array with another sorted Array.
+		/// @param[in] other Another sorted Array.
+		/// @param[in] compare Comparison callable that takes two elements of type T and returns bool, e.g. a lambda.
+		/// @note Both Arrays have to be sorted with the same comparison.
+		/// @note Does not remove duplicates and runs in linear time.
+		template <typename C>
+		inline void intersectSorted(const Array<T, A>& other, C compare)
+		{
+			(*this) = this->intersectedSorted(other, compare);
+		}
+		/// @brief Intersects elements of this sorted Array with another sorted Array.
+		/// @param[in] other Another sorted Array.
+		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @note Both Arrays have to be sorted with the same compareFunction.
+		/// @note Does not remove duplicates and runs in linear time.
+		inline void intersectSorted(const Array<T, A>& other, bool (*compareFunction)(T const&, T const&))
+		{
+			this->template intersectSorted<bool (*)(T const&, T const&)>(other, compareFunction);
+		}
+		/// @brief Creates a new Array as intersection of this sorted Array with another sorted Array.
+		/// @param[in] other Another sorted Array.
+		/// @return A new sorted Array.
+		/// @see intersectSorted
+		inline Array<T, A> intersectedSorted(const Array<T, A>& other) const
+		{
+			return this->intersectedSorted(other, std::less<T>());
+		}
+		/// @brief Creates a new Array as intersection of this sorted Array with another sorted Array.
+		/// @param[in] other Another sorted Array.
+		/// @param[in] compare Comparison callable that takes two elements of type T and returns bool, e.g. a lambda.
+		/// @return A new sorted Array with all elements of this Array that are also in the other Array.
+		/// @see intersectSorted
+		template <typename C>
+		inline Array<T, A> intersectedSorted(const Array<T, A>& other, C compare) const
+		{
+			Array<T, A> result(this->get_allocator());
+			typename Array<T, A>::const_iterator_t otherIt = other.begin();
+			typename Array<T, A>::const_iterator_t otherEnd = other.end();
+			for (typename Array<T, A>::const_iterator_t it = this->begin(), end = this->end(); it != end && otherIt != otherEnd; ++it)
+			{
+				while (otherIt != otherEnd && compare(*otherIt, *it))
+				{
+					++otherIt;
+				}
+				if (otherIt != otherEnd && !compare(*it, *otherIt))
+				{
+					result.add(*it);
+				}
+			}
+			return result;
+		}
+		/// @brief Creates a new Array as intersection of this sorted Array with another sorted Array.
+		/// @param[in] other Another sorted Array.
+		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @return A new sorted Array.
+		/// @see intersectSorted
+		inline Array<T, A> intersectedSorted(const Array<T, A>& other, bool (*compareFunction)(T const&, T const&)) const
 		{
+			return this->template intersectedSorted<bool (*)(T const&, T const&)>(other, compareFunction);
 		}
 		/// @brief Gets all indices.
 		/// @return All indices.
@@ -109,147 +586,167 @@ namespace hltypes
 		/// @return The removed element.
 		inline T removeAt(int index)
 		{
-			return Container<std::vector<T>, T>::removeAt(index);
+			return Container<std::vector<T, A>, T>::removeAt(index);
 		}
 		/// @brief Removes n elements at given index of Array.
 		/// @param[in] index Start index of elements to remove.
 		/// @param[in] count Number of elements to remove.
 		/// @return Array of all removed elements.
 		/// @note Elements in the returned Array are in the same order as in the orignal Array.
-		inline Array<T> removeAt(int index, int count)
+		inline Array<T, A> removeAt(int index, int count)
 		{
-			return this->template _removeAt<Array<T> >(index, count);
+			return this->template _removeAt<Array<T, A> >(index, count);
 		}
 		/// @brief Removes first element of Array.
 		/// @return The removed element.
 		inline T removeFirst()
 		{
-			return Container<std::vector<T>, T>::removeFirst();
+			return Container<std::vector<T, A>, T>::removeFirst();
 		}
 		/// @brief Removes n elements from the beginning of Array.
 		/// @param[in] count Number of elements to remove.
 		/// @return Array of all removed elements.
 		/// @note Elements in the returned Array are in the same order as in the orignal Array.
-		inline Array<T> removeFirst(const int count)
+		inline Array<T, A> removeFirst(const int count)
 		{
-			return this->template _removeFirst<Array<T> >(count);
+			return this->template _removeFirst<Array<T, A> >(count);
 		}
 		/// @brief Removes last element of Array.
 		/// @return The removed element.
 		inline T removeLast()
 		{
-			return Container<std::vector<T>, T>::removeLast();
+			return Container<std::vector<T, A>, T>::removeLast();
 		}
 		/// @brief Removes n elements from the end of Array.
 		/// @param[in] count Number of elements to remove.
 		/// @return Array of all removed elements.
 		/// @note Elements in the returned Array are in the same order as in the orignal Array.
-		inline Array<T> removeLast(const int count)
+		inline Array<T, A> removeLast(const int count)
 		{
-			return this->template _removeLast<Array<T> >(count);
+			return this->template _removeLast<Array<T, A> >(count);
 		}
 		/// @brief Gets a random element in Array and removes it.
 		/// @return Random element.
 		inline T removeRandom()
 		{
-			return Container<std::vector<T>, T>::removeRandom();
+			return Container<std::vector<T, A>, T>::removeRandom();
 		}
 		/// @brief Gets an Array of random elements selected from this one and removes them.
 		/// @param[in] count Number of random elements.
 		/// @return Array of random elements selected from this one.
-		inline Array<T> removeRandom(const int count)
+		inline Array<T, A> removeRandom(const int count)
 		{
-			return this->template _removeRandom<Array<T> >(count);
+			return this->template _removeRandom<Array<T, A> >(count);
 		}
 		/// @brief Gets a random element in Array.
 		/// @return Random element.
 		inline T random() const
 		{
-			return Container<std::vector<T>, T>::random();
+			return Container<std::vector<T, A>, T>::random();
 		}
 		/// @brief Gets an Array of random elements selected from this one.
 		/// @param[in] count Number of random elements.
 		/// @param[in] unique Whether to force all random values to be at unique positions.
 		/// @return Array of random elements selected from this one.
-		inline Array<T> random(int count, bool unique = true) const
+		inline Array<T, A> random(int count, bool unique = true) const
 		{
-			return this->template _random<Array<T> >(count, unique);
+			return this->template _random<Array<T, A> >(count, unique);
 		}
 		/// @brief Creates new Array with reversed order of elements.
 		/// @return A new Array.
-		inline Array<T> reversed() const
+		inline Array<T, A> reversed() const
 		{
-			return this->template _reversed<Array<T> >();
+			return this->template _reversed<Array<T, A> >();
 		}
 		/// @brief Creates new Array without duplicates.
 		/// @return A new Array.
-		inline Array<T> removedDuplicates() const
+		inline Array<T, A> removedDuplicates() const
 		{
-			return this->template _removedDuplicates<Array<T> >();
+			return this->template _removedDuplicates<Array<T, A> >();
 		}
 		/// @brief Creates new sorted Array.
 		/// @return A new Array.
 		/// @note The sorting order is ascending.
-		inline Array<T> sorted() const
+		inline Array<T, A> sorted() const
 		{
-			return this->template _sorted<Array<T> >();
+			return this->template _sorted<Array<T, A> >();
 		}
 		/// @brief Creates new sorted Array.
 		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
 		/// @return A new Array.
 		/// @note The sorting order is ascending.
 		/// @note compareFunction should return true if first element is less than the second element.
-		inline Array<T> sorted(bool (*compareFunction)(T const&, T const&)) const
+		inline Array<T, A> sorted(bool (*compareFunction)(T const&, T const&)) const
 		{
-			return this->template _sorted<Array<T> >(compareFunction);
+			return this->template _sorted<Array<T, A> >(compareFunction);
+		}
+		/// @brief Creates new Array with only the smallest elements in sorted order.
+		/// @param[in] count Number of elements.
+		/// @return A new Array.
+		/// @note The sorting order is ascending.
+		/// @note Unlike sorted(), only the resulting elements are copied.
+		inline Array<T, A> partialSorted(int count) const
+		{
+			return this->template _partialSorted<Array<T, A> >(count);
+		}
+		/// @brief Creates new Array with only the smallest elements in sorted order.
+		/// @param[in] count Number of elements.
+		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @return A new Array.
+		/// @note The sorting order is ascending.
+		/// @note compareFunction should return true if first element is less than the second element.
+		/// @note Unlike sorted(), only the resulting elements are copied.
+		inline Array<T, A> partialSorted(int count, bool (*compareFunction)(T const&, T const&)) const
+		{
+			return this->template _partialSorted<Array<T, A> >(count, compareFunction);
 		}
 		/// @brief Creates a new Array with randomized order of elements.
 		/// @return A new Array.
-		inline Array<T> randomized() const
+		inline Array<T, A> randomized() const
 		{
-			return this->template _randomized<Array<T> >();
+			return this->template _randomized<Array<T, A> >();
 		}
 		/// @brief Creates a new Array as union of this Array with an element.
 		/// @param[in] element Element to unite with.
 		/// @return A new Array.
 		/// @note Removes duplicates.
-		inline Array<T> united(const T& element) const
+		inline Array<T, A> united(const T& element) const
 		{
-			return this->template _united<Array<T> >(element);
+			return this->template _united<Array<T, A> >(element);
 		}
 		/// @brief Creates a new Array as union of this Array with another one.
 		/// @param[in] other Array to unite with.
 		/// @return A new Array.
 		/// @note Removes duplicates.
-		inline Array<T> united(const Array<T>& other) const
+		inline Array<T, A> united(const Array<T, A>& other) const
 		{
-			return this->template _united<Array<T> >(other);
+			return this->template _united<Array<T, A> >(other);
 		}
 		/// @brief Creates a new Array as intersection of this Array with another one.
 		/// @param[in] other Array to intersect with.
 		/// @return A new Array.
 		/// @note Does not remove duplicates.
-		inline Array<T> intersected(const Array<T>& other) const
+		inline Array<T, A> intersected(const Array<T, A>& other) const
 		{
-			return this->template _intersected<Array<T> >(other);
+			return this->template _intersected<Array<T, A> >(other);
 		}
 		/// @brief Creates a new Array as difference of this Array with an element.
 		/// @param[in] element Element to differentiate with.
 		/// @return A new Array.
 		/// @note Unlike remove, this method ignores if the element is not in this Array.
 		/// @note Does not remove duplicates.
-		inline Array<T> differentiated(const T& element) const
+		inline Array<T, A> differentiated(const T& element) const
 		{
-			return this->template _differentiated<Array<T> >(element);
+			return this->template _differentiated<Array<T, A> >(element);
 		}
 		/// @brief Creates a new Array as difference of this Array with another one.
 		/// @param[in] other Array to differentiate with.
 		/// @return A new Array.
 		/// @note Unlike remove, this method ignore elements of other Array that are not in this one.
 		/// @note Does not remove duplicates.
-		inline Array<T> differentiated(const Array<T>& other) const
+		inline Array<T, A> differentiated(const Array<T, A>& other) const
 		{
-			return this->template _differentiated<Array<T> >(other);
+			return this->template _differentiated<Array<T, A> >(other);
 		}
 		/// @brief Creates new Array with new elements obtained from the current Array elements.
 		/// @param[in] generateFunction Function pointer with generation function for the new elements.
@@ -262,9 +759,9 @@ namespace hltypes
 		/// @brief Finds and returns new Array of elements that match the condition.
 		/// @param[in] conditionFunction Function pointer with condition function that takes one element of type T and returns bool.
 		/// @return New Array with all matching elements.
-		inline Array<T> findAll(bool (*conditionFunction)(T const&)) const
+		inline Array<T, A> findAll(bool (*conditionFunction)(T const&)) const
 		{
-			return this->template _findAll<Array<T> >(conditionFunction);
+			return this->template _findAll<Array<T, A> >(conditionFunction);
 		}
 		/// @brief Returns a new Array with all elements cast into type S.
 		/// @return A new Array with all elements cast into type S.
@@ -287,111 +784,134 @@ namespace hltypes
 		/// @param[in] index Index of the element.
 		/// @return Element at specified position.
 		/// @note Does not work with bool as T.
+		/// @note The bounds are only checked if HLTYPES_CONTAINER_CHECKS is enabled.
 		inline T& operator[](int index)
 		{
-			return this->at(index);
+			return this->_elementAt(index);
 		}
 		/// @brief Returns element at specified position.
 		/// @param[in] index Index of the element.
 		/// @return Element at specified position.
 		/// @note Does not work with bool as T.
+		/// @note The bounds are only checked if HLTYPES_CONTAINER_CHECKS is enabled.
 		inline const T& operator[](int index) const
 		{
-			return this->at(index);
+			return this->_elementAt(index);
 		}
 		/// @brief Returns a subarray.
 		/// @param[in] start Start index of the elements to copy.
 		/// @param[in] count Number of elements to copy.
 		/// @return Subarray created from the current Array.
-		inline Array<T> operator()(int start, const int count) const
+		inline Array<T, A> operator()(int start, const int count) const
 		{
-			return this->template _sub<Array<T> >(start, count);
+			return this->template _sub<Array<T, A> >(start, count);
 		}
 		/// @brief Same as equals.
 		/// @see equals
-		inline bool operator==(const Array<T>& other) const
+		inline bool operator==(const Array<T, A>& other) const
 		{
 			return this->equals(other);
 		}
 		/// @brief Same as nequals.
 		/// @see nequals
-		inline bool operator!=(const Array<T>& other) const
+		inline bool operator!=(const Array<T, A>& other) const
 		{
 			return this->nequals(other);
 		}
 		/// @brief Same as add.
 		/// @see add(const T& element)
-		inline Array<T>& operator<<(const T& element)
+		inline Array<T, A>& operator<<(const T& element)
 		{
 			this->add(element);
 			return (*this);
 		}
 		/// @brief Same as add.
-		/// @see add(const Array<T>& other)
-		inline Array<T>& operator<<(const Array<T>& other)
+		/// @see add(T&& element)
+		inline Array<T, A>& operator<<(T&& element)
+		{
+			this->add(std::move(element));
+			return (*this);
+		}
+		/// @brief Same as add.
+		/// @see add(const Array<T, A>& other)
+		inline Array<T, A>& operator<<(const Array<T, A>& other)
 		{
 			this->add(other);
 			return (*this);
 		}
 		/// @brief Same as add.
 		/// @see add(const T& element)
-		inline Array<T>& operator+=(const T& element)
+		inline Array<T, A>& operator+=(const T& element)
 		{
 			this->add(element);
 			return (*this);
 		}
 		/// @brief Same as add.
-		/// @see add(const Array<T>& other)
-		inline Array<T>& operator+=(const Array<T>& other)
+		/// @see add(T&& element)
+		inline Array<T, A>& operator+=(T&& element)
+		{
+			this->add(std::move(element));
+			return (*this);
+		}
+		/// @brief Same as add.
+		/// @see add(const Array<T, A>& other)
+		inline Array<T, A>& operator+=(const Array<T, A>& other)
 		{
 			this->add(other);
 			return (*this);
 		}
+		/// @brief Same as add.
+		/// @see add(Container&& other)
+		inline Array<T, A>& operator+=(Array<T, A>&& other)
+		{
+			this->add(std::move(other));
+			return (*this);
+		}
 		/// @brief Same as remove.
 		/// @see remove(T element)
-		inline Array<T>& operator-=(T element)
+		inline Array<T, A>& operator-=(T element)
 		{
 			this->remove(element);
 			return (*this);
 		}
 		/// @brief Same as remove.
-		/// @see remove(const Array<T>& other)
-		inline Array<T>& operator-=(const Array<T>& other)
+		/// @see remove(const Array<T, A>& other)
+		inline Array<T, A>& operator-=(const Array<T, A>& other)
 		{
 			this->remove(other);
 			return (*this);
 		}
 		/// @brief Same as unite.
 		/// @see unite(const T& element)
-		inline Array<T>& operator|=(const T& element)
+		inline Array<T, A>& operator|=(const T& element)
 		{
 			this->unite(element);
 			return (*this);
 		}
 		/// @brief Same as unite.
-		/// @see unite(const Array<T>& other)
-		inline Array<T>& operator|=(const Array<T>& other)
+		/// @see unite(const Array<T, A>& other)
+		inline Array<T, A>& operator|=(const Array<T, A>& other)
 		{
 			this->unite(other);
 			return (*this);
 		}
 		/// @brief Same as intersect.
-		/// @see intersect(const Array<T>& other)
-		inline Array<T>& operator&=(const Array<T>& other)
+		/// @see intersect(const Array<T, A>& other)
+		inline Array<T, A>& operator&=(const Array<T, A>& other)
 		{
 			this->intersect(other);
 			return (*this);
 		}
 		/// @brief Same as differentiate.
 		/// @see differentiate(const T& element)
-		inline Array<T>& operator/=(const T& element)
+		inline Array<T, A>& operator/=(const T& element)
 		{
 			this->differentiate(element);
 			return (*this);
 		}
 		/// @brief Same as differentiate.
-		/// @see differentiate(const Array<T>& other)
-		inline Array<T>& operator/=(const Array<T>& other)
+		/// @see differentiate(const Array<T, A>& other)
+		inline Array<T, A>& operator/=(const Array<T, A>& other)
 		{
 			this->differentiate(other);
 			return (*this);
@@ -399,66 +919,66 @@ namespace hltypes
 		/// @brief Merges an Array with an element.
 		/// @param[in] element Element to merge with.
 		/// @return New Array with element added at the end of Array.
-		inline Array<T> operator+(const T& element) const
+		inline Array<T, A> operator+(const T& element) const
 		{
-			Array<T> result(*this);
+			Array<T, A> result(*this);
 			result += element;
 			return result;
 		}
 		/// @brief Merges two Arrays.
 		/// @param[in] other Second Array to merge with.
 		/// @return New Array with elements of second Array added at the end of first Array.
-		inline Array<T> operator+(const Array<T>& other) const
+		inline Array<T, A> operator+(const Array<T, A>& other) const
 		{
-			Array<T> result(*this);
+			Array<T, A> result(*this);
 			result += other;
 			return result;
 		}
 		/// @brief Removes element from Array.
 		/// @param[in] element Element to remove.
 		/// @return New Array with elements of first Array without given element.
-		inline Array<T> operator-(T element) const
+		inline Array<T, A> operator-(T element) const
 		{
-			Array<T> result(*this);
+			Array<T, A> result(*this);
 			result -= element;
 			return result;
 		}
 		/// @brief Removes second Array from first Array.
 		/// @param[in] other Array to remove.
 		/// @return New Array with elements of first Array without the elements of second Array.
-		inline Array<T> operator-(const Array<T>& other) const
+		inline Array<T, A> operator-(const Array<T, A>& other) const
 		{
-			Array<T> result(*this);
+			Array<T, A> result(*this);
 			result -= other;
 			return result;
 		}
 		/// @brief Same as united.
 		/// @see united(const T& element)
-		inline Array<T> operator|(const T& element) const
+		inline Array<T, A> operator|(const T& element) const
 		{
 			return this->united(element);
 		}
 		/// @brief Same as united.
-		/// @see united(const Array<T>& other)
-		inline Array<T> operator|(const Array<T>& other) const
+		/// @see united(const Array<T, A>& other)
+		inline Array<T, A> operator|(const Array<T, A>& other) const
 		{
 			return this->united(other);
 		}
 		/// @brief Same as intersected.
-		/// @see intersected(const Array<T>& other)
-		inline Array<T> operator&(const Array<T>& other) const
+		/// @see intersected(const Array<T, A>& other)
+		inline Array<T, A> operator&(const Array<T, A>& other) const
 		{
 			return this->intersected(other);
 		}
 		/// @brief Same as differentiated.
 		/// @see differentiated(const T& element)
-		inline Array<T> operator/(const T& element) const
+		inline Array<T, A> operator/(const T& element) const
 		{
 			return this->differentiated(element);
 		}
 		/// @brief Same as differentiated.
-		/// @see differentiated(const Array<T>& other)
-		inline Array<T> operator/(const Array<T>& other) const
+		/// @see differentiated(const Array<T, A>& other)
+		inline Array<T, A> operator/(const Array<T, A>& other) const
 		{
 			return this->differentiated(other);
 		}
@@ -0,0 +1,296 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+///
+/// @section DESCRIPTION
+///
+/// Provides Array algorithms that split the work across multiple threads.
+
+#ifndef HLTYPES_ARRAY_PARALLEL_H
+#define HLTYPES_ARRAY_PARALLEL_H
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "harray.h"
+#include "hltypesUtil.h"
+#include "hthreadpool.h"
+
+#ifndef HLTYPES_PARALLEL_THRESHOLD
+/// @brief Minimum number of elements for which parallel Array algorithms split the work across threads.
+/// @note Smaller Arrays are processed serially since the threading overhead would outweigh the gain.
+#define HLTYPES_PARALLEL_THRESHOLD 10000
+#endif
+
+namespace hltypes
+{
+	/// @brief Gets the number of chunks elements should be split into for parallel processing.
+	/// @param[in] size Number of elements.
+	/// @param[in] threshold Minimum number of elements for which multiple threads are used.
+	/// @param[in] chunksPerThread Number of chunks per thread for better load balancing.
+	/// @return Number of chunks or 1 if the elements should be processed serially.
+	inline int _parallelChunkCount(int size, int threshold, int chunksPerThread)
+	{
+		if (size < hmax(threshold, 2))
+		{
+			return 1;
+		}
+		int threadCount = ThreadPool::getShared()->getWorkerCount() + 1;
+		if (threadCount <= 1)
+		{
+			return 1;
+		}
+		return hmin(threadCount * chunksPerThread, size);
+	}
+	/// @brief Executes one chunk of _parallelFor().
+	/// @param[in] chunk Chunk index.
+	/// @param[in] data Job data.
+	template <typename F>
+	void _parallelJob(int chunk, void* data)
+	{
+		std::pair<F*, std::pair<int, int> >* job = (std::pair<F*, std::pair<int, int> >*)data;
+		int size = job->second.first;
+		int chunkCount = job->second.second;
+		(*job->first)(chunk, (int)((int64_t)size * chunk / chunkCount), (int)((int64_t)size * (chunk + 1) / chunkCount));
+	}
+	/// @brief Executes a function on consecutive ranges of indices using the shared ThreadPool.
+	/// @param[in] size Number of indices.
+	/// @param[in] chunkCount Number of ranges.
+	/// @param[in] function Callable that takes the chunk index, the start index and the end index.
+	template <typename F>
+	inline void _parallelFor(int size, int chunkCount, F function)
+	{
+		std::pair<F*, std::pair<int, int> > job(&function, std::pair<int, int>(size, chunkCount));
+		ThreadPool::getShared()->execute(&_parallelJob<F>, &job, chunkCount);
+	}
+	/// @brief Joins the results of parallel chunks in order.
+	/// @param[in] chunks Results of the chunks.
+	/// @param[in] size Total number of elements.
+	/// @return A new Array.
+	template <typename T, typename A>
+	inline Array<T, A> _parallelJoin(std::vector<Array<T, A> >& chunks, int size)
+	{
+		Array<T, A> result(chunks[0].get_allocator());
+		result.reserve(size);
+		for_iter (i, 0, (int)chunks.size())
+		{
+			result.add(std::move(chunks[i]));
+		}
+		return result;
+	}
+	/// @brief Sorts elements in an Array using multiple threads.
+	/// @param[in] array The Array.
+	/// @param[in] compare Comparison callable.
+	/// @param[in] threshold Minimum number of elements for which multiple threads are used.
+	/// @note Chunks are stable sorted in parallel and then merged pairwise in parallel.
+	template <typename T, typename A, typename C>
+	inline void _parallelSort(Array<T, A>& array, C compare, int threshold)
+	{
+		int size = array.size();
+		int chunkCount = _parallelChunkCount(size, threshold, 1);
+		if (chunkCount <= 1)
+		{
+			if (size > 0)
+			{
+				std::stable_sort(array.begin(), array.end(), compare);
+			}
+			return;
+		}
+		typename Array<T, A>::iterator_t begin = array.begin();
+		_parallelFor(size, chunkCount, [&](int chunk, int start, int end)
+		{
+			std::stable_sort(begin + start, begin + end, compare);
+		});
+		// chunk boundaries are the same as the ones used by _parallelFor()
+		std::vector<int> bounds(chunkCount + 1);
+		for_iter (i, 0, chunkCount + 1)
+		{
+			bounds[i] = (int)((int64_t)size * i / chunkCount);
+		}
+		for (int width = 1; width < chunkCount; width *= 2)
+		{
+			int mergeCount = (chunkCount - width + width * 2 - 1) / (width * 2);
+			_parallelFor(mergeCount, mergeCount, [&](int merge, int, int)
+			{
+				int first = merge * width * 2;
+				int middle = first + width;
+				int last = hmin(first + width * 2, chunkCount);
+				std::inplace_merge(begin + bounds[first], begin + bounds[middle], begin + bounds[last], compare);
+			});
+		}
+	}
+
+	/// @brief Sorts elements in an Array using multiple threads.
+	/// @param[in] array The Array.
+	/// @param[in] threshold Minimum number of elements for which multiple threads are used.
+	/// @note The sorting order is ascending.
+	/// @note The result is the same as with Array::sort(), including the order of equal elements.
+	template <typename T, typename A>
+	inline void parallelSort(Array<T, A>& array, int threshold = HLTYPES_PARALLEL_THRESHOLD)
+	{
+		_parallelSort(array, std::less<T>(), threshold);
+	}
+	/// @brief Sorts elements in an Array using multiple threads.
+	/// @param[in] array The Array.
+	/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+	/// @param[in] threshold Minimum number of elements for which multiple threads are used.
+	/// @note The sorting order is ascending.
+	/// @note compareFunction should return true if first element is less than the second element.
+	/// @note The result is the same as with Array::sort(compareFunction), including the order of equal elements.
+	template <typename T, typename A>
+	inline void parallelSort(Array<T, A>& array, bool (*compareFunction)(T const&, T const&), int threshold = HLTYPES_PARALLEL_THRESHOLD)
+	{
+		_parallelSort(array, compareFunction, threshold);
+	}
+	/// @brief Creates new Array with new elements obtained from the elements of an Array using multiple threads.
+	/// @param[in] array The Array.
+	/// @param[in] generateFunction Function pointer with generation function for the new elements.
+	/// @param[in] threshold Minimum number of elements for which multiple threads are used.
+	/// @return A new Array with the new elements.
+	/// @note generateFunction has to be thread-safe.
+	template <typename S, typename T, typename A>
+	inline Array<S> parallelMapped(const Array<T, A>& array, S (*generateFunction)(T const&), int threshold = HLTYPES_PARALLEL_THRESHOLD)
+	{
+		int chunkCount = _parallelChunkCount(array.size(), threshold, 4);
+		if (chunkCount <= 1)
+		{
+			return array.mapped(generateFunction);
+		}
+		std::vector<Array<S> > results(chunkCount);
+		_parallelFor(array.size(), chunkCount, [&](int chunk, int start, int end)
+		{
+			Array<S>& result = results[chunk];
+			result.reserve(end - start);
+			for (typename Array<T, A>::const_iterator_t it = array.begin() + start, itEnd = array.begin() + end; it != itEnd; ++it)
+			{
+				result.add(generateFunction(*it));
+			}
+		});
+		return _parallelJoin(results, array.size());
+	}
+	/// @brief Finds and returns new Array of elements that match the condition using multiple threads.
+	/// @param[in] array The Array.
+	/// @param[in] conditionFunction Function pointer with condition function that takes one element of type T and returns bool.
+	/// @param[in] threshold Minimum number of elements for which multiple threads are used.
+	/// @return New Array with all matching elements in their original order.
+	/// @note conditionFunction has to be thread-safe.
+	template <typename T, typename A>
+	inline Array<T, A> parallelFindAll(const Array<T, A>& array, bool (*conditionFunction)(T const&), int threshold = HLTYPES_PARALLEL_THRESHOLD)
+	{
+		int chunkCount = _parallelChunkCount(array.size(), threshold, 4);
+		if (chunkCount <= 1)
+		{
+			return array.findAll(conditionFunction);
+		}
+		std::vector<Array<T, A> > results(chunkCount, Array<T, A>(array.get_allocator()));
+		_parallelFor(array.size(), chunkCount, [&](int chunk, int start, int end)
+		{
+			Array<T, A>& result = results[chunk];
+			for (typename Array<T, A>::const_iterator_t it = array.begin() + start, itEnd = array.begin() + end; it != itEnd; ++it)
+			{
+				if (conditionFunction(*it))
+				{
+					result.add(*it);
+				}
+			}
+		});
+		int size = 0;
+		for_iter (i, 0, chunkCount)
+		{
+			size += results[i].size();
+		}
+		return _parallelJoin(results, size);
+	}
+	/// @brief Counts occurrences of elements that satisfy a condition using multiple threads.
+	/// @param[in] array The Array.
+	/// @param[in] conditionFunction Function pointer with condition function that takes one element of type T and returns bool.
+	/// @param[in] threshold Minimum number of elements for which multiple threads are used.
+	/// @return Number of occurrences of elements that satisfy the condition.
+	/// @note conditionFunction has to be thread-safe.
+	template <typename T, typename A>
+	inline int parallelCount(const Array<T, A>& array, bool (*conditionFunction)(T const&), int threshold = HLTYPES_PARALLEL_THRESHOLD)
+	{
+		int chunkCount = _parallelChunkCount(array.size(), threshold, 4);
+		if (chunkCount <= 1)
+		{
+			return array.count(conditionFunction);
+		}
+		std::vector<int> counts(chunkCount, 0);
+		_parallelFor(array.size(), chunkCount, [&](int chunk, int start, int end)
+		{
+			int result = 0;
+			for (typename Array<T, A>::const_iterator_t it = array.begin() + start, itEnd = array.begin() + end; it != itEnd; ++it)
+			{
+				if (conditionFunction(*it))
+				{
+					++result;
+				}
+			}
+			counts[chunk] = result;
+		});
+		int result = 0;
+		for_iter (i, 0, chunkCount)
+		{
+			result += counts[i];
+		}
+		return result;
+	}
+	/// @brief Processes each element of an Array with a special function using multiple threads.
+	/// @param[in] array The Array.
+	/// @param[in] processFunction Function pointer with processing function for the elements.
+	/// @param[in] threshold Minimum number of elements for which multiple threads are used.
+	/// @note processFunction has to be thread-safe and the order of calls is unspecified.
+	template <typename T, typename A>
+	inline void parallelEach(const Array<T, A>& array, void (*processFunction)(T const&), int threshold = HLTYPES_PARALLEL_THRESHOLD)
+	{
+		int chunkCount = _parallelChunkCount(array.size(), threshold, 4);
+		if (chunkCount <= 1)
+		{
+			for (typename Array<T, A>::const_iterator_t it = array.begin(); it != array.end(); ++it)
+			{
+				processFunction(*it);
+			}
+			return;
+		}
+		_parallelFor(array.size(), chunkCount, [&](int chunk, int start, int end)
+		{
+			for (typename Array<T, A>::const_iterator_t it = array.begin() + start, itEnd = array.begin() + end; it != itEnd; ++it)
+			{
+				processFunction(*it);
+			}
+		});
+	}
+	/// @brief Modifies each element of an Array with a special function using multiple threads.
+	/// @param[in] array The Array.
+	/// @param[in] processFunction Function pointer with processing function that modifies the elements.
+	/// @param[in] threshold Minimum number of elements for which multiple threads are used.
+	/// @note processFunction has to be thread-safe and the order of calls is unspecified.
+	template <typename T, typename A>
+	inline void parallelEach(Array<T, A>& array, void (*processFunction)(T&), int threshold = HLTYPES_PARALLEL_THRESHOLD)
+	{
+		int chunkCount = _parallelChunkCount(array.size(), threshold, 4);
+		if (chunkCount <= 1)
+		{
+			for (typename Array<T, A>::iterator_t it = array.begin(); it != array.end(); ++it)
+			{
+				processFunction(*it);
+			}
+			return;
+		}
+		_parallelFor(array.size(), chunkCount, [&](int chunk, int start, int end)
+		{
+			for (typename Array<T, A>::iterator_t it = array.begin() + start, itEnd = array.begin() + end; it != itEnd; ++it)
+			{
+				processFunction(*it);
+			}
+		});
+	}
+}
+
+#endif
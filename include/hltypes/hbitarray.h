@@ -0,0 +1,229 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+///
+/// @section DESCRIPTION
+///
+/// Provides a compact array of bits.
+
+#ifndef HLTYPES_BIT_ARRAY_H
+#define HLTYPES_BIT_ARRAY_H
+
+#include <stdint.h>
+#include <vector>
+
+#include "hexception.h"
+#include "hltypesExport.h"
+#include "hstring.h"
+
+namespace hltypes
+{
+	class StreamBase;
+
+	/// @brief Array of bits that packs 64 bits into one word.
+	/// @note Use it instead of Array<bool> or Array<unsigned char> for large masks and flags.
+	/// @note Bit operations and counting work on whole words.
+	class hltypesExport BitArray
+	{
+	public:
+		friend class StreamBase;
+
+		/// @brief Empty constructor.
+		BitArray();
+		/// @brief Constructor with size.
+		/// @param[in] size Number of bits.
+		/// @param[in] value Initial value of all bits.
+		BitArray(int size, bool value = false);
+		/// @brief Copy constructor.
+		/// @param[in] other BitArray to copy.
+		BitArray(const BitArray& other);
+		/// @brief Move constructor.
+		/// @param[in] other BitArray to move.
+		/// @note other is left empty.
+		BitArray(BitArray&& other);
+		/// @brief Destructor.
+		~BitArray();
+
+		/// @brief Copies the bits of another BitArray into this one.
+		/// @param[in] other BitArray to copy.
+		/// @return This BitArray.
+		BitArray& operator=(const BitArray& other);
+		/// @brief Moves the bits of another BitArray into this one.
+		/// @param[in] other BitArray to move.
+		/// @return This BitArray.
+		/// @note other is left empty.
+		BitArray& operator=(BitArray&& other);
+
+		/// @brief Gets the number of bits.
+		/// @return The number of bits.
+		inline int size() const { return this->bitCount; }
+		/// @brief Checks if the BitArray has no bits.
+		/// @return True if the BitArray has no bits.
+		inline bool isEmpty() const { return (this->bitCount == 0); }
+		/// @brief Gets the number of 64 bit words.
+		/// @return The number of 64 bit words.
+		inline int wordCount() const { return (int)this->words.size(); }
+		/// @brief Gets the 64 bit words.
+		/// @return Pointer to the 64 bit words.
+		/// @note Bit i is stored in word i / 64 at bit position i % 64. Unused bits of the last word are always 0.
+		inline const uint64_t* data() const { return (this->words.size() > 0 ? &this->words[0] : NULL); }
+
+		/// @brief Changes the number of bits.
+		/// @param[in] size New number of bits.
+		/// @param[in] value Value of added bits.
+		void resize(int size, bool value = false);
+		/// @brief Removes all bits.
+		void clear();
+		/// @brief Adds a bit at the end.
+		/// @param[in] value Value of the bit.
+		void add(bool value);
+
+		/// @brief Gets the value of a bit.
+		/// @param[in] index Index of the bit.
+		/// @return Value of the bit.
+		inline bool test(int index) const
+		{
+			if (index < 0 || index >= this->bitCount)
+			{
+				throw ContainerIndexException(index);
+			}
+			return ((this->words[index >> 6] >> (index & 63)) & 1) != 0;
+		}
+		/// @brief Sets the value of a bit.
+		/// @param[in] index Index of the bit.
+		/// @param[in] value New value of the bit.
+		inline void set(int index, bool value = true)
+		{
+			if (index < 0 || index >= this->bitCount)
+			{
+				throw ContainerIndexException(index);
+			}
+			if (value)
+			{
+				this->words[index >> 6] |= ((uint64_t)1 << (index & 63));
+			}
+			else
+			{
+				this->words[index >> 6] &= ~((uint64_t)1 << (index & 63));
+			}
+		}
+		/// @brief Sets a bit to false.
+		/// @param[in] index Index of the bit.
+		inline void reset(int index)
+		{
+			this->set(index, false);
+		}
+		/// @brief Inverts a bit.
+		/// @param[in] index Index of the bit.
+		inline void flip(int index)
+		{
+			if (index < 0 || index >= this->bitCount)
+			{
+				throw ContainerIndexException(index);
+			}
+			this->words[index >> 6] ^= ((uint64_t)1 << (index & 63));
+		}
+		/// @brief Sets all bits to true.
+		void set();
+		/// @brief Sets all bits to false.
+		void reset();
+		/// @brief Inverts all bits.
+		void flip();
+		/// @brief Sets the value of a range of bits.
+		/// @param[in] start Index of the first bit.
+		/// @param[in] count Number of bits.
+		/// @param[in] value New value of the bits.
+		/// @note Whole words are written at once.
+		void set(int start, int count, bool value);
+
+		/// @brief Counts the bits that are set.
+		/// @return Number of bits that are set.
+		int count() const;
+		/// @brief Checks if any bit is set.
+		/// @return True if any bit is set.
+		bool any() const;
+		/// @brief Checks if no bit is set.
+		/// @return True if no bit is set.
+		inline bool none() const { return !this->any(); }
+		/// @brief Checks if all bits are set.
+		/// @return True if all bits are set.
+		/// @note Returns true if there are no bits.
+		bool all() const;
+		/// @brief Finds the next bit that is set.
+		/// @param[in] start Index from which to start searching.
+		/// @return Index of the next set bit at start or after it or -1 if there is none.
+		/// @note Skips whole words that have no bits set.
+		int findNext(int start = 0) const;
+		/// @brief Finds the first bit that is set.
+		/// @return Index of the first set bit or -1 if there is none.
+		inline int findFirst() const { return this->findNext(0); }
+		/// @brief Gets the indices of all bits that are set.
+		/// @return Indices of all set bits.
+		Array<int> indices() const;
+
+		/// @brief Checks if all bits are equal to those of another BitArray.
+		/// @param[in] other Another BitArray.
+		/// @return True if sizes and all bits are equal.
+		bool equals(const BitArray& other) const;
+
+		/// @brief Returns the value of a bit.
+		/// @param[in] index Index of the bit.
+		/// @return Value of the bit.
+		inline bool operator[](int index) const { return this->test(index); }
+		/// @brief Same as equals.
+		/// @see equals
+		inline bool operator==(const BitArray& other) const { return this->equals(other); }
+		/// @brief Same as !equals.
+		/// @see equals
+		inline bool operator!=(const BitArray& other) const { return !this->equals(other); }
+		/// @brief Combines the bits with another BitArray using AND.
+		/// @param[in] other Another BitArray of the same size.
+		/// @return This BitArray.
+		BitArray& operator&=(const BitArray& other);
+		/// @brief Combines the bits with another BitArray using OR.
+		/// @param[in] other Another BitArray of the same size.
+		/// @return This BitArray.
+		BitArray& operator|=(const BitArray& other);
+		/// @brief Combines the bits with another BitArray using XOR.
+		/// @param[in] other Another BitArray of the same size.
+		/// @return This BitArray.
+		BitArray& operator^=(const BitArray& other);
+		/// @brief Creates a new BitArray with the bits combined using AND.
+		/// @param[in] other Another BitArray of the same size.
+		/// @return A new BitArray.
+		BitArray operator&(const BitArray& other) const;
+		/// @brief Creates a new BitArray with the bits combined using OR.
+		/// @param[in] other Another BitArray of the same size.
+		/// @return A new BitArray.
+		BitArray operator|(const BitArray& other) const;
+		/// @brief Creates a new BitArray with the bits combined using XOR.
+		/// @param[in] other Another BitArray of the same size.
+		/// @return A new BitArray.
+		BitArray operator^(const BitArray& other) const;
+		/// @brief Creates a new BitArray with all bits inverted.
+		/// @return A new BitArray.
+		BitArray operator~() const;
+
+	protected:
+		/// @brief The 64 bit words.
+		std::vector<uint64_t> words;
+		/// @brief Number of bits.
+		int bitCount;
+
+		/// @brief Clears the unused bits of the last word.
+		void _clearUnusedBits();
+		/// @brief Checks if another BitArray has the same size.
+		/// @param[in] other Another BitArray.
+		void _checkSize(const BitArray& other) const;
+
+	};
+}
+
+/// @brief Alias for simpler code.
+typedef hltypes::BitArray hbitarray;
+
+#endif
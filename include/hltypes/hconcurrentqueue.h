@@ -0,0 +1,323 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+///
+/// @section DESCRIPTION
+///
+/// Provides a bounded lock-free queue for passing data between multiple threads.
+
+#ifndef HLTYPES_CONCURRENT_QUEUE_H
+#define HLTYPES_CONCURRENT_QUEUE_H
+
+#include <atomic>
+#include <new>
+#include <stddef.h>
+#include <utility>
+
+#include "hexception.h"
+#include "hltypesUtil.h"
+#include "hthread.h"
+
+namespace hltypes
+{
+	/// @brief Bounded lock-free multi-producer/multi-consumer queue.
+	/// @note Every slot has a sequence number that tells producers and consumers whether the slot is ready for them so they only compete for the positions.
+	/// @note The positions of producers and consumers are kept in separate cache lines to avoid false sharing.
+	/// @note Blocking methods wait with Thread::backoff().
+	template <typename T>
+	class ConcurrentQueue
+	{
+	public:
+		/// @brief Basic constructor.
+		/// @param[in] capacity Maximum number of elements. It is rounded up to the next power of 2.
+		inline ConcurrentQueue(int capacity) :
+			enqueuePosition(0),
+			dequeuePosition(0)
+		{
+			if (capacity <= 0)
+			{
+				throw Exception("ConcurrentQueue capacity must be positive!");
+			}
+			size_t size = 1;
+			while (size < (size_t)capacity)
+			{
+				size <<= 1;
+			}
+			this->mask = size - 1;
+			this->cells = (Cell*)::operator new(sizeof(Cell) * size);
+			for_itert (size_t, i, 0, size)
+			{
+				new (&this->cells[i].sequence) std::atomic<size_t>(i);
+			}
+		}
+		/// @brief Destructor.
+		/// @note Elements that have not been popped are destroyed.
+		inline ~ConcurrentQueue()
+		{
+			size_t enqueuePosition = this->enqueuePosition.load(std::memory_order_relaxed);
+			for (size_t i = this->dequeuePosition.load(std::memory_order_relaxed); i != enqueuePosition; ++i)
+			{
+				((T*)&this->cells[i & this->mask].data)->~T();
+			}
+			for_itert (size_t, i, 0, this->mask + 1)
+			{
+				this->cells[i].sequence.~atomic();
+			}
+			::operator delete(this->cells);
+		}
+
+		/// @brief Gets the maximum number of elements.
+		/// @return The maximum number of elements.
+		inline int capacity() const { return (int)(this->mask + 1); }
+		/// @brief Gets the number of elements.
+		/// @return The number of elements.
+		/// @note The result is only a snapshot if other threads use the ConcurrentQueue at the same time.
+		inline int size() const
+		{
+			size_t dequeuePosition = this->dequeuePosition.load(std::memory_order_acquire);
+			size_t enqueuePosition = this->enqueuePosition.load(std::memory_order_acquire);
+			return (enqueuePosition > dequeuePosition ? (int)(enqueuePosition - dequeuePosition) : 0);
+		}
+		/// @brief Checks if the ConcurrentQueue is empty.
+		/// @return True if the ConcurrentQueue is empty.
+		/// @note The result is only a snapshot if other threads use the ConcurrentQueue at the same time.
+		inline bool isEmpty() const { return (this->size() == 0); }
+
+		/// @brief Adds an element if there is space.
+		/// @param[in] element Element to add.
+		/// @return True if the element was added, false if the ConcurrentQueue is full.
+		inline bool tryPush(const T& element)
+		{
+			return this->_tryEmplace(element);
+		}
+		/// @brief Adds an element if there is space.
+		/// @param[in] element Element to add.
+		/// @return True if the element was added, false if the ConcurrentQueue is full.
+		inline bool tryPush(T&& element)
+		{
+			return this->_tryEmplace(std::move(element));
+		}
+		/// @brief Adds as many elements as there is space for.
+		/// @param[in] elements C-type array of elements to add.
+		/// @param[in] count Number of elements.
+		/// @return Number of elements that were added.
+		/// @note Elements from other producers may be interleaved with the batch.
+		inline int tryPush(const T elements[], int count)
+		{
+			int result = 0;
+			while (result < count && this->_tryEmplace(elements[result]))
+			{
+				++result;
+			}
+			return result;
+		}
+		/// @brief Adds an element and waits until there is space if necessary.
+		/// @param[in] element Element to add.
+		inline void push(const T& element)
+		{
+			int idleCount = 0;
+			while (!this->_tryEmplace(element))
+			{
+				Thread::backoff(idleCount);
+			}
+		}
+		/// @brief Adds an element and waits until there is space if necessary.
+		/// @param[in] element Element to add.
+		inline void push(T&& element)
+		{
+			int idleCount = 0;
+			while (!this->_tryEmplace(std::move(element)))
+			{
+				Thread::backoff(idleCount);
+			}
+		}
+		/// @brief Adds elements and waits until there is space if necessary.
+		/// @param[in] elements C-type array of elements to add.
+		/// @param[in] count Number of elements.
+		/// @note Elements from other producers may be interleaved with the batch.
+		inline void push(const T elements[], int count)
+		{
+			int idleCount = 0;
+			int pushed = 0;
+			while (pushed < count)
+			{
+				int current = this->tryPush(elements + pushed, count - pushed);
+				if (current > 0)
+				{
+					pushed += current;
+					idleCount = 0;
+				}
+				else
+				{
+					Thread::backoff(idleCount);
+				}
+			}
+		}
+		/// @brief Removes the oldest element if there is one.
+		/// @param[out] element The removed element.
+		/// @return True if an element was removed, false if the ConcurrentQueue is empty.
+		inline bool tryPop(T& element)
+		{
+			size_t position = this->dequeuePosition.load(std::memory_order_relaxed);
+			Cell* cell = NULL;
+			ptrdiff_t difference = 0;
+			while (true)
+			{
+				cell = &this->cells[position & this->mask];
+				difference = (ptrdiff_t)cell->sequence.load(std::memory_order_acquire) - (ptrdiff_t)(position + 1);
+				if (difference == 0)
+				{
+					if (this->dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+				else if (difference < 0)
+				{
+					return false;
+				}
+				else
+				{
+					position = this->dequeuePosition.load(std::memory_order_relaxed);
+				}
+			}
+			T* slot = (T*)&cell->data;
+			element = std::move(*slot);
+			slot->~T();
+			cell->sequence.store(position + this->mask + 1, std::memory_order_release);
+			return true;
+		}
+		/// @brief Removes as many of the oldest elements as are available.
+		/// @param[out] elements C-type array for the removed elements.
+		/// @param[in] count Maximum number of elements to remove.
+		/// @return Number of elements that were removed.
+		inline int tryPop(T elements[], int count)
+		{
+			int result = 0;
+			while (result < count && this->tryPop(elements[result]))
+			{
+				++result;
+			}
+			return result;
+		}
+		/// @brief Removes the oldest element and waits until there is one if necessary.
+		/// @return The removed element.
+		/// @note T has to be default-constructible.
+		inline T pop()
+		{
+			T result;
+			int idleCount = 0;
+			while (!this->tryPop(result))
+			{
+				Thread::backoff(idleCount);
+			}
+			return result;
+		}
+		/// @brief Removes the oldest elements and waits until there are enough if necessary.
+		/// @param[out] elements C-type array for the removed elements.
+		/// @param[in] count Number of elements to remove.
+		inline void pop(T elements[], int count)
+		{
+			int idleCount = 0;
+			int popped = 0;
+			while (popped < count)
+			{
+				int current = this->tryPop(elements + popped, count - popped);
+				if (current > 0)
+				{
+					popped += current;
+					idleCount = 0;
+				}
+				else
+				{
+					Thread::backoff(idleCount);
+				}
+			}
+		}
+
+	protected:
+		/// @brief A slot for one element.
+		struct Cell
+		{
+			/// @brief Equals the position for which the Cell is free to be written and position + 1 when it can be read.
+			std::atomic<size_t> sequence;
+			/// @brief Storage for the element.
+			typename std::aligned_storage<sizeof(T), std::alignment_of<T>::value>::type data;
+		};
+
+		/// @brief Slots storage.
+		Cell* cells;
+		/// @brief Capacity minus 1 for wrapping positions into the storage.
+		size_t mask;
+		/// @brief Padding so the producer position uses its own cache line.
+		char _padding0[HLTYPES_CACHE_LINE_SIZE];
+		/// @brief Position of the next element to push.
+		std::atomic<size_t> enqueuePosition;
+		/// @brief Padding so the consumer position uses its own cache line.
+		char _padding1[HLTYPES_CACHE_LINE_SIZE];
+		/// @brief Position of the next element to pop.
+		std::atomic<size_t> dequeuePosition;
+		/// @brief Padding so the consumer position does not share a cache line with following data.
+		char _padding2[HLTYPES_CACHE_LINE_SIZE];
+
+		/// @brief Constructs an element in place if there is space.
+		/// @param[in] element Element to add.
+		/// @return True if the element was added.
+		template <typename E>
+		inline bool _tryEmplace(E&& element)
+		{
+			size_t position = this->enqueuePosition.load(std::memory_order_relaxed);
+			Cell* cell = NULL;
+			ptrdiff_t difference = 0;
+			while (true)
+			{
+				cell = &this->cells[position & this->mask];
+				difference = (ptrdiff_t)cell->sequence.load(std::memory_order_acquire) - (ptrdiff_t)position;
+				if (difference == 0)
+				{
+					if (this->enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+				else if (difference < 0)
+				{
+					return false;
+				}
+				else
+				{
+					position = this->enqueuePosition.load(std::memory_order_relaxed);
+				}
+			}
+			new (&cell->data) T(std::forward<E>(element));
+			cell->sequence.store(position + 1, std::memory_order_release);
+			return true;
+		}
+
+	private:
+		/// @brief Copy constructor.
+		/// @note Usage is not allowed and it will throw an exception.
+		inline ConcurrentQueue(const ConcurrentQueue& other)
+		{
+			throw ObjectCannotCopyException("hltypes::ConcurrentQueue");
+		}
+		/// @brief Assignment operator.
+		/// @note Usage is not allowed and it will throw an exception.
+		inline ConcurrentQueue& operator=(ConcurrentQueue& other)
+		{
+			throw ObjectCannotAssignException("hltypes::ConcurrentQueue");
+			return (*this);
+		}
+
+	};
+
+}
+
+/// @brief Alias for simpler code.
+#define hconcurrentqueue hltypes::ConcurrentQueue
+
+#endif
@@ -14,15 +14,88 @@
 #define HLTYPES_CONTAINER_H
 
 #include <algorithm>
+#include <iterator>
+#include <limits>
+#include <string.h>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "hexception.h"
 #include "hltypesUtil.h"
 #include "hplatform.h"
+#include "hsimd.h"
 #include "hstring.h"
+#include "hview.h"
+
+#ifndef HLTYPES_CONTAINER_CHECKS
+/// @brief Whether operator[] of containers checks the index bounds and throws ContainerIndexException.
+/// @note Define as 0 to remove the checks in operator[], e.g. for release builds. at() always checks the bounds.
+#define HLTYPES_CONTAINER_CHECKS 1
+#endif
 
 namespace hltypes
 {
+	/// @brief Maps an integral value to an unsigned key that preserves the ordering for radix sort.
+	/// @param[in] value The value.
+	/// @return The unsigned key.
+	template <typename K>
+	inline uint64_t _radixSortKey(K value)
+	{
+		static const int bits = (int)sizeof(K) * 8;
+		uint64_t result = (uint64_t)value;
+		if (bits < 64)
+		{
+			result &= ((uint64_t)1 << (bits & 63)) - 1;
+		}
+		if (std::numeric_limits<K>::is_signed)
+		{
+			result ^= (uint64_t)1 << (bits - 1);
+		}
+		return result;
+	}
+	/// @brief Maps a float value to an unsigned key that preserves the ordering for radix sort.
+	/// @param[in] value The value.
+	/// @return The unsigned key.
+	inline uint64_t _radixSortKey(float value)
+	{
+		uint32_t bits = 0;
+		memcpy(&bits, &value, sizeof(float));
+		return ((bits & 0x80000000) != 0 ? ~bits : (bits | 0x80000000));
+	}
+	/// @brief Maps a double value to an unsigned key that preserves the ordering for radix sort.
+	/// @param[in] value The value.
+	/// @return The unsigned key.
+	inline uint64_t _radixSortKey(double value)
+	{
+		uint64_t bits = 0;
+		memcpy(&bits, &value, sizeof(double));
+		return ((bits & 0x8000000000000000ULL) != 0 ? ~bits : (bits | 0x8000000000000000ULL));
+	}
+	/// @brief Whether a type can be used as a radix sort key.
+	/// @note Only integral types, float and double have an ordering-preserving key. Other floating point types like long double do not.
+	template <typename K>
+	struct _RadixSortable : std::integral_constant<bool, std::is_integral<K>::value || std::is_same<K, float>::value || std::is_same<K, double>::value>
+	{
+	};
+
+	/// @brief Whether a container type stores its elements contiguously and provides access to them through data().
+	template <typename STD>
+	struct _ContiguousStorage : std::false_type
+	{
+	};
+	template <typename T, typename A>
+	struct _ContiguousStorage<std::vector<T, A> > : std::true_type
+	{
+	};
+
+	/// @brief Whether String::join() has an overload for an element type.
+	template <typename T>
+	struct _StringJoinable : std::integral_constant<bool, std::is_same<T, String>::value || std::is_same<T, int>::value || std::is_same<T, unsigned int>::value ||
+		std::is_same<T, int64_t>::value || std::is_same<T, uint64_t>::value || std::is_same<T, float>::value || std::is_same<T, double>::value>
+	{
+	};
+
 	/// @brief Encapsulates container functionality and adds high level methods.
 	template <typename STD, typename T>
 	class Container : STD
@@ -44,9 +117,21 @@ namespace hltypes
 		/// @brief Copy constructor.
 		/// @param[in] other Container to copy.
 		inline Container(const Container& other) :
-			STD()
+			STD(static_cast<const STD&>(other))
+		{
+		}
+		/// @brief Constructor with allocator.
+		/// @param[in] allocator Allocator used for the elements.
+		inline explicit Container(const typename STD::allocator_type& allocator) :
+			STD(allocator)
+		{
+		}
+		/// @brief Move constructor.
+		/// @param[in] other Container to move.
+		/// @note other is left empty.
+		inline Container(Container&& other) :
+			STD(std::move(static_cast<STD&>(other)))
 		{
-			this->insertAt(0, other);
 		}
 		/// @brief Constructor from single element.
 		/// @param[in] element Element to insert.
@@ -98,12 +183,35 @@ namespace hltypes
 		{
 			this->insertAt(0, other, start, count);
 		}
+		/// @brief Copies the elements of another Container into this one.
+		/// @param[in] other Container to copy.
+		/// @return This Container.
+		inline Container& operator=(const Container& other)
+		{
+			STD::operator=(static_cast<const STD&>(other));
+			return (*this);
+		}
+		/// @brief Moves the elements of another Container into this one.
+		/// @param[in] other Container to move.
+		/// @return This Container.
+		/// @note other is left empty.
+		inline Container& operator=(Container&& other)
+		{
+			STD::operator=(std::move(static_cast<STD&>(other)));
+			return (*this);
+		}
 		/// @brief Returns the number of elements in the Container.
 		/// @return The number of elements in the Container.
 		inline int size() const
 		{
 			return (int)STD::size();
 		}
+		/// @brief Gets the allocator used for the elements.
+		/// @return Copy of the allocator.
+		inline typename STD::allocator_type get_allocator() const
+		{
+			return STD::get_allocator();
+		}
 		/// @brief Check if Container is empty.
 		/// @return True if Container is empty.
 		inline bool isEmpty() const
@@ -168,20 +276,11 @@ namespace hltypes
 		/// @return True if number of elements are equal and all pairs of elements at the same positions are equal.
 		inline bool equals(const Container& other) const
 		{
-			int size = this->size();
-			if (size != other.size())
+			if (this->size() != other.size())
 			{
 				return false;
 			}
-			for_iter (i, 0, size)
-			{
-				// making sure operator== is used, not !=
-				if (!(this->at(i) == other.at(i)))
-				{
-					return false;
-				}
-			}
-			return true;
+			return this->_equals(other, _Vectorizable());
 		}
 		/// @brief Compares the contents of two Containers for being not equal.
 		/// @param[in] other Another Container.
@@ -193,10 +292,15 @@ namespace hltypes
 			{
 				return true;
 			}
-			for_iter (i, 0, size)
+			if (_Vectorizable::value)
+			{
+				return !this->_equals(other, _Vectorizable());
+			}
+			const_iterator_t otherIt = other.begin();
+			for (const_iterator_t it = STD::begin(); it != STD::end(); ++it, ++otherIt)
 			{
 				// making sure operator!= is used, not ==
-				if (this->at(i) != other.at(i))
+				if (*it != *otherIt)
 				{
 					return true;
 				}
@@ -266,15 +370,7 @@ namespace hltypes
 		/// @return Index of the given element or -1 if element could not be found.
 		inline int indexOf(const T& element) const
 		{
-			int size = this->size();
-			for_iter (i, 0, size)
-			{
-				if (element == this->at(i))
-				{
-					return i;
-				}
-			}
-			return -1;
+			return this->_indexOf(element, _Vectorizable());
 		}
 		/// @brief Checks existence of element in Container.
 		/// @param[in] element Element to search for.
@@ -288,10 +384,9 @@ namespace hltypes
 		/// @return True if all elements are in Container.
 		inline bool has(const Container& other) const
 		{
-			int size = other.size();
-			for_iter (i, 0, size)
+			for (const_iterator_t it = other.begin(); it != other.end(); ++it)
 			{
-				if (this->indexOf(other.at(i)) < 0)
+				if (this->indexOf(*it) < 0)
 				{
 					return false;
 				}
@@ -313,15 +408,21 @@ namespace hltypes
 			}
 			return true;
 		}
+		/// @brief Checks existence of elements in Container.
+		/// @param[in] other Span with elements to search for.
+		/// @return True if all elements are in Container.
+		inline bool has(Span<const T> other) const
+		{
+			return this->has(other.data(), other.size());
+		}
 		/// @brief Checks existence of any element in Container.
 		/// @param[in] other Container with elements to search for.
 		/// @return True if any element is in Container.
 		inline bool hasAny(const Container& other) const
 		{
-			int size = other.size();
-			for_iter (i, 0, size)
+			for (const_iterator_t it = other.begin(); it != other.end(); ++it)
 			{
-				if (this->indexOf(other.at(i)) >= 0)
+				if (this->indexOf(*it) >= 0)
 				{
 					return true;
 				}
@@ -343,21 +444,19 @@ namespace hltypes
 			}
 			return false;
 		}
+		/// @brief Checks existence of any element in Container.
+		/// @param[in] other Span with elements to search for.
+		/// @return True if any element is in Container.
+		inline bool hasAny(Span<const T> other) const
+		{
+			return this->hasAny(other.data(), other.size());
+		}
 		/// @brief Counts occurrences of element in Container.
 		/// @param[in] element Element to search for.
 		/// @return Number of occurrences of given element.
 		inline int count(const T& element) const
 		{
-			int result = 0;
-			int size = this->size();
-			for_iter (i, 0, size)
-			{
-				if (element == this->at(i))
-				{
-					++result;
-				}
-			}
-			return result;
+			return this->_count(element, _Vectorizable());
 		}
 		/// @brief Counts occurrences of elements in Container.
 		/// @param[in] other Container with elements to search for.
@@ -365,10 +464,9 @@ namespace hltypes
 		inline int count(const Container& other) const
 		{
 			int result = 0;
-			int count = other.size();
-			for_iter (i, 0, count)
+			for (const_iterator_t it = other.begin(); it != other.end(); ++it)
 			{
-				result += this->count(other[i]);
+				result += this->count(*it);
 			}
 			return result;
 		}
@@ -391,10 +489,9 @@ namespace hltypes
 		inline int count(bool (*conditionFunction)(T const&)) const
 		{
 			int result = 0;
-			int size = this->size();
-			for_iter (i, 0, size)
+			for (const_iterator_t it = STD::begin(); it != STD::end(); ++it)
 			{
-				if (conditionFunction(this->at(i)))
+				if (conditionFunction(*it))
 				{
 					++result;
 				}
@@ -413,6 +510,43 @@ namespace hltypes
 			}
 			STD::insert(this->_itAdvance(STD::begin(), index), times, element);
 		}
+		/// @brief Inserts new element at specified position by moving it.
+		/// @param[in] index Position where to insert the new element.
+		/// @param[in] element Element to move into the Container.
+		inline void insertAt(const int index, T&& element)
+		{
+			if (index < 0 || index > this->size())
+			{
+				throw ContainerIndexException(index);
+			}
+			STD::insert(this->_itAdvance(STD::begin(), index), std::move(element));
+		}
+		/// @brief Inserts all elements of another Container into this one by moving them.
+		/// @param[in] index Position where to insert the new elements.
+		/// @param[in] other Container of elements to move.
+		/// @note other is left empty.
+		inline void insertAt(const int index, Container&& other)
+		{
+			if (index < 0 || index > this->size())
+			{
+				throw ContainerIndexException(index);
+			}
+			STD::insert(this->_itAdvance(STD::begin(), index), std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+			other.clear();
+		}
+		/// @brief Constructs a new element in place at specified position.
+		/// @param[in] index Position where to construct the new element.
+		/// @param[in] args Arguments passed to the constructor of T.
+		/// @return Reference to the new element.
+		template <typename... Args>
+		inline T& emplaceAt(const int index, Args&&... args)
+		{
+			if (index < 0 || index > this->size())
+			{
+				throw ContainerIndexException(index);
+			}
+			return *STD::emplace(this->_itAdvance(STD::begin(), index), std::forward<Args>(args)...);
+		}
 		/// @brief Inserts all elements of another Container into this one.
 		/// @param[in] index Position where to insert the new elements.
 		/// @param[in] other Container of elements to insert.
@@ -476,12 +610,34 @@ namespace hltypes
 		{
 			STD::insert(this->_itAdvance(STD::begin(), index), other + start, other + (start + count));
 		}
+		/// @brief Inserts all elements of a Span into this Container.
+		/// @param[in] index Position where to insert the new elements.
+		/// @param[in] other Span of elements to insert.
+		inline void insertAt(const int index, Span<const T> other)
+		{
+			STD::insert(this->_itAdvance(STD::begin(), index), other.begin(), other.end());
+		}
 		/// @brief Adds element at the end of Container.
 		/// @param[in] element Element to add.
 		inline void add(const T& element)
 		{
 			STD::push_back(element);
 		}
+		/// @brief Adds element at the end of Container by moving it.
+		/// @param[in] element Element to move into the Container.
+		inline void add(T&& element)
+		{
+			STD::push_back(std::move(element));
+		}
+		/// @brief Constructs a new element in place at the end of Container.
+		/// @param[in] args Arguments passed to the constructor of T.
+		/// @return Reference to the new element.
+		template <typename... Args>
+		inline T& emplace(Args&&... args)
+		{
+			STD::emplace_back(std::forward<Args>(args)...);
+			return STD::back();
+		}
 		/// @brief Adds element at the end of Container n times.
 		/// @param[in] element Element to add.
 		/// @param[in] times Number of times to add the element.
@@ -495,6 +651,13 @@ namespace hltypes
 		{
 			this->insertAt(this->size(), other);
 		}
+		/// @brief Adds all elements from another Container at the end of this one by moving them.
+		/// @param[in] other Container of elements to move.
+		/// @note other is left empty.
+		inline void add(Container&& other)
+		{
+			this->insertAt(this->size(), std::move(other));
+		}
 		/// @brief Adds all elements from another Container at the end of this one.
 		/// @param[in] other Container of elements to add.
 		/// @param[in] count Number of elements to add.
@@ -525,6 +688,13 @@ namespace hltypes
 		{
 			this->insertAt(this->size(), other, start, count);
 		}
+		/// @brief Adds all elements from a Span at the end of Container.
+		/// @param[in] other Span of elements to add.
+		/// @note Array, Stream and C-type arrays convert to Span.
+		inline void add(Span<const T> other)
+		{
+			this->insertAt(this->size(), other);
+		}
 		/// @brief Adds element at the beginning of Container n times.
 		/// @param[in] element Element to add.
 		/// @param[in] times Number of times to add the element.
@@ -532,12 +702,25 @@ namespace hltypes
 		{
 			this->insertAt(0, element, times);
 		}
+		/// @brief Adds element at the beginning of Container by moving it.
+		/// @param[in] element Element to move into the Container.
+		inline void addFirst(T&& element)
+		{
+			this->insertAt(0, std::move(element));
+		}
 		/// @brief Adds all elements from another Container at the beginning of this one.
 		/// @param[in] other Container of elements to add.
 		inline void addFirst(const Container& other)
 		{
 			this->insertAt(0, other);
 		}
+		/// @brief Adds all elements from another Container at the beginning of this one by moving them.
+		/// @param[in] other Container of elements to move.
+		/// @note other is left empty.
+		inline void addFirst(Container&& other)
+		{
+			this->insertAt(0, std::move(other));
+		}
 		/// @brief Adds all elements from another Container at the beginning of this one.
 		/// @param[in] other Container of elements to add.
 		/// @param[in] count Number of elements to add.
@@ -568,6 +751,12 @@ namespace hltypes
 		{
 			this->insertAt(0, other, start, count);
 		}
+		/// @brief Adds all elements from a Span at the beginning of Container.
+		/// @param[in] other Span of elements to add.
+		inline void addFirst(Span<const T> other)
+		{
+			this->insertAt(0, other);
+		}
 		/// @brief Removes element at given index.
 		/// @param[in] index Index of element to remove.
 		/// @return The removed element.
@@ -576,14 +765,14 @@ namespace hltypes
 			int size = this->size();
 			if (index < 0)
 			{
-				index -= size;
+				index += size;
 			}
 			if (index < 0 || index >= size)
 			{
 				throw ContainerIndexException(index);
 			}
 			iterator_t it = this->_itAdvance(STD::begin(), index);
-			T result = (*it);
+			T result = std::move(*it);
 			STD::erase(it);
 			return result;
 		}
@@ -591,27 +780,31 @@ namespace hltypes
 		/// @param[in] element Element to remove.
 		inline void remove(T element)
 		{
-			int index = this->indexOf(element);
-			if (index < 0)
+			iterator_t it = std::find(STD::begin(), STD::end(), element);
+			if (it == STD::end())
 			{
 				throw ContainerElementNotFoundException();
 			}
-			STD::erase(this->_itAdvance(STD::begin(), index));
+			STD::erase(it);
 		}
 		/// @brief Removes first occurrence of each element in another Container from this one.
 		/// @param[in] other Container of elements to remove.
 		inline void remove(const Container& other)
 		{
-			int size = other.size();
-			int index = 0;
-			for_iter (i, 0, size)
+			if (&other == this)
 			{
-				index = this->indexOf(other.at(i));
-				if (index < 0)
+				STD::clear();
+				return;
+			}
+			iterator_t it;
+			for (const_iterator_t otherIt = other.begin(); otherIt != other.end(); ++otherIt)
+			{
+				it = std::find(STD::begin(), STD::end(), *otherIt);
+				if (it == STD::end())
 				{
 					throw ContainerElementNotFoundException();
 				}
-				STD::erase(this->_itAdvance(STD::begin(), index));
+				STD::erase(it);
 			}
 		}
 		/// @brief Removes first element of Container.
@@ -628,7 +821,7 @@ namespace hltypes
 			{
 				throw ContainerIndexException(0);
 			}
-			T element = STD::back();
+			T element = std::move(STD::back());
 			STD::pop_back();
 			return element;
 		}
@@ -646,45 +839,33 @@ namespace hltypes
 			{
 				index = hrand(size);
 			}
-			T result = this->at(index);
-			this->removeAt(index);
-			return result;
+			return this->removeAt(index);
 		}
 		/// @brief Removes all occurrences of element in Container.
 		/// @param[in] element Element to remove.
 		/// @return Number of elements removed.
 		inline int removeAll(const T& element)
 		{
-			Container<std::vector<int>, int> indices = this->_indicesOf<Container<std::vector<int>, int> >(element);
-			iterator_t it = STD::begin();
-			int size = indices.size();
-			for_iter_r (i, size, 0)
-			{
-				STD::erase(this->_itAdvance(it, indices.at(i)));
-			}
-			return size;
+			// copy in case element is part of this Container
+			T value = element;
+			iterator_t it = std::remove(STD::begin(), STD::end(), value);
+			int result = (int)std::distance(it, STD::end());
+			STD::erase(it, STD::end());
+			return result;
 		}
 		/// @brief Removes all occurrences of each element in another Container from this one.
 		/// @param[in] other Container of elements to remove.
 		/// @return Number of elements removed.
 		inline int removeAll(const Container& other)
 		{
-			Container<std::vector<int>, int> indices;
-			iterator_t it;
-			int indicesSize = 0;
-			int count = 0;
-			for_iter (i, 0, other.size()) // has to stay other.size() here
-			{
-				indices = this->_indicesOf<Container<std::vector<int>, int> >(other.at(i));
-				it = STD::begin();
-				indicesSize = indices.size();
-				for_iter_r (j, indicesSize, 0)
-				{
-					STD::erase(this->_itAdvance(it, indices.at(j)));
-				}
-				count += indicesSize;
+			int result = this->size();
+			if (&other == this)
+			{
+				STD::clear();
+				return result;
 			}
-			return count;
+			STD::erase(std::remove_if(STD::begin(), STD::end(), [&other](const T& element) { return other.has(element); }), STD::end());
+			return (result - this->size());
 		}
 		/// @brief Finds minimum element in Container.
 		/// @return Minimum Element.
@@ -694,7 +875,7 @@ namespace hltypes
 			{
 				throw ContainerEmptyException("min()");
 			}
-			return (*std::min_element(STD::begin(), STD::end()));
+			return this->_minMax(_Vectorizable()).first;
 		}
 		/// @brief Finds minimum element in Container.
 		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
@@ -716,7 +897,7 @@ namespace hltypes
 			{
 				throw ContainerEmptyException("max()");
 			}
-			return (*std::max_element(STD::begin(), STD::end()));
+			return this->_minMax(_Vectorizable()).second;
 		}
 		/// @brief Finds maximum element in Container.
 		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
@@ -730,6 +911,24 @@ namespace hltypes
 			}
 			return (*std::max_element(STD::begin(), STD::end(), compareFunction));
 		}
+		/// @brief Finds minimum and maximum element in Container in one pass.
+		/// @return Pair of minimum and maximum element.
+		inline std::pair<T, T> minmax() const
+		{
+			if (this->size() == 0)
+			{
+				throw ContainerEmptyException("minmax()");
+			}
+			return this->_minMax(_Vectorizable());
+		}
+		/// @brief Calculates the sum of all elements in Container.
+		/// @return Sum of all elements or a value-initialized one if the Container is empty.
+		/// @note Integers are summed up as 64 bit integers and floating point values as double.
+		/// @note Other types are summed up using operator+=.
+		inline typename _SumType<T>::type sum() const
+		{
+			return this->_sum(_Vectorizable());
+		}
 		/// @brief Gets a random element in Container.
 		/// @return Random element.
 		inline T random() const
@@ -739,25 +938,16 @@ namespace hltypes
 			{
 				throw ContainerEmptyException("random()");
 			}
-			return this->at(size > 1 ? hrand(size) : 0);
+			return *this->_itAdvance(STD::begin(), (size > 1 ? hrand(size) : 0));
 		}
 		/// @brief Randomizes order of elements in Container.
 		/// @note Not using std::random_shuffle() due to issues with std::srand() in some implementations.
 		/// @note This implementation uses FisherYates Shuffle.
 		inline void randomize()
 		{
-			int size = this->size();
-			if (size > 1)
+			if (this->size() > 1)
 			{
-				int j = 0;
-				for_iter_r (i, size, 1)
-				{
-					j = hrand(i + 1);
-					if (i != j)
-					{
-						hswap(this->at(i), this->at(j));
-					}
-				}
+				this->_randomize(typename std::iterator_traits<iterator_t>::iterator_category());
 			}
 		}
 		/// @brief Reverses order of elements.
@@ -771,18 +961,21 @@ namespace hltypes
 		/// @brief Removes duplicates in Container.
 		inline void removeDuplicates()
 		{
-			Container<std::vector<int>, int> indices;
-			iterator_t it = STD::begin();
-			int indicesSize = 0;
-			for_iter (i, 0, this->size()) // has to stay this->size() here
+			// keeps the first occurrence of each element by moving it to the front
+			iterator_t begin = STD::begin();
+			iterator_t write = begin;
+			for (iterator_t it = begin; it != STD::end(); ++it)
 			{
-				indices = this->_indicesOf<Container<std::vector<int>, int> >(this->at(i));
-				indicesSize = indices.size();
-				for_iter_r (j, indicesSize, 1)
+				if (std::find(begin, write, *it) == write)
 				{
-					STD::erase(this->_itAdvance(it, indices.at(j)));
+					if (write != it)
+					{
+						*write = std::move(*it);
+					}
+					++write;
 				}
 			}
+			STD::erase(write, STD::end());
 		}
 		/// @brief Sorts elements in Container.
 		/// @note The sorting order is ascending.
@@ -790,7 +983,7 @@ namespace hltypes
 		{
 			if (this->size() > 0)
 			{
-				std::stable_sort(STD::begin(), STD::end());
+				this->_sort(std::less<T>(), typename std::iterator_traits<iterator_t>::iterator_category());
 			}
 		}
 		/// @brief Sorts elements in Container.
@@ -801,7 +994,7 @@ namespace hltypes
 		{
 			if (this->size() > 0)
 			{
-				std::stable_sort(STD::begin(), STD::end(), compareFunction);
+				this->_sort(compareFunction, typename std::iterator_traits<iterator_t>::iterator_category());
 			}
 		}
 		/// @brief Unites elements of this Container with an element.
@@ -825,16 +1018,15 @@ namespace hltypes
 		/// @note Does not remove duplicates.
 		inline void intersect(const Container& other)
 		{
-			Container result;
-			int size = this->size();
-			for_iter (i, 0, size)
+			Container result(STD::get_allocator());
+			for (const_iterator_t it = STD::begin(); it != STD::end(); ++it)
 			{
-				if (other.has(this->at(i)))
+				if (other.has(*it))
 				{
-					result.add(this->at(i));
+					result.add(*it);
 				}
 			}
-			STD::assign(result.begin(), result.end());
+			STD::swap(static_cast<STD&>(result));
 		}
 		/// @brief Differentiates elements of this Container with an element.
 		/// @param[in] element Element to differentiate with.
@@ -842,16 +1034,7 @@ namespace hltypes
 		/// @note Does not remove duplicates.
 		inline void differentiate(const T& element)
 		{
-			int index = 0;
-			while (true)
-			{
-				index = this->indexOf(element);
-				if (index < 0)
-				{
-					break;
-				}
-				STD::erase(this->_itAdvance(STD::begin(), index));
-			}
+			this->removeAll(element);
 		}
 		/// @brief Differentiates elements of this Container with another one.
 		/// @param[in] other Container to differentiate with.
@@ -859,50 +1042,35 @@ namespace hltypes
 		/// @note Does not remove duplicates.
 		inline void differentiate(const Container& other)
 		{
-			int index = 0;
-			int size = other.size();
-			for_iter (i, 0, size)
-			{
-				while (true)
-				{
-					index = this->indexOf(other.at(i));
-					if (index < 0)
-					{
-						break;
-					}
-					STD::erase(this->_itAdvance(STD::begin(), index));
-				}
-			}
+			this->removeAll(other);
+		}
+		/// @brief Creates a lazy View of all elements.
+		/// @return A View of all elements.
+		/// @note Use it to chain where(), select(), take() and skip() without creating intermediate Containers.
+		/// @note The View must not be used after the Container has been modified or destroyed.
+		inline View<_ViewRange<const_iterator_t> > view() const
+		{
+			return View<_ViewRange<const_iterator_t> >(_ViewRange<const_iterator_t>(STD::begin(), STD::end(), this->size()));
 		}
 		/// @brief Joins all elements into a string.
 		/// @param[in] separator Separator string between elements.
 		/// @return String or joined elements separater by separator string.
 		/// @note Make sure your elements can be cast into String or are already String.
+		/// @note Strings and numbers in contiguous Containers are joined with String::join() which allocates the result only once.
 		inline String joined(const String& separator) const
 		{
-			String result;
-			int size = this->size();
-			if (size > 0)
-			{
-				result += String(this->at(0));
-				for_iter (i, 1, size)
-				{
-					result += separator + String(this->at(i));
-				}
-			}
-			return result;
+			return this->_joined(separator, std::integral_constant<bool, _ContiguousStorage<STD>::value && _StringJoinable<T>::value>());
 		}
 		/// @brief Finds and returns first occurrence of element that matches the condition.
 		/// @param[in] conditionFunction Function pointer with condition function that takes one element of type T and returns bool.
 		/// @return Pointer to element that matches the condition or NULL if no element was found.
 		inline T* findFirst(bool(*conditionFunction)(T const&))
 		{
-			int size = this->size();
-			for_iter (i, 0, size)
+			for (iterator_t it = STD::begin(); it != STD::end(); ++it)
 			{
-				if (conditionFunction(this->at(i)))
+				if (conditionFunction(*it))
 				{
-					return &this->at(i);
+					return &(*it);
 				}
 			}
 			return NULL;
@@ -912,12 +1080,11 @@ namespace hltypes
 		/// @return Pointer to element that matches the condition or NULL if no element was found.
 		inline const T* findFirst(bool (*conditionFunction)(T const&)) const
 		{
-			int size = this->size();
-			for_iter (i, 0, size)
+			for (const_iterator_t it = STD::begin(); it != STD::end(); ++it)
 			{
-				if (conditionFunction(this->at(i)))
+				if (conditionFunction(*it))
 				{
-					return &this->at(i);
+					return &(*it);
 				}
 			}
 			return NULL;
@@ -927,10 +1094,9 @@ namespace hltypes
 		/// @return True if at least one element matches the condition.
 		inline bool matchesAny(bool (*conditionFunction)(T const&)) const
 		{
-			int size = this->size();
-			for_iter (i, 0, size)
+			for (const_iterator_t it = STD::begin(); it != STD::end(); ++it)
 			{
-				if (conditionFunction(this->at(i)))
+				if (conditionFunction(*it))
 				{
 					return true;
 				}
@@ -942,10 +1108,9 @@ namespace hltypes
 		/// @return True if all elements match the condition.
 		inline bool matchesAll(bool (*conditionFunction)(T const&)) const
 		{
-			int size = this->size();
-			for_iter (i, 0, size)
+			for (const_iterator_t it = STD::begin(); it != STD::end(); ++it)
 			{
-				if (!conditionFunction(this->at(i)))
+				if (!conditionFunction(*it))
 				{
 					return false;
 				}
@@ -956,14 +1121,468 @@ namespace hltypes
 		/// @param[in] processFunction Function pointer with processing function for the elements.
 		inline void each(void (*processFunction)(T const&))
 		{
-			int size = this->size();
-			for_iter (i, 0, size)
+			for (const_iterator_t it = STD::begin(); it != STD::end(); ++it)
 			{
-				processFunction(this->at(i));
+				processFunction(*it);
 			}
 		}
 
 	protected:
+		/// @brief Whether the elements are arithmetic and stored contiguously so vectorized kernels from hsimd.h can be used.
+		typedef std::integral_constant<bool, _ContiguousStorage<STD>::value && std::is_arithmetic<T>::value && !std::is_same<T, bool>::value> _Vectorizable;
+
+		/// @brief Returns element at specified position for operator[].
+		/// @param[in] index Index of the element.
+		/// @return Element at specified position.
+		/// @note Negative indices are counted from the end.
+		/// @note The bounds are only checked if HLTYPES_CONTAINER_CHECKS is enabled.
+		inline T& _elementAt(int index)
+		{
+#if HLTYPES_CONTAINER_CHECKS
+			return this->at(index);
+#else
+			if (index < 0)
+			{
+				index += this->size();
+			}
+			return *this->_itAdvance(STD::begin(), index);
+#endif
+		}
+		/// @brief Returns element at specified position for operator[].
+		/// @param[in] index Index of the element.
+		/// @return Element at specified position.
+		/// @note Negative indices are counted from the end.
+		/// @note The bounds are only checked if HLTYPES_CONTAINER_CHECKS is enabled.
+		inline const T& _elementAt(int index) const
+		{
+#if HLTYPES_CONTAINER_CHECKS
+			return this->at(index);
+#else
+			if (index < 0)
+			{
+				index += this->size();
+			}
+			return *this->_itAdvance(STD::begin(), index);
+#endif
+		}
+		/// @brief Sorts elements in a Container with random access.
+		/// @param[in] compare Comparison callable.
+		template <typename C>
+		inline void _sort(C compare, std::random_access_iterator_tag)
+		{
+			std::stable_sort(STD::begin(), STD::end(), compare);
+		}
+		/// @brief Sorts elements in a Container without random access.
+		/// @param[in] compare Comparison callable.
+		/// @note Uses the stable merge sort of std::list.
+		template <typename C>
+		inline void _sort(C compare, std::bidirectional_iterator_tag)
+		{
+			STD::sort(compare);
+		}
+		/// @brief Randomizes order of elements in a Container with random access.
+		/// @note This implementation uses Fisher-Yates Shuffle.
+		inline void _randomize(std::random_access_iterator_tag)
+		{
+			iterator_t begin = STD::begin();
+			int j = 0;
+			for_iter_r (i, this->size(), 1)
+			{
+				j = hrand(i + 1);
+				if (i != j)
+				{
+					std::swap(begin[i], begin[j]);
+				}
+			}
+		}
+		/// @brief Randomizes order of elements in a Container without random access.
+		/// @note The elements are shuffled in a temporary std::vector.
+		inline void _randomize(std::bidirectional_iterator_tag)
+		{
+			std::vector<T> values(std::make_move_iterator(STD::begin()), std::make_move_iterator(STD::end()));
+			int j = 0;
+			for_iter_r (i, (int)values.size(), 1)
+			{
+				j = hrand(i + 1);
+				if (i != j)
+				{
+					std::swap(values[i], values[j]);
+				}
+			}
+			std::move(values.begin(), values.end(), STD::begin());
+		}
+
+		/// @brief Compares the contents of two Containers of the same size for being equal.
+		/// @param[in] other Another Container.
+		/// @return True if all pairs of elements at the same positions are equal.
+		inline bool _equals(const Container& other, std::false_type) const
+		{
+			const_iterator_t otherIt = other.begin();
+			for (const_iterator_t it = STD::begin(); it != STD::end(); ++it, ++otherIt)
+			{
+				// making sure operator== is used, not !=
+				if (!(*it == *otherIt))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+		/// @brief Compares the contents of two Containers of the same size for being equal.
+		/// @param[in] other Another Container.
+		/// @return True if all pairs of elements at the same positions are equal.
+		inline bool _equals(const Container& other, std::true_type) const
+		{
+			return (this->size() == 0 || _simdEquals(STD::data(), other.STD::data(), this->size()));
+		}
+		/// @brief Gets index of the given element.
+		/// @param[in] element Element to search for.
+		/// @return Index of the given element or -1 if element could not be found.
+		inline int _indexOf(const T& element, std::false_type) const
+		{
+			int i = 0;
+			for (const_iterator_t it = STD::begin(); it != STD::end(); ++it, ++i)
+			{
+				if (element == *it)
+				{
+					return i;
+				}
+			}
+			return -1;
+		}
+		/// @brief Gets index of the given element.
+		/// @param[in] element Element to search for.
+		/// @return Index of the given element or -1 if element could not be found.
+		inline int _indexOf(const T& element, std::true_type) const
+		{
+			return (this->size() > 0 ? _simdIndexOf(STD::data(), this->size(), element) : -1);
+		}
+		/// @brief Counts occurrences of element in Container.
+		/// @param[in] element Element to search for.
+		/// @return Number of occurrences of given element.
+		inline int _count(const T& element, std::false_type) const
+		{
+			int result = 0;
+			for (const_iterator_t it = STD::begin(); it != STD::end(); ++it)
+			{
+				if (element == *it)
+				{
+					++result;
+				}
+			}
+			return result;
+		}
+		/// @brief Counts occurrences of element in Container.
+		/// @param[in] element Element to search for.
+		/// @return Number of occurrences of given element.
+		inline int _count(const T& element, std::true_type) const
+		{
+			return (this->size() > 0 ? _simdCount(STD::data(), this->size(), element) : 0);
+		}
+		/// @brief Finds minimum and maximum element in a non-empty Container.
+		/// @return Pair of minimum and maximum element.
+		inline std::pair<T, T> _minMax(std::false_type) const
+		{
+			std::pair<T, T> result(*STD::begin(), *STD::begin());
+			for (const_iterator_t it = STD::begin(); it != STD::end(); ++it)
+			{
+				if (*it < result.first)
+				{
+					result.first = *it;
+				}
+				if (result.second < *it)
+				{
+					result.second = *it;
+				}
+			}
+			return result;
+		}
+		/// @brief Finds minimum and maximum element in a non-empty Container.
+		/// @return Pair of minimum and maximum element.
+		inline std::pair<T, T> _minMax(std::true_type) const
+		{
+			std::pair<T, T> result;
+			_simdMinMax(STD::data(), this->size(), result.first, result.second);
+			return result;
+		}
+		/// @brief Calculates the sum of all elements in Container.
+		/// @return Sum of all elements.
+		inline typename _SumType<T>::type _sum(std::false_type) const
+		{
+			typename _SumType<T>::type result = typename _SumType<T>::type();
+			for (const_iterator_t it = STD::begin(); it != STD::end(); ++it)
+			{
+				result += *it;
+			}
+			return result;
+		}
+		/// @brief Calculates the sum of all elements in Container.
+		/// @return Sum of all elements.
+		inline typename _SumType<T>::type _sum(std::true_type) const
+		{
+			return _simdSum(STD::data(), this->size());
+		}
+		/// @brief Joins all elements into a string by converting every element into a String.
+		/// @param[in] separator Separator string between elements.
+		/// @return String or joined elements separater by separator string.
+		inline String _joined(const String& separator, std::false_type) const
+		{
+			String result;
+			const_iterator_t it = STD::begin();
+			if (it != STD::end())
+			{
+				result += String(*it);
+				for (++it; it != STD::end(); ++it)
+				{
+					result += separator;
+					result += String(*it);
+				}
+			}
+			return result;
+		}
+		/// @brief Joins all elements into a string with String::join().
+		/// @param[in] separator Separator string between elements.
+		/// @return String or joined elements separater by separator string.
+		inline String _joined(const String& separator, std::true_type) const
+		{
+			return String::join(Span<const T>(STD::data(), this->size()), separator);
+		}
+		/// @brief Reserves memory for a number of elements.
+		/// @param[in] count Number of elements to reserve memory for.
+		/// @note Only available for std::vector based Containers.
+		inline void _reserve(int count)
+		{
+			STD::reserve(count);
+		}
+		/// @brief Gets the number of elements memory has been reserved for.
+		/// @return The number of elements memory has been reserved for.
+		/// @note Only available for std::vector based Containers.
+		inline int _capacity() const
+		{
+			return (int)STD::capacity();
+		}
+		/// @brief Gets the pointer to the contiguous elements.
+		/// @return Pointer to the first element.
+		/// @note Only available for Containers with contiguous storage.
+		inline T* _data()
+		{
+			return STD::data();
+		}
+		/// @brief Gets the pointer to the contiguous elements.
+		/// @return Pointer to the first element.
+		/// @note Only available for Containers with contiguous storage.
+		inline const T* _data() const
+		{
+			return STD::data();
+		}
+		/// @brief Releases reserved memory that is not used by any element.
+		/// @note Not available for std::list based Containers.
+		inline void _shrinkToFit()
+		{
+			STD::shrink_to_fit();
+		}
+		/// @brief Sorts elements in Container without preserving the order of equal elements.
+		/// @note The sorting order is ascending.
+		/// @note Not available for std::list based Containers.
+		inline void _sortUnstable()
+		{
+			if (this->size() > 0)
+			{
+				std::sort(STD::begin(), STD::end());
+			}
+		}
+		/// @brief Sorts elements in Container without preserving the order of equal elements.
+		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @note The sorting order is ascending.
+		/// @note compareFunction should return true if first element is less than the second element.
+		/// @note Not available for std::list based Containers.
+		inline void _sortUnstable(bool (*compareFunction)(T const&, T const&))
+		{
+			if (this->size() > 0)
+			{
+				std::sort(STD::begin(), STD::end(), compareFunction);
+			}
+		}
+		/// @brief Sorts only the first elements in Container.
+		/// @param[in] count Number of smallest elements that are moved to the front in sorted order.
+		/// @note The order of the remaining elements is unspecified.
+		/// @note Not available for std::list based Containers.
+		inline void _partialSort(int count)
+		{
+			int size = this->size();
+			if (count < 0 || count > size)
+			{
+				throw ContainerRangeException(0, count);
+			}
+			if (count > 0)
+			{
+				std::partial_sort(STD::begin(), this->_itAdvance(STD::begin(), count), STD::end());
+			}
+		}
+		/// @brief Sorts only the first elements in Container.
+		/// @param[in] count Number of smallest elements that are moved to the front in sorted order.
+		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @note The order of the remaining elements is unspecified.
+		/// @note compareFunction should return true if first element is less than the second element.
+		/// @note Not available for std::list based Containers.
+		inline void _partialSort(int count, bool (*compareFunction)(T const&, T const&))
+		{
+			int size = this->size();
+			if (count < 0 || count > size)
+			{
+				throw ContainerRangeException(0, count);
+			}
+			if (count > 0)
+			{
+				std::partial_sort(STD::begin(), this->_itAdvance(STD::begin(), count), STD::end(), compareFunction);
+			}
+		}
+		/// @brief Places the element that would be at the given index in a sorted Container at that index.
+		/// @param[in] index Index of the element.
+		/// @note All elements before index are not greater and all elements after index are not less than the element at index.
+		/// @note Not available for std::list based Containers.
+		inline void _nthElement(int index)
+		{
+			int size = this->size();
+			if (index < 0 || index >= size)
+			{
+				throw ContainerIndexException(index);
+			}
+			std::nth_element(STD::begin(), this->_itAdvance(STD::begin(), index), STD::end());
+		}
+		/// @brief Places the element that would be at the given index in a sorted Container at that index.
+		/// @param[in] index Index of the element.
+		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @note All elements before index are not greater and all elements after index are not less than the element at index.
+		/// @note compareFunction should return true if first element is less than the second element.
+		/// @note Not available for std::list based Containers.
+		inline void _nthElement(int index, bool (*compareFunction)(T const&, T const&))
+		{
+			int size = this->size();
+			if (index < 0 || index >= size)
+			{
+				throw ContainerIndexException(index);
+			}
+			std::nth_element(STD::begin(), this->_itAdvance(STD::begin(), index), STD::end(), compareFunction);
+		}
+		/// @brief Sorts arithmetic elements in Container using an LSD radix sort.
+		/// @note The sorting order is ascending.
+		/// @note The sort is stable and runs in linear time.
+		/// @note Only available for integral types, float and double.
+		inline void _radixSort()
+		{
+			static_assert(_RadixSortable<T>::value, "radix sort without a key function requires an integral type, float or double");
+			int size = this->size();
+			if (size < 2)
+			{
+				return;
+			}
+			std::vector<T> values(STD::begin(), STD::end());
+			Container<STD, T>::_radixSortValues(values, [](const T& value) { return _radixSortKey(value); }, (int)sizeof(T));
+			std::copy(values.begin(), values.end(), STD::begin());
+		}
+		/// @brief Sorts elements in Container using an LSD radix sort on a key.
+		/// @param[in] keyFunction Function pointer that takes an element of type T and returns its integral, float or double key.
+		/// @note The sorting order is ascending.
+		/// @note The sort is stable and runs in linear time.
+		template <typename K>
+		inline void _radixSort(K (*keyFunction)(T const&))
+		{
+			static_assert(_RadixSortable<K>::value, "radix sort keys have to be of an integral type, float or double");
+			int size = this->size();
+			if (size < 2)
+			{
+				return;
+			}
+			std::vector<std::pair<uint64_t, int> > keys(size);
+			int i = 0;
+			for (iterator_t it = STD::begin(); it != STD::end(); ++it, ++i)
+			{
+				keys[i].first = _radixSortKey((*keyFunction)(*it));
+				keys[i].second = i;
+			}
+			Container<STD, T>::_radixSortValues(keys, [](const std::pair<uint64_t, int>& key) { return key.first; }, (int)sizeof(K));
+			std::vector<T> values(std::make_move_iterator(STD::begin()), std::make_move_iterator(STD::end()));
+			iterator_t it = STD::begin();
+			for_iter (j, 0, size)
+			{
+				*it = std::move(values[keys[j].second]);
+				++it;
+			}
+		}
+		/// @brief Sorts a vector of values by their unsigned keys using byte-wise LSD radix passes.
+		/// @param[in,out] values The values.
+		/// @param[in] keyFunction Callable that returns the unsigned key of a value.
+		/// @param[in] keySize Number of significant bytes in the keys.
+		/// @note Passes in which all keys share the same byte are skipped.
+		template <typename V, typename F>
+		static inline void _radixSortValues(std::vector<V>& values, F keyFunction, int keySize)
+		{
+			int size = (int)values.size();
+			std::vector<int> histograms(keySize * 256, 0);
+			uint64_t key = 0;
+			for_iter (i, 0, size)
+			{
+				key = keyFunction(values[i]);
+				for_iter (b, 0, keySize)
+				{
+					++histograms[b * 256 + (int)((key >> (b * 8)) & 0xFF)];
+				}
+			}
+			std::vector<V> buffer(size);
+			V* source = &values[0];
+			V* destination = &buffer[0];
+			int* histogram = NULL;
+			int offsets[256];
+			int offset = 0;
+			int shift = 0;
+			for_iter (b, 0, keySize)
+			{
+				histogram = &histograms[b * 256];
+				shift = b * 8;
+				if (histogram[(keyFunction(source[0]) >> shift) & 0xFF] == size)
+				{
+					continue;
+				}
+				offset = 0;
+				for_iter (j, 0, 256)
+				{
+					offsets[j] = offset;
+					offset += histogram[j];
+				}
+				for_iter (i, 0, size)
+				{
+					destination[offsets[(keyFunction(source[i]) >> shift) & 0xFF]++] = source[i];
+				}
+				std::swap(source, destination);
+			}
+			if (source != &values[0])
+			{
+				values.swap(buffer);
+			}
+		}
+		/// @brief Creates an empty Container of type R that uses the allocator of this Container.
+		/// @return An empty Container.
+		/// @note Containers that cannot be constructed with the allocator are default-constructed.
+		template <typename R>
+		inline R _makeEmpty() const
+		{
+			return this->template _makeEmpty<R>(std::is_constructible<R, const typename STD::allocator_type&>());
+		}
+		/// @brief Creates an empty Container of type R that uses the allocator of this Container.
+		/// @return An empty Container.
+		template <typename R>
+		inline R _makeEmpty(std::true_type constructible) const
+		{
+			return R(STD::get_allocator());
+		}
+		/// @brief Creates an empty Container of type R.
+		/// @return An empty Container.
+		template <typename R>
+		inline R _makeEmpty(std::false_type constructible) const
+		{
+			return R();
+		}
 		/// @brief Gets all indices.
 		/// @return All indices.
 		template <typename R>
@@ -984,10 +1603,10 @@ namespace hltypes
 		inline R _indicesOf(const T& element) const
 		{
 			R result;
-			int size = this->size();
-			for_iter (i, 0, size)
+			int i = 0;
+			for (const_iterator_t it = STD::begin(); it != STD::end(); ++it, ++i)
 			{
-				if (element == this->at(i))
+				if (element == *it)
 				{
 					result.add(i);
 				}
@@ -1001,7 +1620,7 @@ namespace hltypes
 		template <typename R>
 		inline R _sub(int start, int count) const
 		{
-			R result;
+			R result = this->template _makeEmpty<R>();
 			if (count > 0)
 			{
 				int size = this->size();
@@ -1035,11 +1654,11 @@ namespace hltypes
 			{
 				throw ContainerRangeException(index, count);
 			}
-			R result;
+			R result = this->template _makeEmpty<R>();
 			iterator_t it = STD::begin();
 			iterator_t begin = this->_itAdvance(it, index);
 			iterator_t end = this->_itAdvance(it, index + count);
-			result.assign(begin, end);
+			result.assign(std::make_move_iterator(begin), std::make_move_iterator(end));
 			STD::erase(begin, end);
 			return result;
 		}
@@ -1054,10 +1673,10 @@ namespace hltypes
 			{
 				throw ContainerRangeException(0, count);
 			}
-			R result;
+			R result = this->template _makeEmpty<R>();
 			iterator_t begin = STD::begin();
 			iterator_t end = this->_itAdvance(begin, count);
-			result.assign(begin, end);
+			result.assign(std::make_move_iterator(begin), std::make_move_iterator(end));
 			STD::erase(begin, end);
 			return result;
 		}
@@ -1072,10 +1691,10 @@ namespace hltypes
 			{
 				throw ContainerRangeException(0, count);
 			}
-			R result;
+			R result = this->template _makeEmpty<R>();
 			iterator_t end = STD::end();
 			iterator_t begin = this->_itAdvance(end, -count);
-			result.assign(begin, end);
+			result.assign(std::make_move_iterator(begin), std::make_move_iterator(end));
 			STD::erase(begin, end);
 			return result;
 		}
@@ -1096,13 +1715,13 @@ namespace hltypes
 		template <typename R>
 		inline R _random(int count, bool unique = true) const
 		{
-			R result;
+			R result = this->template _makeEmpty<R>();
 			int size = this->size();
 			if (!unique)
 			{
 				for_iter (i, 0, count)
 				{
-					result.add(this->at(hrand(size)));
+					result.add(*this->_itAdvance(STD::begin(), hrand(size)));
 				}
 			}
 			else if (count > 0)
@@ -1122,7 +1741,7 @@ namespace hltypes
 				}
 				for_iter (i, 0, count)
 				{
-					result.add(this->at(indices.removeRandom()));
+					result.add(*this->_itAdvance(STD::begin(), indices.removeRandom()));
 				}
 			}
 			return result;
@@ -1167,6 +1786,52 @@ namespace hltypes
 			result.sort(compareFunction);
 			return result;
 		}
+		/// @brief Creates new Container with only the smallest elements in sorted order.
+		/// @param[in] count Number of elements.
+		/// @return A new Container.
+		/// @note The sorting order is ascending.
+		/// @note Only the resulting elements are copied.
+		/// @note Not available for std::list based Containers.
+		template <typename R>
+		inline R _partialSorted(int count) const
+		{
+			int size = this->size();
+			if (count < 0 || count > size)
+			{
+				throw ContainerRangeException(0, count);
+			}
+			R result = this->template _makeEmpty<R>();
+			result.insertAt(0, T(), count);
+			if (count > 0)
+			{
+				std::partial_sort_copy(STD::begin(), STD::end(), result.begin(), result.end());
+			}
+			return result;
+		}
+		/// @brief Creates new Container with only the smallest elements in sorted order.
+		/// @param[in] count Number of elements.
+		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @return A new Container.
+		/// @note The sorting order is ascending.
+		/// @note compareFunction should return true if first element is less than the second element.
+		/// @note Only the resulting elements are copied.
+		/// @note Not available for std::list based Containers.
+		template <typename R>
+		inline R _partialSorted(int count, bool (*compareFunction)(T const&, T const&)) const
+		{
+			int size = this->size();
+			if (count < 0 || count > size)
+			{
+				throw ContainerRangeException(0, count);
+			}
+			R result = this->template _makeEmpty<R>();
+			result.insertAt(0, T(), count);
+			if (count > 0)
+			{
+				std::partial_sort_copy(STD::begin(), STD::end(), result.begin(), result.end(), compareFunction);
+			}
+			return result;
+		}
 		/// @brief Creates a new Container with randomized order of elements.
 		/// @return A new Container.
 		template <typename R>
@@ -1241,10 +1906,9 @@ namespace hltypes
 		inline R _mapped(S (*generateFunction)(T const&)) const
 		{
 			R result;
-			int size = this->size();
-			for_iter (i, 0, size)
+			for (const_iterator_t it = STD::begin(); it != STD::end(); ++it)
 			{
-				result.add(generateFunction(this->at(i)));
+				result.add(generateFunction(*it));
 			}
 			return result;
 		}
@@ -1254,13 +1918,12 @@ namespace hltypes
 		template <typename R>
 		inline R _findAll(bool (*conditionFunction)(T const&)) const
 		{
-			R result;
-			int size = this->size();
-			for_iter (i, 0, size)
+			R result = this->template _makeEmpty<R>();
+			for (const_iterator_t it = STD::begin(); it != STD::end(); ++it)
 			{
-				if (conditionFunction(this->at(i)))
+				if (conditionFunction(*it))
 				{
-					result.add(this->at(i));
+					result.add(*it);
 				}
 			}
 			return result;
@@ -1272,10 +1935,9 @@ namespace hltypes
 		inline R _cast() const
 		{
 			R result;
-			int size = this->size();
-			for_iter (i, 0, size)
+			for (const_iterator_t it = STD::begin(); it != STD::end(); ++it)
 			{
-				result.add((S)this->at(i));
+				result.add((S)(*it));
 			}
 			return result;
 		}
@@ -1288,11 +1950,10 @@ namespace hltypes
 		{
 			R result;
 			S value;
-			int size = this->size();
-			for_iter (i, 0, size)
+			for (const_iterator_t it = STD::begin(); it != STD::end(); ++it)
 			{
 				// when seeing "dynamic_cast", I always think of fireballs
-				value = dynamic_cast<S>(this->at(i));
+				value = dynamic_cast<S>(*it);
 				if (value != NULL || includeNulls)
 				{
 					result.add(value);
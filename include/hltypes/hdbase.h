@@ -19,7 +19,7 @@
 
 namespace hltypes
 {
-	template <typename T> class Array;
+	template <typename T, typename A> class Array;
 
 	/// @brief Provides high level directory handling.
 	class hltypesExport DirBase
@@ -0,0 +1,175 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+///
+/// @section DESCRIPTION
+///
+/// Provides on-the-fly compression of data written to another stream.
+
+#ifdef _ZIPRESOURCE
+#ifndef HLTYPES_DEFLATE_STREAM_H
+#define HLTYPES_DEFLATE_STREAM_H
+
+#include <stdint.h>
+
+#include "henum.h"
+#include "hltypesExport.h"
+#include "hltypesUtil.h"
+#include "hsbase.h"
+#include "hstring.h"
+
+#define DEFAULT_DEFLATE_LEVEL 6
+#define DEFAULT_DEFLATE_BUFFER_SIZE 65536
+
+namespace hltypes
+{
+	/// @brief Provides on-the-fly compression of data written to another stream.
+	/// @note Data is compressed in small steps and only a buffer of fixed size is kept in memory.
+	/// @note Only writing is supported. Seeking is only possible to the current position.
+	/// @note Only available in builds with _ZIPRESOURCE since that is when miniz is built.
+	class hltypesExport DeflateStream : public StreamBase
+	{
+	public:
+		/// @class Format
+		/// @brief Defines the framing around the compressed data.
+		HL_ENUM_CLASS_PREFIX_DECLARE(hltypesExport, Format,
+		(
+			/// @var static const Format Format::Zlib
+			/// @brief zlib header and Adler-32 checksum.
+			HL_ENUM_DECLARE(Format, Zlib);
+			/// @var static const Format Format::Gzip
+			/// @brief gzip header and CRC-32 checksum, compatible with .gz files.
+			HL_ENUM_DECLARE(Format, Gzip);
+			/// @var static const Format Format::Raw
+			/// @brief No header and no checksum.
+			HL_ENUM_DECLARE(Format, Raw);
+		));
+
+		/// @class Strategy
+		/// @brief Defines compression strategies.
+		HL_ENUM_CLASS_PREFIX_DECLARE(hltypesExport, Strategy,
+		(
+			/// @var static const Strategy Strategy::Default
+			/// @brief Works best for most data.
+			HL_ENUM_DECLARE(Strategy, Default);
+			/// @var static const Strategy Strategy::Filtered
+			/// @brief For data with many small values in random order.
+			HL_ENUM_DECLARE(Strategy, Filtered);
+			/// @var static const Strategy Strategy::HuffmanOnly
+			/// @brief No matching of repeated data at all.
+			HL_ENUM_DECLARE(Strategy, HuffmanOnly);
+			/// @var static const Strategy Strategy::Rle
+			/// @brief Only matches runs of the same byte. Very fast.
+			HL_ENUM_DECLARE(Strategy, Rle);
+			/// @var static const Strategy Strategy::Fixed
+			/// @brief Does not create dynamic Huffman codes.
+			HL_ENUM_DECLARE(Strategy, Fixed);
+		));
+
+		/// @brief Constructor.
+		/// @param[in] stream The stream where compressed data is written.
+		/// @param[in] format Framing around the compressed data.
+		/// @param[in] level Compression level from 0 (no compression) to 9 (best compression).
+		/// @param[in] strategy Compression strategy.
+		/// @param[in] bufferSize Size of the buffer for compressed data.
+		/// @note The other stream has to stay valid until finish() is called or this DeflateStream is destroyed.
+		DeflateStream(StreamBase& stream, Format format = Format::Zlib, int level = DEFAULT_DEFLATE_LEVEL, Strategy strategy = Strategy::Default, int bufferSize = DEFAULT_DEFLATE_BUFFER_SIZE);
+		/// @brief Destructor.
+		/// @note Calls finish() if it has not been called yet. Errors are only logged, call finish() explicitly to handle them.
+		~DeflateStream();
+		/// @brief Gets the framing around the compressed data.
+		/// @return The framing around the compressed data.
+		HL_DEFINE_GET(Format, format, Format);
+		/// @brief Gets the compression level.
+		/// @return The compression level.
+		HL_DEFINE_GET(int, level, Level);
+		/// @brief Gets the compression strategy.
+		/// @return The compression strategy.
+		HL_DEFINE_GET(Strategy, strategy, Strategy);
+		/// @brief Gets the number of compressed bytes written to the other stream so far.
+		/// @return The number of compressed bytes written to the other stream so far.
+		HL_DEFINE_GET(int64_t, compressedSize, CompressedSize);
+
+		/// @brief Writes all data that was compressed so far to the other stream.
+		/// @note Decompressing the written data gives back everything that was written until now.
+		/// @note Flushing too often makes the compression worse.
+		void flush();
+		/// @brief Writes the rest of the compressed data and the checksum to the other stream.
+		/// @note The DeflateStream is closed afterwards, even if an exception is thrown.
+		void finish();
+
+	protected:
+		/// @brief The stream where compressed data is written.
+		StreamBase& stream;
+		/// @brief Framing around the compressed data.
+		Format format;
+		/// @brief Compression level.
+		int level;
+		/// @brief Compression strategy.
+		Strategy strategy;
+		/// @brief Size of the buffer for compressed data.
+		int bufferSize;
+		/// @brief Buffer for compressed data.
+		unsigned char* buffer;
+		/// @brief The miniz compressor.
+		void* zStream;
+		/// @brief CRC-32 of the uncompressed data for gzip.
+		unsigned int crc;
+		/// @brief Number of compressed bytes written to the other stream.
+		int64_t compressedSize;
+
+		/// @brief Gets special descriptor.
+		/// @return Special descriptor.
+		String _descriptor() const override;
+		/// @brief Updates internal data size.
+		/// @note The data size is already kept up to date by every write so this does nothing.
+		void _updateDataSize() override;
+		/// @brief Compresses the pending data and writes it to the other stream.
+		/// @param[in] flush The miniz flush mode.
+		void _deflate(int flush);
+		/// @brief Frees the miniz compressor and the buffer.
+		void _close();
+
+		/// @brief Always throws an exception since compressed streams cannot be read.
+		/// @param[in] buffer Destination data buffer.
+		/// @param[in] count Number of elements to read.
+		/// @return Number of bytes read.
+		int _read(void* buffer, int count) override;
+		/// @brief Compresses data and writes it to the other stream.
+		/// @param[in] buffer Source data buffer.
+		/// @param[in] count Number of elements contained in buffer.
+		/// @return Number of bytes written.
+		int _write(const void* buffer, int count) override;
+		/// @brief Checks if the DeflateStream is open.
+		/// @return True if finish() has not been called yet.
+		bool _isOpen() const override;
+		/// @brief Gets the number of uncompressed bytes written so far.
+		/// @return The number of uncompressed bytes written so far.
+		int64_t _position() const override;
+		/// @brief Seeks to position.
+		/// @param[in] offset Seeking offset in bytes.
+		/// @param[in] seekMode Seeking mode.
+		/// @return True if the position would not change.
+		bool _seek(int64_t offset, SeekMode seekMode = SeekMode::Current) override;
+
+	private:
+		/// @brief Copy constructor.
+		/// @note Usage is not allowed and it will throw an exception.
+		DeflateStream(const DeflateStream& other);
+		/// @brief Assignment operator.
+		/// @note Usage is not allowed and it will throw an exception.
+		DeflateStream& operator=(DeflateStream& other);
+
+	};
+}
+
+/// @brief Alias for simpler code.
+typedef hltypes::DeflateStream hdeflatestream;
+
+#endif
+#endif
+
@@ -32,55 +32,68 @@
 namespace hltypes
 {
 	/// @brief Encapsulates std::deque and adds high level methods.
-	template <typename T>
-	class Deque : public Container<std::deque<T>, T>
+	template <typename T, typename A = std::allocator<T> >
+	class Deque : public Container<std::deque<T, A>, T>
 	{
 	public:
 		/// @brief Empty constructor.
 		inline Deque() :
-			Container<std::deque<T>, T>()
+			Container<std::deque<T, A>, T>()
+		{
+		}
+		/// @brief Constructor with allocator.
+		/// @param[in] allocator Allocator used for the elements.
+		inline explicit Deque(const A& allocator) :
+			Container<std::deque<T, A>, T>(allocator)
 		{
 		}
 		/// @brief Copy constructor.
 		/// @param[in] other Container to copy.
-		inline Deque(const Container<std::deque<T>, T>& other) :
-			Container<std::deque<T>, T>(other)
+		inline Deque(const Container<std::deque<T, A>, T>& other) :
+			Container<std::deque<T, A>, T>(other)
+		{
+		}
+		/// @brief Move constructor.
+		/// @param[in] other Container to move.
+		/// @note other is left empty.
+		inline Deque(Container<std::deque<T, A>, T>&& other) :
+			Container<std::deque<T, A>, T>(std::move(other))
 		{
 		}
 		/// @brief Constructor from single element.
 		/// @param[in] element Element to insert.
 		/// @note The explicit prevents "var = element" from working.
 		inline explicit Deque(const T& element) :
-			Container<std::deque<T>, T>(element)
+			Container<std::deque<T, A>, T>(element)
 		{
 		}
 		/// @brief Constructor from single element.
 		/// @param[in] element Element to insert.
 		/// @param[in] times Number of times to insert element.
 		inline Deque(const T& element, int times) :
-			Container<std::deque<T>, T>(element, times)
+			Container<std::deque<T, A>, T>(element, times)
 		{
 		}
 		/// @brief Constructor from another Container.
 		/// @param[in] other Container to copy.
 		/// @param[in] count Number of elements to copy.
-		inline Deque(const Container<std::deque<T>, T>& other, const int count) :
-			Container<std::deque<T>, T>(other, count)
+		inline Deque(const Container<std::deque<T, A>, T>& other, const int count) :
+			Container<std::deque<T, A>, T>(other, count)
 		{
 		}
 		/// @brief Constructor from another Container.
 		/// @param[in] other Container to copy.
 		/// @param[in] start Start index of elements to copy.
 		/// @param[in] count Number of elements to copy.
-		inline Deque(const Container<std::deque<T>, T>& other, const int start, const int count) :
-			Container<std::deque<T>, T>(other, start, count)
+		inline Deque(const Container<std::deque<T, A>, T>& other, const int start, const int count) :
+			Container<std::deque<T, A>, T>(other, start, count)
 		{
 		}
 		/// @brief Constructor from C-type array.
 		/// @param[in] other C-type array to copy.
 		/// @param[in] count Number of elements to copy.
 		inline Deque(const T other[], const int count) :
-			Container<std::deque<T>, T>(other, count)
+			Container<std::deque<T, A>, T>(other, count)
 		{
 		}
 		/// @brief Constructor from C-type array.
@@ -88,8 +101,72 @@ namespace hltypes
 		/// @param[in] start Start index of elements to copy.
 		/// @param[in] count Number of elements to copy.
 		inline Deque(const T other[], const int start, const int count) :
-			Container<std::deque<T>, T>(other, start, count)
+			Container<std::deque<T, A>, T>(other, start, count)
+		{
+		}
+		/// @brief Sorts elements in Deque without preserving the order of equal elements.
+		/// @note The sorting order is ascending.
+		/// @note Faster than sort() and does not need a temporary buffer.
+		inline void sortUnstable()
+		{
+			this->_sortUnstable();
+		}
+		/// @brief Sorts elements in Deque without preserving the order of equal elements.
+		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @note The sorting order is ascending.
+		/// @note compareFunction should return true if first element is less than the second element.
+		inline void sortUnstable(bool (*compareFunction)(T const&, T const&))
+		{
+			this->_sortUnstable(compareFunction);
+		}
+		/// @brief Sorts only the first elements in Deque.
+		/// @param[in] count Number of smallest elements that are moved to the front in sorted order.
+		/// @note The order of the remaining elements is unspecified.
+		inline void partialSort(int count)
+		{
+			this->_partialSort(count);
+		}
+		/// @brief Sorts only the first elements in Deque.
+		/// @param[in] count Number of smallest elements that are moved to the front in sorted order.
+		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @note The order of the remaining elements is unspecified.
+		/// @note compareFunction should return true if first element is less than the second element.
+		inline void partialSort(int count, bool (*compareFunction)(T const&, T const&))
+		{
+			this->_partialSort(count, compareFunction);
+		}
+		/// @brief Places the element that would be at the given index in a sorted Deque at that index.
+		/// @param[in] index Index of the element.
+		/// @note All elements before index are not greater and all elements after index are not less than the element at index.
+		inline void nthElement(int index)
+		{
+			this->_nthElement(index);
+		}
+		/// @brief Places the element that would be at the given index in a sorted Deque at that index.
+		/// @param[in] index Index of the element.
+		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @note All elements before index are not greater and all elements after index are not less than the element at index.
+		/// @note compareFunction should return true if first element is less than the second element.
+		inline void nthElement(int index, bool (*compareFunction)(T const&, T const&))
+		{
+			this->_nthElement(index, compareFunction);
+		}
+		/// @brief Sorts elements in Deque using an LSD radix sort.
+		/// @note The sorting order is ascending.
+		/// @note The sort is stable and runs in linear time.
+		/// @note Only available for integral types, float and double.
+		inline void radixSort()
 		{
+			this->_radixSort();
+		}
+		/// @brief Sorts elements in Deque using an LSD radix sort on a key.
+		/// @param[in] keyFunction Function pointer that takes an element of type T and returns its integral, float or double key.
+		/// @note The sorting order is ascending.
+		/// @note The sort is stable and runs in linear time.
+		template <typename K>
+		inline void radixSort(K (*keyFunction)(T const&))
+		{
+			this->_radixSort(keyFunction);
 		}
 		/// @brief Gets all indices.
 		/// @return All indices.
@@ -109,147 +186,167 @@ namespace hltypes
 		/// @return The removed element.
 		inline T removeAt(int index)
 		{
-			return Container<std::deque<T>, T>::removeAt(index);
+			return Container<std::deque<T, A>, T>::removeAt(index);
 		}
 		/// @brief Removes n elements at given index of Deque.
 		/// @param[in] index Start index of elements to remove.
 		/// @param[in] count Number of elements to remove.
 		/// @return Deque of all removed elements.
 		/// @note Elements in the returned Deque are in the same order as in the orignal Deque.
-		inline Deque<T> removeAt(int index, int count)
+		inline Deque<T, A> removeAt(int index, int count)
 		{
-			return this->template _removeAt<Deque<T> >(index, count);
+			return this->template _removeAt<Deque<T, A> >(index, count);
 		}
 		/// @brief Removes first element of Deque.
 		/// @return The removed element.
 		inline T removeFirst()
 		{
-			return Container<std::deque<T>, T>::removeFirst();
+			return Container<std::deque<T, A>, T>::removeFirst();
 		}
 		/// @brief Removes n elements from the beginning of Deque.
 		/// @param[in] count Number of elements to remove.
 		/// @return Deque of all removed elements.
 		/// @note Elements in the returned Deque are in the same order as in the orignal Deque.
-		inline Deque<T> removeFirst(const int count)
+		inline Deque<T, A> removeFirst(const int count)
 		{
-			return this->template _removeFirst<Deque<T> >(count);
+			return this->template _removeFirst<Deque<T, A> >(count);
 		}
 		/// @brief Removes last element of Deque.
 		/// @return The removed element.
 		inline T removeLast()
 		{
-			return Container<std::deque<T>, T>::removeLast();
+			return Container<std::deque<T, A>, T>::removeLast();
 		}
 		/// @brief Removes n elements from the end of Deque.
 		/// @param[in] count Number of elements to remove.
 		/// @return Deque of all removed elements.
 		/// @note Elements in the returned Deque are in the same order as in the orignal Deque.
-		inline Deque<T> removeLast(const int count)
+		inline Deque<T, A> removeLast(const int count)
 		{
-			return this->template _removeLast<Deque<T> >(count);
+			return this->template _removeLast<Deque<T, A> >(count);
 		}
 		/// @brief Gets a random element in Deque and removes it.
 		/// @return Random element.
 		inline T removeRandom()
 		{
-			return Container<std::deque<T>, T>::removeRandom();
+			return Container<std::deque<T, A>, T>::removeRandom();
 		}
 		/// @brief Gets an Deque of random elements selected from this one and removes them.
 		/// @param[in] count Number of random elements.
 		/// @return Deque of random elements selected from this one.
-		inline Deque<T> removeRandom(const int count)
+		inline Deque<T, A> removeRandom(const int count)
 		{
-			return this->template _removeRandom<Deque<T> >(count);
+			return this->template _removeRandom<Deque<T, A> >(count);
 		}
 		/// @brief Gets a random element in Deque.
 		/// @return Random element.
 		inline T random() const
 		{
-			return Container<std::deque<T>, T>::random();
+			return Container<std::deque<T, A>, T>::random();
 		}
 		/// @brief Gets an Deque of random elements selected from this one.
 		/// @param[in] count Number of random elements.
 		/// @param[in] unique Whether to force all random values to be at unique positions.
 		/// @return Deque of random elements selected from this one.
-		inline Deque<T> random(int count, bool unique = true) const
+		inline Deque<T, A> random(int count, bool unique = true) const
 		{
-			return this->template _random<Deque<T> >(count, unique);
+			return this->template _random<Deque<T, A> >(count, unique);
 		}
 		/// @brief Creates new Deque with reversed order of elements.
 		/// @return A new Deque.
-		inline Deque<T> reversed() const
+		inline Deque<T, A> reversed() const
 		{
-			return this->template _reversed<Deque<T> >();
+			return this->template _reversed<Deque<T, A> >();
 		}
 		/// @brief Creates new Deque without duplicates.
 		/// @return A new Deque.
-		inline Deque<T> removedDuplicates() const
+		inline Deque<T, A> removedDuplicates() const
 		{
-			return this->template _removedDuplicates<Deque<T> >();
+			return this->template _removedDuplicates<Deque<T, A> >();
 		}
 		/// @brief Creates new sorted Deque.
 		/// @return A new Deque.
 		/// @note The sorting order is ascending.
-		inline Deque<T> sorted() const
+		inline Deque<T, A> sorted() const
 		{
-			return this->template _sorted<Deque<T> >();
+			return this->template _sorted<Deque<T, A> >();
 		}
 		/// @brief Creates new sorted Deque.
 		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
 		/// @return A new Deque.
 		/// @note The sorting order is ascending.
 		/// @note compareFunction should return true if first element is less than the second element.
-		inline Deque<T> sorted(bool (*compareFunction)(T const&, T const&)) const
+		inline Deque<T, A> sorted(bool (*compareFunction)(T const&, T const&)) const
+		{
+			return this->template _sorted<Deque<T, A> >(compareFunction);
+		}
+		/// @brief Creates new Deque with only the smallest elements in sorted order.
+		/// @param[in] count Number of elements.
+		/// @return A new Deque.
+		/// @note The sorting order is ascending.
+		/// @note Unlike sorted(), only the resulting elements are copied.
+		inline Deque<T, A> partialSorted(int count) const
 		{
-			return this->template _sorted<Deque<T> >(compareFunction);
+			return this->template _partialSorted<Deque<T, A> >(count);
+		}
+		/// @brief Creates new Deque with only the smallest elements in sorted order.
+		/// @param[in] count Number of elements.
+		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @return A new Deque.
+		/// @note The sorting order is ascending.
+		/// @note compareFunction should return true if first element is less than the second element.
+		/// @note Unlike sorted(), only the resulting elements are copied.
+		inline Deque<T, A> partialSorted(int count, bool (*compareFunction)(T const&, T const&)) const
+		{
+			return this->template _partialSorted<Deque<T, A> >(count, compareFunction);
 		}
 		/// @brief Creates a new Deque with randomized order of elements.
 		/// @return A new Deque.
-		inline Deque<T> randomized() const
+		inline Deque<T, A> randomized() const
 		{
-			return this->template _randomized<Deque<T> >();
+			return this->template _randomized<Deque<T, A> >();
 		}
 		/// @brief Creates a new Deque as union of this Deque with an element.
 		/// @param[in] element Element to unite with.
 		/// @return A new Deque.
 		/// @note Removes duplicates.
-		inline Deque<T> united(const T& element) const
+		inline Deque<T, A> united(const T& element) const
 		{
-			return this->template _united<Deque<T> >(element);
+			return this->template _united<Deque<T, A> >(element);
 		}
 		/// @brief Creates a new Deque as union of this Deque with another one.
 		/// @param[in] other Deque to unite with.
 		/// @return A new Deque.
 		/// @note Removes duplicates.
-		inline Deque<T> united(const Deque<T>& other) const
+		inline Deque<T, A> united(const Deque<T, A>& other) const
 		{
-			return this->template _united<Deque<T> >(other);
+			return this->template _united<Deque<T, A> >(other);
 		}
 		/// @brief Creates a new Deque as intersection of this Deque with another one.
 		/// @param[in] other Deque to intersect with.
 		/// @return A new Deque.
 		/// @note Does not remove duplicates.
-		inline Deque<T> intersected(const Deque<T>& other) const
+		inline Deque<T, A> intersected(const Deque<T, A>& other) const
 		{
-			return this->template _intersected<Deque<T> >(other);
+			return this->template _intersected<Deque<T, A> >(other);
 		}
 		/// @brief Creates a new Deque as difference of this Deque with an element.
 		/// @param[in] element Element to differentiate with.
 		/// @return A new Deque.
 		/// @note Unlike remove, this method ignores if the element is not in this Deque.
 		/// @note Does not remove duplicates.
-		inline Deque<T> differentiated(const T& element) const
+		inline Deque<T, A> differentiated(const T& element) const
 		{
-			return this->template _differentiated<Deque<T> >(element);
+			return this->template _differentiated<Deque<T, A> >(element);
 		}
 		/// @brief Creates a new Deque as difference of this Deque with another one.
 		/// @param[in] other Deque to differentiate with.
 		/// @return A new Deque.
 		/// @note Unlike remove, this method ignore elements of other Deque that are not in this one.
 		/// @note Does not remove duplicates.
-		inline Deque<T> differentiated(const Deque<T>& other) const
+		inline Deque<T, A> differentiated(const Deque<T, A>& other) const
 		{
-			return this->template _differentiated<Deque<T> >(other);
+			return this->template _differentiated<Deque<T, A> >(other);
 		}
 		/// @brief Creates new Deque with new elements obtained from the current Deque elements.
 		/// @param[in] generateFunction Function pointer with generation function for the new elements.
@@ -262,9 +359,9 @@ namespace hltypes
 		/// @brief Finds and returns new Deque of elements that match the condition.
 		/// @param[in] conditionFunction Function pointer with condition function that takes one element of type T and returns bool.
 		/// @return New Deque with all matching elements.
-		inline Deque<T> findAll(bool (*conditionFunction)(T const&)) const
+		inline Deque<T, A> findAll(bool (*conditionFunction)(T const&)) const
 		{
-			return this->template _findAll<Deque<T> >(conditionFunction);
+			return this->template _findAll<Deque<T, A> >(conditionFunction);
 		}
 		/// @brief Returns a new Deque with all elements cast into type S.
 		/// @return A new Deque with all elements cast into type S.
@@ -287,111 +384,134 @@ namespace hltypes
 		/// @param[in] index Index of the element.
 		/// @return Element at specified position.
 		/// @note Does not work with bool as T.
+		/// @note The bounds are only checked if HLTYPES_CONTAINER_CHECKS is enabled.
 		inline T& operator[](int index)
 		{
-			return this->at(index);
+			return this->_elementAt(index);
 		}
 		/// @brief Returns element at specified position.
 		/// @param[in] index Index of the element.
 		/// @return Element at specified position.
 		/// @note Does not work with bool as T.
+		/// @note The bounds are only checked if HLTYPES_CONTAINER_CHECKS is enabled.
 		inline const T& operator[](int index) const
 		{
-			return this->at(index);
+			return this->_elementAt(index);
 		}
 		/// @brief Returns a subdeque.
 		/// @param[in] start Start index of the elements to copy.
 		/// @param[in] count Number of elements to copy.
 		/// @return Subdeque created from the current Deque.
-		inline Deque<T> operator()(int start, const int count) const
+		inline Deque<T, A> operator()(int start, const int count) const
 		{
-			return this->template _sub<Deque<T> >(start, count);
+			return this->template _sub<Deque<T, A> >(start, count);
 		}
 		/// @brief Same as equals.
 		/// @see equals
-		inline bool operator==(const Deque<T>& other) const
+		inline bool operator==(const Deque<T, A>& other) const
 		{
 			return this->equals(other);
 		}
 		/// @brief Same as nequals.
 		/// @see nequals
-		inline bool operator!=(const Deque<T>& other) const
+		inline bool operator!=(const Deque<T, A>& other) const
 		{
 			return this->nequals(other);
 		}
 		/// @brief Same as add.
 		/// @see add(const T& element)
-		inline Deque<T>& operator<<(const T& element)
+		inline Deque<T, A>& operator<<(const T& element)
 		{
 			this->add(element);
 			return (*this);
 		}
 		/// @brief Same as add.
-		/// @see add(const Deque<T>& other)
-		inline Deque<T>& operator<<(const Deque<T>& other)
+		/// @see add(T&& element)
+		inline Deque<T, A>& operator<<(T&& element)
+		{
+			this->add(std::move(element));
+			return (*this);
+		}
+		/// @brief Same as add.
+		/// @see add(const Deque<T, A>& other)
+		inline Deque<T, A>& operator<<(const Deque<T, A>& other)
 		{
 			this->add(other);
 			return (*this);
 		}
 		/// @brief Same as add.
 		/// @see add(const T& element)
-		inline Deque<T>& operator+=(const T& element)
+		inline Deque<T, A>& operator+=(const T& element)
 		{
 			this->add(element);
 			return (*this);
 		}
 		/// @brief Same as add.
-		/// @see add(const Deque<T>& other)
-		inline Deque<T>& operator+=(const Deque<T>& other)
+		/// @see add(T&& element)
+		inline Deque<T, A>& operator+=(T&& element)
+		{
+			this->add(std::move(element));
+			return (*this);
+		}
+		/// @brief Same as add.
+		/// @see add(const Deque<T, A>& other)
+		inline Deque<T, A>& operator+=(const Deque<T, A>& other)
 		{
 			this->add(other);
 			return (*this);
 		}
+		/// @brief Same as add.
+		/// @see add(Container&& other)
+		inline Deque<T, A>& operator+=(Deque<T, A>&& other)
+		{
+			this->add(std::move(other));
+			return (*this);
+		}
 		/// @brief Same as remove.
 		/// @see remove(T element)
-		inline Deque<T>& operator-=(T element)
+		inline Deque<T, A>& operator-=(T element)
 		{
 			this->remove(element);
 			return (*this);
 		}
 		/// @brief Same as remove.
-		/// @see remove(const Deque<T>& other)
-		inline Deque<T>& operator-=(const Deque<T>& other)
+		/// @see remove(const Deque<T, A>& other)
+		inline Deque<T, A>& operator-=(const Deque<T, A>& other)
 		{
 			this->remove(other);
 			return (*this);
 		}
 		/// @brief Same as unite.
 		/// @see unite(const T& element)
-		inline Deque<T>& operator|=(const T& element)
+		inline Deque<T, A>& operator|=(const T& element)
 		{
 			this->unite(element);
 			return (*this);
 		}
 		/// @brief Same as unite.
-		/// @see unite(const Deque<T>& other)
-		inline Deque<T>& operator|=(const Deque<T>& other)
+		/// @see unite(const Deque<T, A>& other)
+		inline Deque<T, A>& operator|=(const Deque<T, A>& other)
 		{
 			this->unite(other);
 			return (*this);
 		}
 		/// @brief Same as intersect.
-		/// @see intersect(const Deque<T>& other)
-		inline Deque<T>& operator&=(const Deque<T>& other)
+		/// @see intersect(const Deque<T, A>& other)
+		inline Deque<T, A>& operator&=(const Deque<T, A>& other)
 		{
 			this->intersect(other);
 			return (*this);
 		}
 		/// @brief Same as differentiate.
 		/// @see differentiate(const T& element)
-		inline Deque<T>& operator/=(const T& element)
+		inline Deque<T, A>& operator/=(const T& element)
 		{
 			this->differentiate(element);
 			return (*this);
 		}
 		/// @brief Same as differentiate.
-		/// @see differentiate(const Deque<T>& other)
-		inline Deque<T>& operator/=(const Deque<T>& other)
+		/// @see differentiate(const Deque<T, A>& other)
+		inline Deque<T, A>& operator/=(const Deque<T, A>& other)
 		{
 			this->differentiate(other);
 			return (*this);
@@ -399,66 +519,66 @@ namespace hltypes
 		/// @brief Merges a Deque with an element.
 		/// @param[in] element Element to merge with.
 		/// @return New Deque with element added at the end of Deque.
-		inline Deque<T> operator+(const T& element) const
+		inline Deque<T, A> operator+(const T& element) const
 		{
-			Deque<T> result(*this);
+			Deque<T, A> result(*this);
 			result += element;
 			return result;
 		}
 		/// @brief Merges two Deques.
 		/// @param[in] other Second Deque to merge with.
 		/// @return New Deque with elements of second Deque added at the end of first Deque.
-		inline Deque<T> operator+(const Deque<T>& other) const
+		inline Deque<T, A> operator+(const Deque<T, A>& other) const
 		{
-			Deque<T> result(*this);
+			Deque<T, A> result(*this);
 			result += other;
 			return result;
 		}
 		/// @brief Removes element from Deque.
 		/// @param[in] element Element to remove.
 		/// @return New Deque with elements of first Deque without given element.
-		inline Deque<T> operator-(T element) const
+		inline Deque<T, A> operator-(T element) const
 		{
-			Deque<T> result(*this);
+			Deque<T, A> result(*this);
 			result -= element;
 			return result;
 		}
 		/// @brief Removes second Deque from first Deque.
 		/// @param[in] other Deque to remove.
 		/// @return New Deque with elements of first Deque without the elements of second Deque.
-		inline Deque<T> operator-(const Deque<T>& other) const
+		inline Deque<T, A> operator-(const Deque<T, A>& other) const
 		{
-			Deque<T> result(*this);
+			Deque<T, A> result(*this);
 			result -= other;
 			return result;
 		}
 		/// @brief Same as united.
 		/// @see united(const T& element)
-		inline Deque<T> operator|(const T& element) const
+		inline Deque<T, A> operator|(const T& element) const
 		{
 			return this->united(element);
 		}
 		/// @brief Same as united.
-		/// @see united(const Deque<T>& other)
-		inline Deque<T> operator|(const Deque<T>& other) const
+		/// @see united(const Deque<T, A>& other)
+		inline Deque<T, A> operator|(const Deque<T, A>& other) const
 		{
 			return this->united(other);
 		}
 		/// @brief Same as intersected.
-		/// @see intersected(const Deque<T>& other)
-		inline Deque<T> operator&(const Deque<T>& other) const
+		/// @see intersected(const Deque<T, A>& other)
+		inline Deque<T, A> operator&(const Deque<T, A>& other) const
 		{
 			return this->intersected(other);
 		}
 		/// @brief Same as differentiated.
 		/// @see differentiated(const T& element)
-		inline Deque<T> operator/(const T& element) const
+		inline Deque<T, A> operator/(const T& element) const
 		{
 			return this->differentiated(element);
 		}
 		/// @brief Same as differentiated.
-		/// @see differentiated(const Deque<T>& other)
-		inline Deque<T> operator/(const Deque<T>& other) const
+		/// @see differentiated(const Deque<T, A>& other)
+		inline Deque<T, A> operator/(const Deque<T, A>& other) const
 		{
 			return this->differentiated(other);
 		}
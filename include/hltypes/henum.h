@@ -31,19 +31,15 @@ public: \
 	inline classe(chstr name, unsigned int value) : henum(value) { this->_addNewInstance(#classe, name, value); } \
 	inline classe next() const \
 	{ \
-		harray<classe> values = classe::getValues(); \
-		values.sort(); \
-		return values[(values.indexOf(*this) + 1) % values.size()]; \
+		return classe(_registry.getValueAt((_registry.indexOf(this->value) + 1) % _registry.size())); \
 	} \
 	inline classe previous() const \
 	{ \
-		harray<classe> values = classe::getValues(); \
-		values.sort(); \
-		return values[(values.indexOf(*this) + values.size() - 1) % values.size()]; \
+		return classe(_registry.getValueAt((_registry.indexOf(this->value) + _registry.size() - 1) % _registry.size())); \
 	} \
 	inline bool isValid() \
 	{ \
-		return _instances.hasKey((unsigned int)this->value); \
+		return _registry.hasValue(this->value); \
 	} \
 	inline bool operator<(const classe& other) const { return (this->value < other.value); } \
 	inline bool operator>(const classe& other) const { return (this->value > other.value); } \
@@ -53,26 +49,28 @@ public: \
 	inline bool operator!=(const classe& other) const { return (this->value != other.value); } \
 	inline static int getCount() \
 	{ \
-		return _instances.size(); \
+		return _registry.size(); \
 	} \
 	inline static harray<classe> getValues() \
 	{ \
 		harray<classe> result; \
-		foreach_map (unsigned int, hstr, it, _instances) \
+		int count = _registry.size(); \
+		result.reserve(count); \
+		for_iter (i, 0, count) \
 		{ \
-			result += classe::fromUint(it->first); \
+			result += classe(_registry.getValueAt(i)); \
 		} \
 		return result; \
 	} \
 	inline static hstr getEnumName() { return #classe; } \
-	inline static hmap<unsigned int, hstr> getAsMap() { return _instances; } \
+	inline static hmap<unsigned int, hstr> getAsMap() { return _registry.toMap(); } \
 	inline static classe fromInt(int value) \
 	{ \
 		return fromUint((unsigned int)value); \
 	} \
 	inline static classe fromUint(unsigned int value) \
 	{ \
-		if (!_instances.hasKey(value)) \
+		if (!_registry.hasValue(value)) \
 		{ \
 			if (!_useDefaultLooseValue) \
 			{ \
@@ -84,7 +82,8 @@ public: \
 	} \
 	inline static classe fromName(chstr name) \
 	{ \
-		if (!_instances.hasValue(name)) \
+		int index = _registry.indexOfName(name); \
+		if (index < 0) \
 		{ \
 			if (!_useDefaultLooseValue) \
 			{ \
@@ -92,26 +91,26 @@ public: \
 			} \
 			return classe(_defaultLooseValue); \
 		} \
-		return classe(_instances(name)); \
+		return classe(_registry.getValueAt(index)); \
 	} \
 	inline static bool hasValue(chstr name) \
 	{ \
-		return _instances.hasValue(name); \
+		return (_registry.indexOfName(name) >= 0); \
 	} \
 	inline static bool hasValueFor(int value) \
 	{ \
-		return _instances.hasKey((unsigned int)value); \
+		return _registry.hasValue((unsigned int)value); \
 	} \
 	inline static bool hasValueFor(unsigned int value) \
 	{ \
-		return _instances.hasKey(value); \
+		return _registry.hasValue(value); \
 	} \
 	__HL_EXPAND_MACRO code \
 protected: \
 	inline classe(unsigned int value) : henum(value) { } \
-	inline hmap<unsigned int, hstr>& _getInstances() const override { return _instances; } \
+	inline hltypes::EnumerationRegistry& _getRegistry() const override { return _registry; } \
 private: \
-	static hmap<unsigned int, hstr> _instances; \
+	static hltypes::EnumerationRegistry _registry; \
 	static bool _useDefaultLooseValue; \
 	static unsigned int _defaultLooseValue; \
 };
@@ -121,7 +120,7 @@ private: \
 /// @param[in] classe Name of the enum class.
 /// @param[in] code Additional code to process (usually value definitions).
 #define HL_ENUM_CLASS_DEFINE(classe, code) \
-	hmap<unsigned int, hstr> classe::_instances; \
+	hltypes::EnumerationRegistry classe::_registry; \
 	bool classe::_useDefaultLooseValue = false; \
 	unsigned int classe::_defaultLooseValue = 0; \
 	__HL_EXPAND_MACRO code;
@@ -132,7 +131,7 @@ private: \
 /// @see fromInt()
 /// @see fromUint()
 #define HL_ENUM_CLASS_DEFINE_LOOSE(classe, defaultLooseValue, code) \
-	hmap<unsigned int, hstr> classe::_instances; \
+	hltypes::EnumerationRegistry classe::_registry; \
 	bool classe::_useDefaultLooseValue = true; \
 	unsigned int classe::_defaultLooseValue = defaultLooseValue; \
 	__HL_EXPAND_MACRO code;
@@ -164,6 +163,73 @@ private: \
 
 namespace hltypes
 {
+	/// @brief Lookup tables of all values and names of one Enumeration class.
+	/// @note Values are kept sorted so next() and previous() are simple index steps. Values that are densely packed (which is the usual case) are
+	/// additionally indexed by a direct lookup table so value lookups are O(1). Sparse values fall back to a binary search.
+	/// @note Names are looked up with a binary search over an index sorted by name.
+	/// @note Values are registered only during static initialization so all lookups are read-only afterwards.
+	class hltypesExport EnumerationRegistry
+	{
+	public:
+		/// @brief Basic constructor.
+		EnumerationRegistry();
+		/// @brief Destructor.
+		~EnumerationRegistry();
+
+		/// @brief Gets the number of registered values.
+		/// @return The number of registered values.
+		inline int size() const { return this->values.size(); }
+		/// @brief Gets a value by its index in the sorted values.
+		/// @param[in] index Index of the value.
+		/// @return The value.
+		inline unsigned int getValueAt(int index) const { return this->values[index]; }
+		/// @brief Gets the index of a value in the sorted values.
+		/// @param[in] value The value.
+		/// @return Index of the value or -1 if the value is not registered.
+		int indexOf(unsigned int value) const;
+		/// @brief Gets the index of the value with a name in the sorted values.
+		/// @param[in] name Name of the value.
+		/// @return Index of the value or -1 if no value has this name.
+		/// @note If several values have the same name, the index of the lowest one is returned.
+		int indexOfName(const String& name) const;
+		/// @brief Checks if a value is registered.
+		/// @param[in] value The value.
+		/// @return True if the value is registered.
+		inline bool hasValue(unsigned int value) const { return (this->indexOf(value) >= 0); }
+		/// @brief Gets the name of a value.
+		/// @param[in] value The value.
+		/// @return Name of the value.
+		const String& getName(unsigned int value) const;
+		/// @brief Gets the value that follows the highest registered value.
+		/// @return The value that follows the highest registered value or 0 if there are no values.
+		unsigned int getNextFreeValue() const;
+		/// @brief Registers a new value.
+		/// @param[in] name Name of the value.
+		/// @param[in] value The value.
+		/// @note Throws an exception if the value is already registered.
+		void add(const String& name, unsigned int value);
+		/// @brief Creates a Map of all values and names.
+		/// @return A Map of all values and names.
+		Map<unsigned int, String> toMap() const;
+
+	protected:
+		/// @brief Sorted values.
+		Array<unsigned int> values;
+		/// @brief Names of the values, in the same order as the values.
+		Array<String> names;
+		/// @brief Indices of values, sorted by name and then by value.
+		Array<int> nameIndices;
+		/// @brief Direct lookup table from (value - lookupOffset) to value index, -1 for unused values.
+		/// @note Empty if the values are too sparse.
+		Array<int> lookup;
+		/// @brief Value that corresponds to the first element of the lookup table.
+		unsigned int lookupOffset;
+
+		/// @brief Rebuilds the direct lookup table if the values are dense enough.
+		void _updateLookup();
+
+	};
+
 	/// @brief Encapsulates enumeration functionality and adds high level methods.
 	class hltypesExport Enumeration
 	{
@@ -211,9 +277,9 @@ namespace hltypes
 		/// @note This will NOT auto-generate a value in the internal index. It is used to convert ints to Enumeration instances.
 		Enumeration(unsigned int value);
 
-		/// @brief Gets the Map of Enumeration instances that can exist.
-		/// @return The Map of Enumeration instances that can exist.
-		virtual Map<unsigned int, String>& _getInstances() const { static Map<unsigned int, String> dummy; return dummy; };
+		/// @brief Gets the registry of Enumeration instances that can exist.
+		/// @return The registry of Enumeration instances that can exist.
+		virtual EnumerationRegistry& _getRegistry() const { static EnumerationRegistry dummy; return dummy; };
 		/// @brief Adds a new possible instance to the list.
 		/// @param[in] className Name of the Enumeration.
 		/// @param[in] name Name of the Enumeration value.
@@ -167,6 +167,24 @@ namespace hltypes
 	/// @brief Alias for simpler code.
 	#define FileNotWriteableException(filename) hltypes::_FileNotWriteableException(filename, __FILE__, __LINE__)
 	
+	/// @brief Defines a file-could-not-write exception.
+	class hltypesExport _FileCouldNotWriteException : public _Exception
+	{
+	public:
+		/// @brief Basic constructor.
+		/// @param[in] filename Name of the file.
+		/// @param[in] count Number of bytes that could not be written.
+		/// @param[in] sourceFile Name of the source file.
+		/// @param[in] lineNumber Number of the line.
+		_FileCouldNotWriteException(const String& filename, int count, const char* sourceFile, int lineNumber);
+		/// @brief Gets the exception type.
+		/// @return The exception type.
+		inline String getType() const override { return "FileCouldNotWriteException"; }
+
+	};
+	/// @brief Alias for simpler code.
+	#define FileCouldNotWriteException(filename, count) hltypes::_FileCouldNotWriteException(filename, count, __FILE__, __LINE__)
+	
 	/// @brief Defines a resource-not-exists exception.
 	class hltypesExport _ResourceNotExistsException : public _Exception
 	{
@@ -86,6 +86,23 @@ namespace hltypes
 		virtual void open(const String& filename) = 0;
 		/// @brief Closes resource file.
 		virtual void close() = 0;
+		/// @brief Gets the size of the write buffer.
+		/// @return The size of the write buffer.
+		HL_DEFINE_GET(int, writeBufferSize, WriteBufferSize);
+		/// @brief Sets the size of the write buffer.
+		/// @param[in] value New value. 0 disables write buffering.
+		/// @note Buffered data is written to the file first.
+		void setWriteBufferSize(int value);
+		/// @brief Writes all buffered data to the file and flushes the OS file handle.
+		/// @return True if successful.
+		/// @note Buffered data is also written when the file is closed, read or when seeking.
+		/// @note Throws FileCouldNotWriteException if buffered data could not be written. The data stays buffered so a later flush() can retry.
+		bool flush();
+		/// @brief Writes several separate buffers of raw data to the file one after another.
+		/// @param[in] buffers Spans of the raw data.
+		/// @return Number of bytes written.
+		/// @note Uses vectored I/O (writev()) where the platform supports it.
+		int64_t writeRawVectored(Span<const Span<const unsigned char> > buffers) override;
 
 		/// @brief Sets the number of repeated attempts to access a file.
 		/// @param[in] value New value.
@@ -95,6 +112,10 @@ namespace hltypes
 		/// @param[in] value New value.
 		/// @note Not implemented as inline, because optimizer strips it away even if compiled as DLL.
 		static void setTimeout(float value);
+		/// @brief Sets the size of the write buffer that new file objects use.
+		/// @param[in] value New value. 0 disables write buffering.
+		/// @note Not implemented as inline, because optimizer strips it away even if compiled as DLL.
+		static void setDefaultWriteBufferSize(int value);
 
 		/// @brief Gets the extension of the filename.
 		/// @param[in] path The path.
@@ -110,10 +131,28 @@ namespace hltypes
 		String filename;
 		/// @brief OS file handle.
 		void* cfile;
+		/// @brief Whether the file was opened in an append mode where all writes go to the end of the file.
+		bool appendMode;
+		/// @brief Buffer for small writes.
+		/// @note Allocated on the first buffered write.
+		unsigned char* writeBuffer;
+		/// @brief Size of the write buffer.
+		int writeBufferSize;
+		/// @brief Number of bytes currently in the write buffer.
+		int writeBufferCount;
+		/// @brief Position in the file where the data in the write buffer begins.
+		int64_t writeBufferPosition;
+		/// @brief Whether the last access of the OS file handle was a write.
+		bool lastWritten;
+		/// @brief Whether the last access of the OS file handle was a read.
+		bool lastRead;
 
 		/// @brief Gets special descriptor.
 		/// @return Special descriptor.
 		String _descriptor() const override;
+		/// @brief Updates internal data size.
+		/// @note The data size is already kept up to date by every write so this does nothing.
+		void _updateDataSize() override;
 
 		/// @brief Opens an OS file.
 		/// @param[in] filename Name of the file (may include path).
@@ -145,6 +184,19 @@ namespace hltypes
 		/// @param[in] seekMode Seeking mode.
 		/// @return True if successful.
 		bool _fseek(int64_t offset, SeekMode seekMode = SeekMode::Current);
+		/// @brief Writes the data in the write buffer to the file.
+		/// @note Throws FileCouldNotWriteException if not all data could be written. That data stays in the write buffer.
+		void _fflushWriteBuffer();
+		/// @brief Writes as much data from the write buffer to the file as possible.
+		/// @return True if all data was written.
+		/// @note Data that could not be written stays in the write buffer.
+		bool _fwriteBuffer();
+		/// @brief Prepares the OS file handle for reading after it was written to.
+		/// @note C stdio requires a flush or a seek between a write and a following read.
+		void _fprepareRead();
+		/// @brief Prepares the OS file handle for writing after it was read from.
+		/// @note C stdio requires a seek between a read and a following write.
+		void _fprepareWrite();
 
 		/// @brief Checks if a file exists.
 		/// @param[in] filename Name of the file.
@@ -157,6 +209,8 @@ namespace hltypes
 		static int repeats;
 		/// @brief Defines the timeout in miliseconds between repeated attempts to access a file.
 		static float timeout;
+		/// @brief Size of the write buffer that new file objects use.
+		static int defaultWriteBufferSize;
 
 	private:
 		/// @brief Copy constructor.
@@ -41,6 +41,7 @@ namespace hltypes
 		/// @note If this instance is already working with an opened file handle, that file handle will be closed.
 		void open(const String& filename, AccessMode accessMode);
 		/// @brief Closes file.
+		/// @note Throws FileCouldNotWriteException if buffered data could not be written. The file is closed regardless.
 		void close() override;
 		
 		/// @brief Creates a file.
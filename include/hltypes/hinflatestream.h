@@ -0,0 +1,147 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+///
+/// @section DESCRIPTION
+///
+/// Provides on-the-fly decompression of data read from another stream.
+
+#ifdef _ZIPRESOURCE
+#ifndef HLTYPES_INFLATE_STREAM_H
+#define HLTYPES_INFLATE_STREAM_H
+
+#include <stdint.h>
+
+#include "hdeflatestream.h"
+#include "hltypesExport.h"
+#include "hltypesUtil.h"
+#include "hsbase.h"
+#include "hstring.h"
+
+#define DEFAULT_INFLATE_BUFFER_SIZE 65536
+
+namespace hltypes
+{
+	/// @brief Provides on-the-fly decompression of data read from another stream.
+	/// @note Data is decompressed in small steps and only a buffer of fixed size is kept in memory.
+	/// @note Only reading is supported. Seeking forward decompresses and skips data.
+	/// @note The last 64 KB of decompressed data are kept so seeking back a short distance is cheap. Seeking back further restarts decompression from the beginning.
+	/// @note The uncompressed size is only known after the end has been reached. Until then size() returns INT64_MAX.
+	/// @note Only available in builds with _ZIPRESOURCE since that is when miniz is built.
+	class hltypesExport InflateStream : public StreamBase
+	{
+	public:
+		/// @brief Constructor.
+		/// @param[in] stream The stream where compressed data is read from. Reading starts at its current position.
+		/// @param[in] format Framing around the compressed data.
+		/// @param[in] bufferSize Size of the buffer for compressed data.
+		/// @note The other stream has to stay valid while this InflateStream is used.
+		/// @note When the end of the compressed data is reached, the other stream is positioned right after it.
+		InflateStream(StreamBase& stream, DeflateStream::Format format = DeflateStream::Format::Zlib, int bufferSize = DEFAULT_INFLATE_BUFFER_SIZE);
+		/// @brief Destructor.
+		~InflateStream();
+		/// @brief Gets the framing around the compressed data.
+		/// @return The framing around the compressed data.
+		HL_DEFINE_GET(DeflateStream::Format, format, Format);
+
+	protected:
+		/// @brief The stream where compressed data is read from.
+		StreamBase& stream;
+		/// @brief Framing around the compressed data.
+		DeflateStream::Format format;
+		/// @brief Position of the compressed data in the other stream.
+		int64_t streamStart;
+		/// @brief Size of the buffer for compressed data.
+		int bufferSize;
+		/// @brief Buffer for compressed data.
+		unsigned char* buffer;
+		/// @brief The miniz decompressor.
+		void* zStream;
+		/// @brief CRC-32 of the uncompressed data for gzip.
+		unsigned int crc;
+		/// @brief Number of uncompressed bytes read so far.
+		int64_t uncompressedPosition;
+		/// @brief Whether the end of the compressed data has been reached.
+		bool finished;
+		/// @brief Ring buffer with the most recently decompressed data.
+		unsigned char* history;
+		/// @brief Number of valid bytes in the history.
+		int historyCount;
+		/// @brief Number of uncompressed bytes produced by the decompressor so far.
+		/// @note Larger than uncompressedPosition after seeking back into the history.
+		int64_t decompressedPosition;
+
+		/// @brief Gets special descriptor.
+		/// @return Special descriptor.
+		String _descriptor() const override;
+		/// @brief Updates internal data size.
+		/// @note The data size is only known at the end so this does nothing.
+		void _updateDataSize() override;
+		/// @brief Starts decompressing from the beginning of the compressed data.
+		void _restart();
+		/// @brief Frees the decompressor and the buffer.
+		void _close();
+		/// @brief Reads and checks the gzip header.
+		void _readGzipHeader();
+		/// @brief Checks the gzip trailer and positions the other stream right after the compressed data.
+		void _finish();
+		/// @brief Decompresses and discards data.
+		/// @param[in] count Number of bytes to skip.
+		void _skip(int64_t count);
+		/// @brief Copies data at the current position from the history.
+		/// @param[in] buffer Destination data buffer.
+		/// @param[in] count Number of bytes to copy. They have to be in the history.
+		void _readHistory(unsigned char* buffer, int count);
+		/// @brief Adds newly decompressed data to the history.
+		/// @param[in] data The decompressed data.
+		/// @param[in] count Number of bytes.
+		void _writeHistory(const unsigned char* data, int count);
+		/// @brief Reads compressed data from the other stream and decompresses it.
+		/// @param[in] buffer Destination data buffer.
+		/// @param[in] count Number of bytes to decompress.
+		/// @return Number of bytes decompressed.
+		int _inflate(unsigned char* buffer, int count);
+
+		/// @brief Reads data from the history or decompresses it.
+		/// @param[in] buffer Destination data buffer.
+		/// @param[in] count Number of elements to read.
+		/// @return Number of bytes read.
+		int _read(void* buffer, int count) override;
+		/// @brief Always throws an exception since decompressed streams cannot be written.
+		/// @param[in] buffer Source data buffer.
+		/// @param[in] count Number of elements contained in buffer.
+		/// @return Number of bytes written.
+		int _write(const void* buffer, int count) override;
+		/// @brief Checks if the InflateStream is open.
+		/// @return Always true.
+		bool _isOpen() const override;
+		/// @brief Gets the number of uncompressed bytes read so far.
+		/// @return The number of uncompressed bytes read so far.
+		int64_t _position() const override;
+		/// @brief Seeks to position in the uncompressed data.
+		/// @param[in] offset Seeking offset in bytes.
+		/// @param[in] seekMode Seeking mode.
+		/// @return True if successful.
+		bool _seek(int64_t offset, SeekMode seekMode = SeekMode::Current) override;
+
+	private:
+		/// @brief Copy constructor.
+		/// @note Usage is not allowed and it will throw an exception.
+		InflateStream(const InflateStream& other);
+		/// @brief Assignment operator.
+		/// @note Usage is not allowed and it will throw an exception.
+		InflateStream& operator=(InflateStream& other);
+
+	};
+}
+
+/// @brief Alias for simpler code.
+typedef hltypes::InflateStream hinflatestream;
+
+#endif
+#endif
+
@@ -0,0 +1,103 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+///
+/// @section DESCRIPTION
+///
+/// Provides buffered line-by-line reading from streams.
+
+#ifndef HLTYPES_LINE_READER_H
+#define HLTYPES_LINE_READER_H
+
+#include <stdint.h>
+
+#include "hltypesExport.h"
+#include "hspan.h"
+#include "hstring.h"
+
+#define DEFAULT_LINE_READER_BUFFER_SIZE 65536
+
+namespace hltypes
+{
+	class StreamBase;
+
+	/// @brief Reads lines from a StreamBase through an internal buffer.
+	/// @note Every byte is read from the stream and scanned for \\n only once, there is no seeking back like in StreamBase::readLine().
+	/// @note A \\r directly before \\n is removed as well, other \\r characters are kept.
+	/// @note The LineReader reads ahead so the position of the stream is behind the last returned line. Use position() to get the position of
+	/// the next line.
+	class hltypesExport LineReader
+	{
+	public:
+		/// @brief Constructor.
+		/// @param[in] stream Stream to read from. It must stay valid as long as the LineReader is used.
+		/// @param[in] bufferSize Initial size of the internal buffer.
+		/// @note The buffer grows if a line does not fit into it.
+		LineReader(StreamBase& stream, int bufferSize = DEFAULT_LINE_READER_BUFFER_SIZE);
+		/// @brief Destructor.
+		~LineReader();
+
+		/// @brief Gets the number of lines returned so far.
+		/// @return The number of lines returned so far.
+		inline int64_t getLineCount() const { return this->lineCount; }
+
+		/// @brief Reads the next line without copying it.
+		/// @param[out] line Span of the line's characters in the internal buffer, without the line ending.
+		/// @return False if there are no more lines.
+		/// @note The Span is only valid until the next call of a read method.
+		bool readLine(Span<const char>& line);
+		/// @brief Reads the next line.
+		/// @param[out] line The line without the line ending.
+		/// @return False if there are no more lines.
+		/// @note Reusing the same String for all lines avoids reallocations.
+		bool readLine(String& line);
+		/// @brief Reads the next line.
+		/// @return The line without the line ending or an empty String if there are no more lines.
+		String readLine();
+		/// @brief Checks if there are no more lines.
+		/// @return True if there are no more lines.
+		bool eof();
+		/// @brief Gets the position of the next line in the stream.
+		/// @return Position of the next line in the stream.
+		int64_t position() const;
+
+	protected:
+		/// @brief The stream.
+		StreamBase& stream;
+		/// @brief The internal buffer.
+		char* buffer;
+		/// @brief Size of the internal buffer.
+		int capacity;
+		/// @brief Index of the first unreturned character in the buffer.
+		int start;
+		/// @brief Index after the last valid character in the buffer.
+		int end;
+		/// @brief Index of the first character that has not been scanned for \\n yet.
+		int scanned;
+		/// @brief Number of lines returned so far.
+		int64_t lineCount;
+
+		/// @brief Moves the unreturned data to the beginning of the buffer, grows it if needed and reads more data from the stream.
+		/// @return False if no more data could be read.
+		bool _fill();
+
+	private:
+		/// @brief Copy constructor.
+		/// @note Usage is not allowed and it will throw an exception.
+		LineReader(const LineReader& other);
+		/// @brief Assignment operator.
+		/// @note Usage is not allowed and it will throw an exception.
+		LineReader& operator=(LineReader& other);
+
+	};
+}
+
+/// @brief Alias for simpler code.
+typedef hltypes::LineReader hlinereader;
+
+#endif
+
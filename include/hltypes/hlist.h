@@ -32,55 +32,68 @@
 namespace hltypes
 {
 	/// @brief Encapsulates std::list and adds high level methods.
-	template <typename T>
-	class List : public Container<std::list<T>, T>
+	template <typename T, typename A = std::allocator<T> >
+	class List : public Container<std::list<T, A>, T>
 	{
 	public:
 		/// @brief Empty constructor.
 		inline List() :
-			Container<std::list<T>, T>()
+			Container<std::list<T, A>, T>()
+		{
+		}
+		/// @brief Constructor with allocator.
+		/// @param[in] allocator Allocator used for the elements.
+		inline explicit List(const A& allocator) :
+			Container<std::list<T, A>, T>(allocator)
 		{
 		}
 		/// @brief Copy constructor.
 		/// @param[in] other Container to copy.
-		inline List(const Container<std::list<T>, T>& other) :
-			Container<std::list<T>, T>(other)
+		inline List(const Container<std::list<T, A>, T>& other) :
+			Container<std::list<T, A>, T>(other)
+		{
+		}
+		/// @brief Move constructor.
+		/// @param[in] other Container to move.
+		/// @note other is left empty.
+		inline List(Container<std::list<T, A>, T>&& other) :
+			Container<std::list<T, A>, T>(std::move(other))
 		{
 		}
 		/// @brief Constructor from single element.
 		/// @param[in] element Element to insert.
 		/// @note The explicit prevents "var = element" from working.
 		inline explicit List(const T& element) :
-			Container<std::list<T>, T>(element)
+			Container<std::list<T, A>, T>(element)
 		{
 		}
 		/// @brief Constructor from single element.
 		/// @param[in] element Element to insert.
 		/// @param[in] times Number of times to insert element.
 		inline List(const T& element, int times) :
-			Container<std::list<T>, T>(element, times)
+			Container<std::list<T, A>, T>(element, times)
 		{
 		}
 		/// @brief Constructor from another Container.
 		/// @param[in] other Container to copy.
 		/// @param[in] count Number of elements to copy.
-		inline List(const Container<std::list<T>, T>& other, const int count) :
-			Container<std::list<T>, T>(other, count)
+		inline List(const Container<std::list<T, A>, T>& other, const int count) :
+			Container<std::list<T, A>, T>(other, count)
 		{
 		}
 		/// @brief Constructor from another Container.
 		/// @param[in] other Container to copy.
 		/// @param[in] start Start index of elements to copy.
 		/// @param[in] count Number of elements to copy.
-		inline List(const Container<std::list<T>, T>& other, const int start, const int count) :
-			Container<std::list<T>, T>(other, start, count)
+		inline List(const Container<std::list<T, A>, T>& other, const int start, const int count) :
+			Container<std::list<T, A>, T>(other, start, count)
 		{
 		}
 		/// @brief Constructor from C-type array.
 		/// @param[in] other C-type array to copy.
 		/// @param[in] count Number of elements to copy.
 		inline List(const T other[], const int count) :
-			Container<std::list<T>, T>(other, count)
+			Container<std::list<T, A>, T>(other, count)
 		{
 		}
 		/// @brief Constructor from C-type array.
@@ -88,7 +101,7 @@ namespace hltypes
 		/// @param[in] start Start index of elements to copy.
 		/// @param[in] count Number of elements to copy.
 		inline List(const T other[], const int start, const int count) :
-			Container<std::list<T>, T>(other, start, count)
+			Container<std::list<T, A>, T>(other, start, count)
 		{
 		}
 		/// @brief Gets all indices.
@@ -109,147 +122,147 @@ namespace hltypes
 		/// @return The removed element.
 		inline T removeAt(int index)
 		{
-			return Container<std::list<T>, T>::removeAt(index);
+			return Container<std::list<T, A>, T>::removeAt(index);
 		}
 		/// @brief Removes n elements at given index of List.
 		/// @param[in] index Start index of elements to remove.
 		/// @param[in] count Number of elements to remove.
 		/// @return List of all removed elements.
 		/// @note Elements in the returned List are in the same order as in the orignal List.
-		inline List<T> removeAt(int index, int count)
+		inline List<T, A> removeAt(int index, int count)
 		{
-			return this->template _removeAt<List<T> >(index, count);
+			return this->template _removeAt<List<T, A> >(index, count);
 		}
 		/// @brief Removes first element of List.
 		/// @return The removed element.
 		inline T removeFirst()
 		{
-			return Container<std::list<T>, T>::removeFirst();
+			return Container<std::list<T, A>, T>::removeFirst();
 		}
 		/// @brief Removes n elements from the beginning of List.
 		/// @param[in] count Number of elements to remove.
 		/// @return List of all removed elements.
 		/// @note Elements in the returned List are in the same order as in the orignal List.
-		inline List<T> removeFirst(const int count)
+		inline List<T, A> removeFirst(const int count)
 		{
-			return this->template _removeFirst<List<T> >(count);
+			return this->template _removeFirst<List<T, A> >(count);
 		}
 		/// @brief Removes last element of List.
 		/// @return The removed element.
 		inline T removeLast()
 		{
-			return Container<std::list<T>, T>::removeLast();
+			return Container<std::list<T, A>, T>::removeLast();
 		}
 		/// @brief Removes n elements from the end of List.
 		/// @param[in] count Number of elements to remove.
 		/// @return List of all removed elements.
 		/// @note Elements in the returned List are in the same order as in the orignal List.
-		inline List<T> removeLast(const int count)
+		inline List<T, A> removeLast(const int count)
 		{
-			return this->template _removeLast<List<T> >(count);
+			return this->template _removeLast<List<T, A> >(count);
 		}
 		/// @brief Gets a random element in List and removes it.
 		/// @return Random element.
 		inline T removeRandom()
 		{
-			return Container<std::list<T>, T>::removeRandom();
+			return Container<std::list<T, A>, T>::removeRandom();
 		}
 		/// @brief Gets an List of random elements selected from this one and removes them.
 		/// @param[in] count Number of random elements.
 		/// @return List of random elements selected from this one.
-		inline List<T> removeRandom(const int count)
+		inline List<T, A> removeRandom(const int count)
 		{
-			return this->template _removeRandom<List<T> >(count);
+			return this->template _removeRandom<List<T, A> >(count);
 		}
 		/// @brief Gets a random element in List.
 		/// @return Random element.
 		inline T random() const
 		{
-			return Container<std::list<T>, T>::random();
+			return Container<std::list<T, A>, T>::random();
 		}
 		/// @brief Gets an List of random elements selected from this one.
 		/// @param[in] count Number of random elements.
 		/// @param[in] unique Whether to force all random values to be at unique positions.
 		/// @return List of random elements selected from this one.
-		inline List<T> random(int count, bool unique = true) const
+		inline List<T, A> random(int count, bool unique = true) const
 		{
-			return this->template _random<List<T> >(count, unique);
+			return this->template _random<List<T, A> >(count, unique);
 		}
 		/// @brief Creates new List with reversed order of elements.
 		/// @return A new List.
-		inline List<T> reversed() const
+		inline List<T, A> reversed() const
 		{
-			return this->template _reversed<List<T> >();
+			return this->template _reversed<List<T, A> >();
 		}
 		/// @brief Creates new List without duplicates.
 		/// @return A new List.
-		inline List<T> removedDuplicates() const
+		inline List<T, A> removedDuplicates() const
 		{
-			return this->template _removedDuplicates<List<T> >();
+			return this->template _removedDuplicates<List<T, A> >();
 		}
 		/// @brief Creates new sorted List.
 		/// @return A new List.
 		/// @note The sorting order is ascending.
-		inline List<T> sorted() const
+		inline List<T, A> sorted() const
 		{
-			return this->template _sorted<List<T> >();
+			return this->template _sorted<List<T, A> >();
 		}
 		/// @brief Creates new sorted List.
 		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
 		/// @return A new List.
 		/// @note The sorting order is ascending.
 		/// @note compareFunction should return true if first element is less than the second element.
-		inline List<T> sorted(bool (*compareFunction)(T const&, T const&)) const
+		inline List<T, A> sorted(bool (*compareFunction)(T const&, T const&)) const
 		{
-			return this->template _sorted<List<T> >(compareFunction);
+			return this->template _sorted<List<T, A> >(compareFunction);
 		}
 		/// @brief Creates a new List with randomized order of elements.
 		/// @return A new List.
-		inline List<T> randomized() const
+		inline List<T, A> randomized() const
 		{
-			return this->template _randomized<List<T> >();
+			return this->template _randomized<List<T, A> >();
 		}
 		/// @brief Creates a new List as union of this List with an element.
 		/// @param[in] element Element to unite with.
 		/// @return A new List.
 		/// @note Removes duplicates.
-		inline List<T> united(const T& element) const
+		inline List<T, A> united(const T& element) const
 		{
-			return this->template _united<List<T> >(element);
+			return this->template _united<List<T, A> >(element);
 		}
 		/// @brief Creates a new List as union of this List with another one.
 		/// @param[in] other List to unite with.
 		/// @return A new List.
 		/// @note Removes duplicates.
-		inline List<T> united(const List<T>& other) const
+		inline List<T, A> united(const List<T, A>& other) const
 		{
-			return this->template _united<List<T> >(other);
+			return this->template _united<List<T, A> >(other);
 		}
 		/// @brief Creates a new List as intersection of this List with another one.
 		/// @param[in] other List to intersect with.
 		/// @return A new List.
 		/// @note Does not remove duplicates.
-		inline List<T> intersected(const List<T>& other) const
+		inline List<T, A> intersected(const List<T, A>& other) const
 		{
-			return this->template _intersected<List<T> >(other);
+			return this->template _intersected<List<T, A> >(other);
 		}
 		/// @brief Creates a new List as difference of this List with an element.
 		/// @param[in] element Element to differentiate with.
 		/// @return A new List.
 		/// @note Unlike remove, this method ignores if the element is not in this List.
 		/// @note Does not remove duplicates.
-		inline List<T> differentiated(const T& element) const
+		inline List<T, A> differentiated(const T& element) const
 		{
-			return this->template _differentiated<List<T> >(element);
+			return this->template _differentiated<List<T, A> >(element);
 		}
 		/// @brief Creates a new List as difference of this List with another one.
 		/// @param[in] other List to differentiate with.
 		/// @return A new List.
 		/// @note Unlike remove, this method ignore elements of other List that are not in this one.
 		/// @note Does not remove duplicates.
-		inline List<T> differentiated(const List<T>& other) const
+		inline List<T, A> differentiated(const List<T, A>& other) const
 		{
-			return this->template _differentiated<List<T> >(other);
+			return this->template _differentiated<List<T, A> >(other);
 		}
 		/// @brief Creates new List with new elements obtained from the current List elements.
 		/// @param[in] generateFunction Function pointer with generation function for the new elements.
@@ -262,9 +275,9 @@ namespace hltypes
 		/// @brief Finds and returns new List of elements that match the condition.
 		/// @param[in] conditionFunction Function pointer with condition function that takes one element of type T and returns bool.
 		/// @return New List with all matching elements.
-		inline List<T> findAll(bool (*conditionFunction)(T const&)) const
+		inline List<T, A> findAll(bool (*conditionFunction)(T const&)) const
 		{
-			return this->template _findAll<List<T> >(conditionFunction);
+			return this->template _findAll<List<T, A> >(conditionFunction);
 		}
 		/// @brief Returns a new List with all elements cast into type S.
 		/// @return A new List with all elements cast into type S.
@@ -287,111 +300,134 @@ namespace hltypes
 		/// @param[in] index Index of the element.
 		/// @return Element at specified position.
 		/// @note Does not work with bool as T.
+		/// @note The bounds are only checked if HLTYPES_CONTAINER_CHECKS is enabled.
 		inline T& operator[](int index)
 		{
-			return this->at(index);
+			return this->_elementAt(index);
 		}
 		/// @brief Returns element at specified position.
 		/// @param[in] index Index of the element.
 		/// @return Element at specified position.
 		/// @note Does not work with bool as T.
+		/// @note The bounds are only checked if HLTYPES_CONTAINER_CHECKS is enabled.
 		inline const T& operator[](int index) const
 		{
-			return this->at(index);
+			return this->_elementAt(index);
 		}
 		/// @brief Returns a sublist.
 		/// @param[in] start Start index of the elements to copy.
 		/// @param[in] count Number of elements to copy.
 		/// @return Sublist created from the current List.
-		inline List<T> operator()(int start, const int count) const
+		inline List<T, A> operator()(int start, const int count) const
 		{
-			return this->template _sub<List<T> >(start, count);
+			return this->template _sub<List<T, A> >(start, count);
 		}
 		/// @brief Same as equals.
 		/// @see equals
-		inline bool operator==(const List<T>& other) const
+		inline bool operator==(const List<T, A>& other) const
 		{
 			return this->equals(other);
 		}
 		/// @brief Same as nequals.
 		/// @see nequals
-		inline bool operator!=(const List<T>& other) const
+		inline bool operator!=(const List<T, A>& other) const
 		{
 			return this->nequals(other);
 		}
 		/// @brief Same as add.
 		/// @see add(const T& element)
-		inline List<T>& operator<<(const T& element)
+		inline List<T, A>& operator<<(const T& element)
 		{
 			this->add(element);
 			return (*this);
 		}
 		/// @brief Same as add.
-		/// @see add(const List<T>& other)
-		inline List<T>& operator<<(const List<T>& other)
+		/// @see add(T&& element)
+		inline List<T, A>& operator<<(T&& element)
+		{
+			this->add(std::move(element));
+			return (*this);
+		}
+		/// @brief Same as add.
+		/// @see add(const List<T, A>& other)
+		inline List<T, A>& operator<<(const List<T, A>& other)
 		{
 			this->add(other);
 			return (*this);
 		}
 		/// @brief Same as add.
 		/// @see add(const T& element)
-		inline List<T>& operator+=(const T& element)
+		inline List<T, A>& operator+=(const T& element)
 		{
 			this->add(element);
 			return (*this);
 		}
 		/// @brief Same as add.
-		/// @see add(const List<T>& other)
-		inline List<T>& operator+=(const List<T>& other)
+		/// @see add(T&& element)
+		inline List<T, A>& operator+=(T&& element)
+		{
+			this->add(std::move(element));
+			return (*this);
+		}
+		/// @brief Same as add.
+		/// @see add(const List<T, A>& other)
+		inline List<T, A>& operator+=(const List<T, A>& other)
 		{
 			this->add(other);
 			return (*this);
 		}
+		/// @brief Same as add.
+		/// @see add(Container&& other)
+		inline List<T, A>& operator+=(List<T, A>&& other)
+		{
+			this->add(std::move(other));
+			return (*this);
+		}
 		/// @brief Same as remove.
 		/// @see remove(T element)
-		inline List<T>& operator-=(T element)
+		inline List<T, A>& operator-=(T element)
 		{
 			this->remove(element);
 			return (*this);
 		}
 		/// @brief Same as remove.
-		/// @see remove(const List<T>& other)
-		inline List<T>& operator-=(const List<T>& other)
+		/// @see remove(const List<T, A>& other)
+		inline List<T, A>& operator-=(const List<T, A>& other)
 		{
 			this->remove(other);
 			return (*this);
 		}
 		/// @brief Same as unite.
 		/// @see unite(const T& element)
-		inline List<T>& operator|=(const T& element)
+		inline List<T, A>& operator|=(const T& element)
 		{
 			this->unite(element);
 			return (*this);
 		}
 		/// @brief Same as unite.
-		/// @see unite(const List<T>& other)
-		inline List<T>& operator|=(const List<T>& other)
+		/// @see unite(const List<T, A>& other)
+		inline List<T, A>& operator|=(const List<T, A>& other)
 		{
 			this->unite(other);
 			return (*this);
 		}
 		/// @brief Same as intersect.
-		/// @see intersect(const List<T>& other)
-		inline List<T>& operator&=(const List<T>& other)
+		/// @see intersect(const List<T, A>& other)
+		inline List<T, A>& operator&=(const List<T, A>& other)
 		{
 			this->intersect(other);
 			return (*this);
 		}
 		/// @brief Same as differentiate.
 		/// @see differentiate(const T& element)
-		inline List<T>& operator/=(const T& element)
+		inline List<T, A>& operator/=(const T& element)
 		{
 			this->differentiate(element);
 			return (*this);
 		}
 		/// @brief Same as differentiate.
-		/// @see differentiate(const List<T>& other)
-		inline List<T>& operator/=(const List<T>& other)
+		/// @see differentiate(const List<T, A>& other)
+		inline List<T, A>& operator/=(const List<T, A>& other)
 		{
 			this->differentiate(other);
 			return (*this);
@@ -399,66 +435,66 @@ namespace hltypes
 		/// @brief Merges a List with an element.
 		/// @param[in] element Element to merge with.
 		/// @return New List with element added at the end of List.
-		inline List<T> operator+(const T& element) const
+		inline List<T, A> operator+(const T& element) const
 		{
-			List<T> result(*this);
+			List<T, A> result(*this);
 			result += element;
 			return result;
 		}
 		/// @brief Merges two Lists.
 		/// @param[in] other Second List to merge with.
 		/// @return New List with elements of second List added at the end of first List.
-		inline List<T> operator+(const List<T>& other) const
+		inline List<T, A> operator+(const List<T, A>& other) const
 		{
-			List<T> result(*this);
+			List<T, A> result(*this);
 			result += other;
 			return result;
 		}
 		/// @brief Removes element from List.
 		/// @param[in] element Element to remove.
 		/// @return New List with elements of first List without given element.
-		inline List<T> operator-(T element) const
+		inline List<T, A> operator-(T element) const
 		{
-			List<T> result(*this);
+			List<T, A> result(*this);
 			result -= element;
 			return result;
 		}
 		/// @brief Removes second List from first List.
 		/// @param[in] other List to remove.
 		/// @return New List with elements of first List without the elements of second List.
-		inline List<T> operator-(const List<T>& other) const
+		inline List<T, A> operator-(const List<T, A>& other) const
 		{
-			List<T> result(*this);
+			List<T, A> result(*this);
 			result -= other;
 			return result;
 		}
 		/// @brief Same as united.
 		/// @see united(const T& element)
-		inline List<T> operator|(const T& element) const
+		inline List<T, A> operator|(const T& element) const
 		{
 			return this->united(element);
 		}
 		/// @brief Same as united.
-		/// @see united(const List<T>& other)
-		inline List<T> operator|(const List<T>& other) const
+		/// @see united(const List<T, A>& other)
+		inline List<T, A> operator|(const List<T, A>& other) const
 		{
 			return this->united(other);
 		}
 		/// @brief Same as intersected.
-		/// @see intersected(const List<T>& other)
-		inline List<T> operator&(const List<T>& other) const
+		/// @see intersected(const List<T, A>& other)
+		inline List<T, A> operator&(const List<T, A>& other) const
 		{
 			return this->intersected(other);
 		}
 		/// @brief Same as differentiated.
 		/// @see differentiated(const T& element)
-		inline List<T> operator/(const T& element) const
+		inline List<T, A> operator/(const T& element) const
 		{
 			return this->differentiated(element);
 		}
 		/// @brief Same as differentiated.
-		/// @see differentiated(const List<T>& other)
-		inline List<T> operator/(const List<T>& other) const
+		/// @see differentiated(const List<T, A>& other)
+		inline List<T, A> operator/(const List<T, A>& other) const
 		{
 			return this->differentiated(other);
 		}
@@ -539,17 +539,24 @@ hltypesFnExport int hpotFloor(int value);
 /// @param[in] value the number to check.
 /// @return The previous power-of-two value of the given number.
 hltypesFnExport int64_t hpotFloor(int64_t value);
+/// @brief Reverses the byte order of every element in a buffer.
+/// @param[in,out] data The elements.
+/// @param[in] count Number of elements.
+/// @param[in] elementSize Size of each element in bytes.
+/// @note 2, 4 and 8 byte elements use simple shift loops that compilers can vectorize.
+hltypesFnExport void hswapBytes(void* data, int64_t count, int elementSize);
 
 /// @brief Calculates CRC32 from a byte stream.
 /// @param[in] data Data stream.
 /// @param[in] size Size of the data stream.
 /// @return CRC32 value of the stream.
-hltypesFnExport unsigned int hcrc32(const unsigned char* data, unsigned int size);
+hltypesFnExport unsigned int hcrc32(const unsigned char* data, int64_t size);
 /// @brief Calculates CRC32 from a StreamBase.
 /// @param[in] stream StreamBase from which to calculate the CRC32.
 /// @param[in] size Number of bytes to read for CRC32.
 /// @return CRC32 value of the StreamBase.
-hltypesFnExport unsigned int hcrc32(hltypes::StreamBase* stream, unsigned int size);
+/// @note The data is read in chunks and the position of the StreamBase does not change.
+hltypesFnExport unsigned int hcrc32(hltypes::StreamBase* stream, int64_t size);
 /// @brief Calculates CRC32 from a StreamBase.
 /// @param[in] stream StreamBase from which to calculate the CRC32.
 /// @return CRC32 value of the StreamBase.
@@ -558,7 +565,7 @@ hltypesFnExport unsigned int hcrc32(hltypes::StreamBase* stream);
 /// @param[in] stream Stream from which to calculate the CRC32.
 /// @param[in] size Number of bytes to read for CRC32.
 /// @return CRC32 value of the Stream.
-hltypesFnExport unsigned int hcrc32(hltypes::Stream* stream, unsigned int size);
+hltypesFnExport unsigned int hcrc32(hltypes::Stream* stream, int64_t size);
 /// @brief Calculates CRC32 from a Stream.
 /// @param[in] stream Stream from which to calculate the CRC32.
 /// @return CRC32 value of the Stream.
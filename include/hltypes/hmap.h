@@ -18,6 +18,7 @@
 #include "harray.h"
 #include "hltypesUtil.h"
 #include "hstring.h"
+#include "hview.h"
 
 /// @brief Provides a simpler syntax to iterate through a Map.
 #define foreach_map(typeKey, typeValue, name, container) for (typename hltypes::Map< typeKey, typeValue >::iterator_t name = (container).begin(), name ## End = (container).end(); name != name ## End; ++name)
@@ -36,27 +37,33 @@
 namespace hltypes
 {
 	/// @brief Encapsulates std::map and adds high level methods.
-	template <typename K, typename V>
-	class Map : public std::map<K, V>
+	template <typename K, typename V, typename A = std::allocator<std::pair<const K, V> > >
+	class Map : public std::map<K, V, std::less<K>, A>
 	{
 	public:
 		/// @brief Iterator type exposure.
-		typedef typename std::map<K, V>::iterator iterator_t;
+		typedef typename std::map<K, V, std::less<K>, A>::iterator iterator_t;
 		/// @brief Iterator type exposure.
-		typedef typename std::map<K, V>::const_iterator const_iterator_t;
+		typedef typename std::map<K, V, std::less<K>, A>::const_iterator const_iterator_t;
 		/// @brief Iterator type exposure.
 		typedef typename std::vector<K>::iterator kiterator_t;
 		/// @brief Iterator type exposure.
 		typedef typename std::vector<K>::const_iterator const_kiterator_t;
 		/// @brief Empty constructor.
 		inline Map() :
-			std::map<K, V>()
+			std::map<K, V, std::less<K>, A>()
+		{
+		}
+		/// @brief Constructor with allocator.
+		/// @param[in] allocator Allocator used for the entries.
+		inline explicit Map(const A& allocator) :
+			std::map<K, V, std::less<K>, A>(std::less<K>(), allocator)
 		{
 		}
 		/// @brief Copy constructor.
 		/// @param[in] other Map to copy.
-		inline Map(const Map<K, V>& other) :
-			std::map<K, V>(other)
+		inline Map(const Map<K, V, A>& other) :
+			std::map<K, V, std::less<K>, A>(other)
 		{
 		}
 		/// @brief Returns value with specified key.
@@ -64,7 +71,7 @@ namespace hltypes
 		/// @return Value with specified key.
 		inline V& operator[](const K& key)
 		{
-			return std::map<K, V>::operator[](key);
+			return std::map<K, V, std::less<K>, A>::operator[](key);
 		}
 		/// @brief Same as key_of.
 		/// @see key_of
@@ -74,13 +81,13 @@ namespace hltypes
 		}
 		/// @brief Same as equals.
 		/// @see equals
-		inline bool operator==(const Map<K, V>& other) const
+		inline bool operator==(const Map<K, V, A>& other) const
 		{
 			return this->equals(other);
 		}
 		/// @brief Same as nequals.
 		/// @see nequals
-		inline bool operator!=(const Map<K, V>& other) const
+		inline bool operator!=(const Map<K, V, A>& other) const
 		{
 			return this->nequals(other);
 		}
@@ -88,7 +95,21 @@ namespace hltypes
 		/// @return The number of values in the Map.
 		inline int size() const
 		{
-			return (int)std::map<K, V>::size();
+			return (int)std::map<K, V, std::less<K>, A>::size();
+		}
+		/// @brief Creates a lazy View of all keys.
+		/// @return A View of all keys.
+		/// @note The View must not be used after the Map has been modified or destroyed.
+		inline View<_ViewMapKeys<const_iterator_t> > keysView() const
+		{
+			return View<_ViewMapKeys<const_iterator_t> >(_ViewMapKeys<const_iterator_t>(this->begin(), this->end(), this->size()));
+		}
+		/// @brief Creates a lazy View of all values.
+		/// @return A View of all values.
+		/// @note The View must not be used after the Map has been modified or destroyed.
+		inline View<_ViewMapValues<const_iterator_t> > valuesView() const
+		{
+			return View<_ViewMapValues<const_iterator_t> >(_ViewMapValues<const_iterator_t>(this->begin(), this->end(), this->size()));
 		}
 		/// @brief Returns an Array with all keys.
 		/// @return An Array with all keys.
@@ -113,13 +134,16 @@ namespace hltypes
 			return result;
 		}
 		/// @brief Returns an Array with all values in the same order as the given corresponding keys.
+		/// @param[in] keys The keys.
 		/// @return An Array with all values in the same order as the given corresponding keys.
-		inline Array<V> values(const Array<K> keys) const
+		/// @note Array<K> converts to the Span without copying.
+		inline Array<V> values(Span<const K> keys) const
 		{
 			Array<V> result;
-			for (const_kiterator_t it = keys.begin(), itEnd = keys.end(); it != itEnd; ++it) // don't change, requires a const iterator
+			result.reserve(keys.size());
+			for (const K* it = keys.begin(), * itEnd = keys.end(); it != itEnd; ++it)
 			{
-				result += std::map<K, V>::at(*it);
+				result += std::map<K, V, std::less<K>, A>::at(*it);
 			}
 			return result;
 		}
@@ -135,20 +159,23 @@ namespace hltypes
 			return result;
 		}
 		/// @brief Returns an Array with all key-value pairs in the same order as the given corresponding keys.
+		/// @param[in] keys The keys.
 		/// @return An Array with all key-value pairs in the same order as the given corresponding keys.
-		inline Array<std::pair<K, V> > keyValuePairs(const Array<K> keys) const
+		/// @note Array<K> converts to the Span without copying.
+		inline Array<std::pair<K, V> > keyValuePairs(Span<const K> keys) const
 		{
 			Array<std::pair<K, V> > result;
-			for (const_kiterator_t it = keys.begin(), itEnd = keys.end(); it != itEnd; ++it) // don't change, requires a const iterator
+			result.reserve(keys.size());
+			for (const K* it = keys.begin(), * itEnd = keys.end(); it != itEnd; ++it)
 			{
-				result += std::pair<K, V>((*it), std::map<K, V>::operator[](*it));
+				result += std::pair<K, V>((*it), std::map<K, V, std::less<K>, A>::at(*it));
 			}
 			return result;
 		}
 		/// @brief Compares the contents of two Maps for being equal.
 		/// @param[in] other Another Map.
 		/// @return True if number of keys and values are equal and all pairs of keys and values are equal.
-		inline bool equals(const Map<K, V>& other) const
+		inline bool equals(const Map<K, V, A>& other) const
 		{
 			if (this->size() != other.size())
 			{
@@ -169,7 +196,7 @@ namespace hltypes
 		/// @brief Compares the contents of two Maps for being not equal.
 		/// @param[in] other Another Map.
 		/// @return True if number of keys and values are not equal or at least one pair of keys and values is not equal.
-		inline bool nequals(const Map<K, V>& other) const
+		inline bool nequals(const Map<K, V, A>& other) const
 		{
 			if (this->size() != other.size())
 			{
@@ -199,31 +226,31 @@ namespace hltypes
 					return it->first;
 				}
 			}
-			return std::map<K, V>::end()->first;
+			return std::map<K, V, std::less<K>, A>::end()->first;
 		}
 		/// @brief Returns value of specified key.
 		/// @param[in] key Key of the given value.
 		/// @return Value of specified key.
 		inline V valueOf(const K& key) const
 		{
-			return std::map<K, V>::find(key)->second;
+			return std::map<K, V, std::less<K>, A>::find(key)->second;
 		}
 		/// @brief Checks for existence of a key.
 		/// @param[in] key Key to check.
 		/// @return True if key is present.
 		inline bool hasKey(const K& key) const
 		{
-			return (std::map<K, V>::find(key) != std::map<K, V>::end());
+			return (std::map<K, V, std::less<K>, A>::find(key) != std::map<K, V, std::less<K>, A>::end());
 		}
 		/// @brief Checks for existence of a key within an Array of keys.
 		/// @param[in] keys Array of keys to check.
 		/// @return True if any key is present.
 		inline bool hasAnyKey(const Array<K>& keys) const
 		{
-			const_iterator_t end = std::map<K, V>::end();
+			const_iterator_t end = std::map<K, V, std::less<K>, A>::end();
 			for_iter (i, 0, keys.size())
 			{
-				if (std::map<K, V>::find(keys.at(i)) != end)
+				if (std::map<K, V, std::less<K>, A>::find(keys.at(i)) != end)
 				{
 					return true;
 				}
@@ -236,10 +263,10 @@ namespace hltypes
 		/// @return True if any key is present.
 		inline bool hasAnyKey(const K keys[], const int count) const
 		{
-			const_iterator_t end = std::map<K, V>::end();
+			const_iterator_t end = std::map<K, V, std::less<K>, A>::end();
 			for_iter (i, 0, count)
 			{
-				if (std::map<K, V>::find(keys[i]) != end)
+				if (std::map<K, V, std::less<K>, A>::find(keys[i]) != end)
 				{
 					return true;
 				}
@@ -251,10 +278,10 @@ namespace hltypes
 		/// @return True if all keys are present.
 		inline bool hasAllKeys(const Array<K>& keys) const
 		{
-			const_iterator_t end = std::map<K, V>::end();
+			const_iterator_t end = std::map<K, V, std::less<K>, A>::end();
 			for_iter (i, 0, keys.size())
 			{
-				if (std::map<K, V>::find(keys.at(i)) == end)
+				if (std::map<K, V, std::less<K>, A>::find(keys.at(i)) == end)
 				{
 					return false;
 				}
@@ -267,10 +294,10 @@ namespace hltypes
 		/// @return True if all keys are present.
 		inline bool hasAllKeys(const K keys[], const int count) const
 		{
-			const_iterator_t end = std::map<K, V>::end();
+			const_iterator_t end = std::map<K, V, std::less<K>, A>::end();
 			for_iter (i, 0, count)
 			{
-				if (std::map<K, V>::find(keys[i]) == end)
+				if (std::map<K, V, std::less<K>, A>::find(keys[i]) == end)
 				{
 					return false;
 				}
@@ -354,23 +381,23 @@ namespace hltypes
 		/// @param[in] value Value of the entry.
 		inline void insert(const K& key, const V& value)
 		{
-			std::map<K, V>::operator[](key) = value;
+			std::map<K, V, std::less<K>, A>::operator[](key) = value;
 		}
 		/// @brief Adds all pairs of keys and values from another Map into this one.
 		/// @param[in] other Another Map.
 		/// @note Entries with already existing keys will not be overwritten.
-		inline void insert(const Map<K, V>& other)
+		inline void insert(const Map<K, V, A>& other)
 		{
-			std::map<K, V>::insert(other.begin(), other.end());
+			std::map<K, V, std::less<K>, A>::insert(other.begin(), other.end());
 		}
 		/// @brief Adds all pairs of keys and values from another Map into this one.
 		/// @param[in] other Another Map.
 		/// @note Entries with already existing keys will be overwritten. In comparison to insert, this function is doing a barrel roll.
-		inline void inject(const Map<K, V>& other)
+		inline void inject(const Map<K, V, A>& other)
 		{
 			__foreach_other_map_it(it, other)
 			{
-				std::map<K, V>::operator[](it->first) = it->second;
+				std::map<K, V, std::less<K>, A>::operator[](it->first) = it->second;
 			}
 		}
 		/// @brief Removes a pair of key and value specified by a key.
@@ -380,7 +407,7 @@ namespace hltypes
 		{
 			if (this->hasKey(key))
 			{
-				std::map<K, V>::erase(key);
+				std::map<K, V, std::less<K>, A>::erase(key);
 				return true;
 			}
 			return false;
@@ -395,7 +422,7 @@ namespace hltypes
 			{
 				if (this->hasKey(keys.at(i)))
 				{
-					std::map<K, V>::erase(keys.at(i));
+					std::map<K, V, std::less<K>, A>::erase(keys.at(i));
 					++result;
 				}
 			}
@@ -409,7 +436,7 @@ namespace hltypes
 			if (this->hasValue(value))
 			{
 				K result = this->keyOf(value);
-				std::map<K, V>::erase(result);
+				std::map<K, V, std::less<K>, A>::erase(result);
 				return true;
 			}
 			return false;
@@ -426,7 +453,7 @@ namespace hltypes
 				{
 					if (it->second == values.at(i))
 					{
-						std::map<K, V>::erase(it->first);
+						std::map<K, V, std::less<K>, A>::erase(it->first);
 						++result;
 						break;
 					}
@@ -446,20 +473,20 @@ namespace hltypes
 			K key = this->keys()[hrand(this->size())];
 			if (value != NULL)
 			{
-				*value = std::map<K, V>::find(key)->second;
+				*value = std::map<K, V, std::less<K>, A>::find(key)->second;
 			}
 			return key;
 		}
 		/// @brief Gets a Map of random elements selected from this one.
 		/// @param[in] count Number of random elements.
 		/// @return Map of random elements selected from this one.
-		inline Map<K, V> random(int count) const
+		inline Map<K, V, A> random(int count) const
 		{
 			if (count >= this->size())
 			{
-				return Map<K, V>(*this);
+				return Map<K, V, A>(*this);
 			}
-			Map<K, V> result;
+			Map<K, V, A> result(this->get_allocator());
 			if (count > 0)
 			{
 				Array<K> keys = this->keys();
@@ -467,7 +494,7 @@ namespace hltypes
 				for_iter (i, 0, count)
 				{
 					key = keys.removeAt(hrand(keys.size()));
-					result[key] = std::map<K, V>::find(key)->second;
+					result[key] = std::map<K, V, std::less<K>, A>::find(key)->second;
 				}
 			}
 			return result;
@@ -484,21 +511,21 @@ namespace hltypes
 			K key = this->keys()[hrand(this->size())];
 			if (value != NULL)
 			{
-				*value = std::map<K, V>::find(key);
+				*value = std::map<K, V, std::less<K>, A>::find(key);
 			}
-			std::map<K, V>::erase(key);
+			std::map<K, V, std::less<K>, A>::erase(key);
 			return key;
 		}
 		/// @brief Gets a Map of random elements selected from this one and removes them.
 		/// @param[in] count Number of random elements.
 		/// @return Map of random elements selected from this one.
-		inline Map<K, V> removeRandom(int count)
+		inline Map<K, V, A> removeRandom(int count)
 		{
 			if (count >= this->size())
 			{
-				return Map<K, V>(*this);
+				return Map<K, V, A>(*this);
 			}
-			Map<K, V> result;
+			Map<K, V, A> result(this->get_allocator());
 			if (count > 0)
 			{
 				Array<K> keys = this->keys();
@@ -506,8 +533,8 @@ namespace hltypes
 				for_iter (i, 0, count)
 				{
 					key = keys.remove_at(hrand(keys.size()));
-					result[key] = std::map<K, V>::find(key);
-					std::map<K, V>::erase(key);
+					result[key] = std::map<K, V, std::less<K>, A>::find(key);
+					std::map<K, V, std::less<K>, A>::erase(key);
 				}
 			}
 			return result;
@@ -515,9 +542,9 @@ namespace hltypes
 		/// @brief Finds and returns new Map with entries that match the condition.
 		/// @param[in] conditionFunction Function pointer with condition function that takes a key of type K and a value of type V and returns bool.
 		/// @return New Map with all matching elements.
-		inline Map<K, V> findAll(bool (*conditionFunction)(K const&, V const&)) const
+		inline Map<K, V, A> findAll(bool (*conditionFunction)(K const&, V const&)) const
 		{
-			Map<K, V> result;
+			Map<K, V, A> result(this->get_allocator());
 			__foreach_this_map_it(it)
 			{
 				if (conditionFunction(it->first, it->second))
@@ -633,12 +660,12 @@ namespace hltypes
 		/// @return Value stored at key or given default value.
 		inline V tryGet(K key, V defaultValue) const
 		{
-			const_iterator_t value = std::map<K, V>::find(key);
-			return (value != std::map<K, V>::end() ? value->second : defaultValue);
+			const_iterator_t value = std::map<K, V, std::less<K>, A>::find(key);
+			return (value != std::map<K, V, std::less<K>, A>::end() ? value->second : defaultValue);
 		}
 		/// @brief Same as insert.
-		/// @see insert(const Map<K, V>& other)
-		inline Map<K, V>& operator+=(const Map<K, V>& other)
+		/// @see insert(const Map<K, V, A>& other)
+		inline Map<K, V, A>& operator+=(const Map<K, V, A>& other)
 		{
 			this->insert(other);
 			return (*this);
@@ -647,9 +674,9 @@ namespace hltypes
 		/// @param[in] other Second Map to merge with.
 		/// @return New Map with elements of second Map added at the end of first Map.
 		/// @note Entries with already existing keys in the first map will not be overwritten.
-		inline Map<K, V> operator+(const Map<K, V>& other) const
+		inline Map<K, V, A> operator+(const Map<K, V, A>& other) const
 		{
-			Map<K, V> result(*this);
+			Map<K, V, A> result(*this);
 			result += other;
 			return result;
 		}
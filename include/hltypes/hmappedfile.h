@@ -0,0 +1,156 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+///
+/// @section DESCRIPTION
+///
+/// Provides file access through memory mapping.
+
+#ifndef HLTYPES_MAPPED_FILE_H
+#define HLTYPES_MAPPED_FILE_H
+
+#include <stdint.h>
+
+#include "henum.h"
+#include "hltypesExport.h"
+#include "hltypesUtil.h"
+#include "hsbase.h"
+#include "hspan.h"
+#include "hstring.h"
+
+namespace hltypes
+{
+	/// @brief Provides file access through memory mapping.
+	/// @note The whole file is mapped into the address space when it is opened. The OS loads pages on demand so no data is copied to the heap.
+	/// @note All StreamBase methods are supported. They read directly from the mapped memory.
+	/// @note The size of the file cannot be changed. Writing stops at the end of the file.
+	class hltypesExport MappedFile : public StreamBase
+	{
+	public:
+		/// @class AccessPattern
+		/// @brief Defines hints about how the mapped data is going to be accessed.
+		HL_ENUM_CLASS_PREFIX_DECLARE(hltypesExport, AccessPattern,
+		(
+			/// @var static const AccessPattern AccessPattern::Normal
+			/// @brief No special treatment. (MADV_NORMAL)
+			HL_ENUM_DECLARE(AccessPattern, Normal);
+			/// @var static const AccessPattern AccessPattern::Sequential
+			/// @brief Data is read from start to end, pages can be read ahead aggressively and released after use. (MADV_SEQUENTIAL)
+			HL_ENUM_DECLARE(AccessPattern, Sequential);
+			/// @var static const AccessPattern AccessPattern::Random
+			/// @brief Data is read in random order, reading ahead would be wasted. (MADV_RANDOM)
+			HL_ENUM_DECLARE(AccessPattern, Random);
+			/// @var static const AccessPattern AccessPattern::WillNeed
+			/// @brief All data is going to be needed soon and can be loaded in advance. (MADV_WILLNEED)
+			HL_ENUM_DECLARE(AccessPattern, WillNeed);
+		));
+
+		/// @brief Basic constructor.
+		MappedFile();
+		/// @brief Destructor.
+		~MappedFile();
+		/// @brief Gets the current filename.
+		/// @return The current filename.
+		HL_DEFINE_GET(String, filename, Filename);
+		/// @brief Checks if the mapped data can be modified.
+		/// @return True if the mapped data can be modified.
+		HL_DEFINE_IS(writable, Writable);
+
+		/// @brief Maps a file.
+		/// @param[in] filename Name of the file (may include path).
+		/// @param[in] writable Whether the mapped data can be modified. Modifications are written back to the file.
+		/// @note If this instance already has a mapped file, that file will be closed.
+		void open(const String& filename, bool writable = false);
+		/// @brief Unmaps the file.
+		void close();
+		/// @brief Tells the OS how the mapped data is going to be accessed.
+		/// @param[in] accessPattern The access pattern.
+		/// @return True if successful.
+		/// @note On platforms without an equivalent of madvise() this does nothing and returns true.
+		bool advise(AccessPattern accessPattern);
+		/// @brief Writes modified data back to the file.
+		/// @return True if successful.
+		bool flush();
+
+		/// @brief Gets the mapped data.
+		/// @return Span of the mapped data.
+		/// @note The Span becomes invalid when the file is closed.
+		/// @note Throws an exception if the file is larger than 2 GB. Use readView() to access such files in parts.
+		Span<const unsigned char> span() const;
+		/// @brief Gets the mapped data for modification.
+		/// @return Span of the mapped data.
+		/// @note The Span becomes invalid when the file is closed.
+		/// @note Throws an exception if the file was not mapped as writable or if it is larger than 2 GB.
+		Span<unsigned char> writableSpan();
+		/// @brief Reads data from the current position without copying it.
+		/// @param[in] count Number of bytes to read.
+		/// @return Span of the read data. It is shorter than count if the end of the file has been reached.
+		/// @note The Span becomes invalid when the file is closed.
+		Span<const unsigned char> readView(int count);
+
+		/// @brief Same as span().
+		/// @see span()
+		operator Span<const unsigned char>() const;
+
+	protected:
+		/// @brief Current filename.
+		String filename;
+		/// @brief Whether the mapped data can be modified.
+		bool writable;
+		/// @brief Whether a file is mapped.
+		/// @note Empty files are open, but have no mapped data.
+		bool mapped;
+		/// @brief The mapped data.
+		unsigned char* data;
+		/// @brief Current position.
+		int64_t dataPosition;
+
+		/// @brief Gets special descriptor.
+		/// @return Special descriptor.
+		String _descriptor() const override;
+		/// @brief Updates internal data size.
+		/// @note The size of a mapped file does not change so this does nothing.
+		void _updateDataSize() override;
+
+		/// @brief Reads data from the mapped memory.
+		/// @param[in] buffer Destination data buffer.
+		/// @param[in] count Number of elements to read.
+		/// @return Number of bytes read.
+		int _read(void* buffer, int count) override;
+		/// @brief Writes data to the mapped memory.
+		/// @param[in] buffer Source data buffer.
+		/// @param[in] count Number of elements contained in buffer.
+		/// @return Number of bytes written.
+		int _write(const void* buffer, int count) override;
+		/// @brief Checks if a file is mapped.
+		/// @return True if a file is mapped.
+		bool _isOpen() const override;
+		/// @brief Gets current position in the mapped data.
+		/// @return Current position in the mapped data.
+		int64_t _position() const override;
+		/// @brief Seeks to position in the mapped data.
+		/// @param[in] offset Seeking offset in bytes.
+		/// @param[in] seekMode Seeking mode.
+		/// @return True if successful.
+		bool _seek(int64_t offset, SeekMode seekMode = SeekMode::Current) override;
+
+	private:
+		/// @brief Copy constructor.
+		/// @note Usage is not allowed and it will throw an exception.
+		MappedFile(const MappedFile& other);
+		/// @brief Assignment operator.
+		/// @note Usage is not allowed and it will throw an exception.
+		MappedFile& operator=(MappedFile& other);
+
+	};
+}
+
+/// @brief Alias for simpler code.
+typedef hltypes::MappedFile hmappedfile;
+
+#endif
+
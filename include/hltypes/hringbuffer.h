@@ -0,0 +1,324 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+///
+/// @section DESCRIPTION
+///
+/// Provides a lock-free ring buffer for passing data from one thread to another.
+
+#ifndef HLTYPES_RING_BUFFER_H
+#define HLTYPES_RING_BUFFER_H
+
+#include <atomic>
+#include <new>
+#include <utility>
+
+#include "hexception.h"
+#include "hltypesUtil.h"
+#include "hthread.h"
+
+namespace hltypes
+{
+	/// @brief Bounded lock-free single-producer/single-consumer queue.
+	/// @note Exactly one thread may push and exactly one thread may pop at the same time.
+	/// @note The positions of the producer and the consumer are kept in separate cache lines to avoid false sharing.
+	/// @note Blocking methods wait with Thread::backoff().
+	template <typename T>
+	class RingBuffer
+	{
+	public:
+		/// @brief Basic constructor.
+		/// @param[in] capacity Maximum number of elements. It is rounded up to the next power of 2.
+		/// @note Capacities above 2^30 are rejected since they cannot be rounded up within an int.
+		inline RingBuffer(int capacity) :
+			head(0),
+			cachedTail(0),
+			tail(0),
+			cachedHead(0)
+		{
+			if (capacity <= 0)
+			{
+				throw Exception("RingBuffer capacity must be positive!");
+			}
+			if (capacity > (1 << 30))
+			{
+				throw Exception(hsprintf("RingBuffer capacity %d is too large!", capacity));
+			}
+			this->mask = 1;
+			while ((int)this->mask < capacity)
+			{
+				this->mask <<= 1;
+			}
+			this->elements = (T*)::operator new(sizeof(T) * this->mask);
+			--this->mask;
+		}
+		/// @brief Destructor.
+		/// @note Elements that have not been popped are destroyed.
+		inline ~RingBuffer()
+		{
+			unsigned int tail = this->tail.load(std::memory_order_relaxed);
+			for (unsigned int i = this->head.load(std::memory_order_relaxed); i != tail; ++i)
+			{
+				this->elements[i & this->mask].~T();
+			}
+			::operator delete(this->elements);
+		}
+
+		/// @brief Gets the maximum number of elements.
+		/// @return The maximum number of elements.
+		inline int capacity() const { return (int)(this->mask + 1); }
+		/// @brief Gets the number of elements.
+		/// @return The number of elements.
+		/// @note The result is only a snapshot if other threads use the RingBuffer at the same time.
+		inline int size() const { return (int)(this->tail.load(std::memory_order_acquire) - this->head.load(std::memory_order_acquire)); }
+		/// @brief Checks if the RingBuffer is empty.
+		/// @return True if the RingBuffer is empty.
+		/// @note The result is only a snapshot if other threads use the RingBuffer at the same time.
+		inline bool isEmpty() const { return (this->size() == 0); }
+
+		/// @brief Adds an element if there is space.
+		/// @param[in] element Element to add.
+		/// @return True if the element was added, false if the RingBuffer is full.
+		/// @note Only to be called from the producer thread.
+		inline bool tryPush(const T& element)
+		{
+			return this->_tryEmplace(element);
+		}
+		/// @brief Adds an element if there is space.
+		/// @param[in] element Element to add.
+		/// @return True if the element was added, false if the RingBuffer is full.
+		/// @note Only to be called from the producer thread.
+		inline bool tryPush(T&& element)
+		{
+			return this->_tryEmplace(std::move(element));
+		}
+		/// @brief Adds as many elements as there is space for.
+		/// @param[in] elements C-type array of elements to add.
+		/// @param[in] count Number of elements.
+		/// @return Number of elements that were added.
+		/// @note Only to be called from the producer thread.
+		/// @note The consumer is notified only once for the whole batch.
+		inline int tryPush(const T elements[], int count)
+		{
+			unsigned int tail = this->tail.load(std::memory_order_relaxed);
+			int result = hmin(count, this->_freeCount(tail, count));
+			for_iter (i, 0, result)
+			{
+				new (&this->elements[(tail + i) & this->mask]) T(elements[i]);
+			}
+			this->tail.store(tail + result, std::memory_order_release);
+			return result;
+		}
+		/// @brief Adds an element and waits until there is space if necessary.
+		/// @param[in] element Element to add.
+		/// @note Only to be called from the producer thread.
+		inline void push(const T& element)
+		{
+			int idleCount = 0;
+			while (!this->_tryEmplace(element))
+			{
+				Thread::backoff(idleCount);
+			}
+		}
+		/// @brief Adds an element and waits until there is space if necessary.
+		/// @param[in] element Element to add.
+		/// @note Only to be called from the producer thread.
+		inline void push(T&& element)
+		{
+			int idleCount = 0;
+			while (!this->_tryEmplace(std::move(element)))
+			{
+				Thread::backoff(idleCount);
+			}
+		}
+		/// @brief Adds elements and waits until there is space if necessary.
+		/// @param[in] elements C-type array of elements to add.
+		/// @param[in] count Number of elements.
+		/// @note Only to be called from the producer thread.
+		inline void push(const T elements[], int count)
+		{
+			int idleCount = 0;
+			int pushed = 0;
+			while (pushed < count)
+			{
+				int current = this->tryPush(elements + pushed, count - pushed);
+				if (current > 0)
+				{
+					pushed += current;
+					idleCount = 0;
+				}
+				else
+				{
+					Thread::backoff(idleCount);
+				}
+			}
+		}
+		/// @brief Removes the oldest element if there is one.
+		/// @param[out] element The removed element.
+		/// @return True if an element was removed, false if the RingBuffer is empty.
+		/// @note Only to be called from the consumer thread.
+		inline bool tryPop(T& element)
+		{
+			unsigned int head = this->head.load(std::memory_order_relaxed);
+			if (this->_usedCount(head, 1) == 0)
+			{
+				return false;
+			}
+			T& slot = this->elements[head & this->mask];
+			element = std::move(slot);
+			slot.~T();
+			this->head.store(head + 1, std::memory_order_release);
+			return true;
+		}
+		/// @brief Removes as many of the oldest elements as are available.
+		/// @param[out] elements C-type array for the removed elements.
+		/// @param[in] count Maximum number of elements to remove.
+		/// @return Number of elements that were removed.
+		/// @note Only to be called from the consumer thread.
+		/// @note The producer is notified only once for the whole batch.
+		inline int tryPop(T elements[], int count)
+		{
+			unsigned int head = this->head.load(std::memory_order_relaxed);
+			int result = hmin(count, this->_usedCount(head, count));
+			for_iter (i, 0, result)
+			{
+				T& slot = this->elements[(head + i) & this->mask];
+				elements[i] = std::move(slot);
+				slot.~T();
+			}
+			this->head.store(head + result, std::memory_order_release);
+			return result;
+		}
+		/// @brief Removes the oldest element and waits until there is one if necessary.
+		/// @return The removed element.
+		/// @note Only to be called from the consumer thread.
+		inline T pop()
+		{
+			int idleCount = 0;
+			unsigned int head = this->head.load(std::memory_order_relaxed);
+			while (this->_usedCount(head, 1) == 0)
+			{
+				Thread::backoff(idleCount);
+			}
+			T& slot = this->elements[head & this->mask];
+			T result(std::move(slot));
+			slot.~T();
+			this->head.store(head + 1, std::memory_order_release);
+			return result;
+		}
+		/// @brief Removes the oldest elements and waits until there are enough if necessary.
+		/// @param[out] elements C-type array for the removed elements.
+		/// @param[in] count Number of elements to remove.
+		/// @note Only to be called from the consumer thread.
+		inline void pop(T elements[], int count)
+		{
+			int idleCount = 0;
+			int popped = 0;
+			while (popped < count)
+			{
+				int current = this->tryPop(elements + popped, count - popped);
+				if (current > 0)
+				{
+					popped += current;
+					idleCount = 0;
+				}
+				else
+				{
+					Thread::backoff(idleCount);
+				}
+			}
+		}
+
+	protected:
+		/// @brief Elements storage.
+		T* elements;
+		/// @brief Capacity minus 1 for wrapping positions into the storage.
+		unsigned int mask;
+		/// @brief Padding so the consumer position uses its own cache line.
+		char _padding0[HLTYPES_CACHE_LINE_SIZE];
+		/// @brief Position of the next element to pop. Written only by the consumer.
+		std::atomic<unsigned int> head;
+		/// @brief Last known producer position. Used only by the consumer.
+		unsigned int cachedTail;
+		/// @brief Padding so the producer position uses its own cache line.
+		char _padding1[HLTYPES_CACHE_LINE_SIZE];
+		/// @brief Position of the next element to push. Written only by the producer.
+		std::atomic<unsigned int> tail;
+		/// @brief Last known consumer position. Used only by the producer.
+		unsigned int cachedHead;
+		/// @brief Padding so the producer position does not share a cache line with following data.
+		char _padding2[HLTYPES_CACHE_LINE_SIZE];
+
+		/// @brief Gets the number of free slots.
+		/// @param[in] tail Current producer position.
+		/// @param[in] required Number of required slots.
+		/// @return Number of free slots.
+		/// @note The consumer position is only read from shared memory if the cached one does not provide enough slots.
+		inline int _freeCount(unsigned int tail, int required)
+		{
+			int result = (int)(this->mask + 1 - (tail - this->cachedHead));
+			if (result < required)
+			{
+				this->cachedHead = this->head.load(std::memory_order_acquire);
+				result = (int)(this->mask + 1 - (tail - this->cachedHead));
+			}
+			return result;
+		}
+		/// @brief Gets the number of available elements.
+		/// @param[in] head Current consumer position.
+		/// @param[in] required Number of required elements.
+		/// @return Number of available elements.
+		/// @note The producer position is only read from shared memory if the cached one does not provide enough elements.
+		inline int _usedCount(unsigned int head, int required)
+		{
+			int result = (int)(this->cachedTail - head);
+			if (result < required)
+			{
+				this->cachedTail = this->tail.load(std::memory_order_acquire);
+				result = (int)(this->cachedTail - head);
+			}
+			return result;
+		}
+		/// @brief Constructs an element in place if there is space.
+		/// @param[in] element Element to add.
+		/// @return True if the element was added.
+		template <typename E>
+		inline bool _tryEmplace(E&& element)
+		{
+			unsigned int tail = this->tail.load(std::memory_order_relaxed);
+			if (this->_freeCount(tail, 1) == 0)
+			{
+				return false;
+			}
+			new (&this->elements[tail & this->mask]) T(std::forward<E>(element));
+			this->tail.store(tail + 1, std::memory_order_release);
+			return true;
+		}
+
+	private:
+		/// @brief Copy constructor.
+		/// @note Usage is not allowed and it will throw an exception.
+		inline RingBuffer(const RingBuffer& other)
+		{
+			throw ObjectCannotCopyException("hltypes::RingBuffer");
+		}
+		/// @brief Assignment operator.
+		/// @note Usage is not allowed and it will throw an exception.
+		inline RingBuffer& operator=(RingBuffer& other)
+		{
+			throw ObjectCannotAssignException("hltypes::RingBuffer");
+			return (*this);
+		}
+
+	};
+
+}
+
+/// @brief Alias for simpler code.
+#define hringbuffer hltypes::RingBuffer
+
+#endif
@@ -15,16 +15,36 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <type_traits>
 
 #include "harray.h"
 #include "henum.h"
+#include "hexception.h"
 #include "hltypesExport.h"
+#include "hmap.h"
+#include "hspan.h"
 #include "hstring.h"
 
 namespace hltypes
 {
+	class BitArray;
 	class Stream;
-	template <typename T> class Array;
+	template <typename T, typename A> class Array;
+
+	/// @brief Whether values of a type are written to streams as one raw block instead of value by value.
+	/// @note bool is excluded since Array<bool> does not store its values contiguously.
+	template <typename T>
+	struct _StreamRawValue
+	{
+		static const bool value = (std::is_arithmetic<T>::value && !std::is_same<T, bool>::value);
+	};
+	/// @brief The smallest number of bytes a value of a type takes up in a stream.
+	/// @note Strings and containers start with an int32 size.
+	template <typename T>
+	struct _StreamMinValueSize
+	{
+		static const int value = (_StreamRawValue<T>::value ? (int)sizeof(T) : (std::is_same<T, bool>::value ? 1 : 4));
+	};
 
 	/// @brief Provides a base class for streaming.
 	class hltypesExport StreamBase
@@ -76,6 +96,7 @@ namespace hltypes
 		/// @return The read string.
 		/// @note Delimiter String is not included in return result.
 		/// @note When delimiter is omitted, the file will be read until EOF.
+		/// @note Data read past the delimiter is skipped back with a seek. Use LineReader to read many lines without that.
 		String read(const String& delimiter = "");
 		/// @brief Reads n bytes from the stream.
 		/// @param[in] count Number of bytes to read.
@@ -84,6 +105,7 @@ namespace hltypes
 		/// @brief Reads one line from the stream.
 		/// @return The read line.
 		/// @note \\n is not included in the returned String.
+		/// @see LineReader
 		String readLine();
 		/// @brief Reads all lines from the stream.
 		/// @return Array with read lines.
@@ -110,31 +132,49 @@ namespace hltypes
 		/// @param[in] count Number of bytes to read.
 		/// @return Number of bytes read.
 		/// @note If return value differs from parameter count, it can indicate a reading error or that end of file has been reached.
-		int readRaw(void* buffer, int count);
+		/// @note Data larger than 2 GB is read in several chunks.
+		int64_t readRaw(void* buffer, int64_t count);
+		/// @brief Reads raw data from the stream.
+		/// @param[out] buffer Span of the raw data buffer. Its size is the number of bytes to read.
+		/// @return Number of bytes read.
+		/// @note If return value differs from the size of buffer, it can indicate a reading error or that end of file has been reached.
+		int readRaw(Span<unsigned char> buffer);
 		/// @brief Writes raw data to the stream.
 		/// @param[in] buffer Pointer to raw data buffer.
 		/// @param[in] count Number of bytes to write.
 		/// @return Number of bytes written.
 		/// @note If return value differs from parameter count, it can indicate a writing error.
-		virtual int writeRaw(void* buffer, int count);
+		/// @note Data larger than 2 GB is written in several chunks.
+		virtual int64_t writeRaw(void* buffer, int64_t count);
 		/// @brief Writes raw data to the stream from another stream.
 		/// @param[in] stream Another stream.
 		/// @param[in] count Number of bytes to write.
 		/// @return Number of bytes written.
-		virtual int writeRaw(StreamBase& stream, int count);
+		/// @note The position of the other stream does not change.
+		virtual int64_t writeRaw(StreamBase& stream, int64_t count);
 		/// @brief Writes raw data to the stream from another stream.
 		/// @param[in] stream Another stream.
 		/// @return Number of bytes written.
-		virtual int writeRaw(StreamBase& stream);
+		virtual int64_t writeRaw(StreamBase& stream);
 		/// @brief Writes raw data to the stream from another stream.
 		/// @param[in] stream Another stream.
 		/// @param[in] count Number of bytes to write.
 		/// @return Number of bytes written.
-		virtual int writeRaw(Stream& stream, int count);
+		virtual int64_t writeRaw(Stream& stream, int64_t count);
 		/// @brief Writes raw data to the stream from another stream.
 		/// @param[in] stream Another stream.
 		/// @return Number of bytes written.
-		virtual int writeRaw(Stream& stream);
+		virtual int64_t writeRaw(Stream& stream);
+		/// @brief Writes raw data to the stream.
+		/// @param[in] buffer Span of the raw data.
+		/// @return Number of bytes written.
+		/// @note Array<unsigned char>, Stream and C-type arrays convert to the Span.
+		virtual int writeRaw(Span<const unsigned char> buffer);
+		/// @brief Writes several separate buffers of raw data to the stream one after another.
+		/// @param[in] buffers Spans of the raw data.
+		/// @return Number of bytes written.
+		/// @note Streams that support vectored I/O write all buffers with one operation instead of one for each buffer.
+		virtual int64_t writeRawVectored(Span<const Span<const unsigned char> > buffers);
 
 		/// @brief Dumps data to file in a platform-aware format.
 		/// @param c char to dump.
@@ -177,6 +217,63 @@ namespace hltypes
 		/// @brief Dumps data to file in a platform-aware format.
 		/// @param c C-type string to dump.
 		virtual void dump(const char* c);
+		/// @brief Dumps data to file in a platform-aware format.
+		/// @param bitArray BitArray to dump.
+		/// @note The 64 bit words are written at once on little-endian platforms.
+		virtual void dump(const BitArray& bitArray);
+		/// @brief Dumps an Array to file in a platform-aware format.
+		/// @param[in] array Array to dump.
+		/// @note Writes the number of elements and then the elements. Numeric elements are written with one operation.
+		template <typename T, typename A>
+		inline void dump(const Array<T, A>& array)
+		{
+			this->dump(array.size());
+			this->_dumpValues(array, std::integral_constant<bool, _StreamRawValue<T>::value>());
+		}
+		/// @brief Dumps a Map to file in a platform-aware format.
+		/// @param[in] map Map to dump.
+		/// @note Writes the number of pairs, then all keys and then all values. Numeric keys and values are written with one operation each.
+		template <typename K, typename V, typename A>
+		inline void dump(const Map<K, V, A>& map)
+		{
+			this->dump((int)map.size());
+			this->_dumpValues(map.keys(), std::integral_constant<bool, _StreamRawValue<K>::value>());
+			this->_dumpValues(map.values(), std::integral_constant<bool, _StreamRawValue<V>::value>());
+		}
+		/// @brief Dumps numeric values to file in a platform-aware format with one operation.
+		/// @param[in] data Span of the values.
+		/// @return Number of values written.
+		/// @note The number of values is not written. Use loadRaw() with the same number of values to read them.
+		/// @note On big-endian platforms the values are byte-swapped in chunks before writing.
+		template <typename T>
+		inline int dumpRaw(Span<T> data)
+		{
+			static_assert(std::is_arithmetic<typename std::remove_const<T>::type>::value, "dumpRaw() only supports numeric types.");
+			return this->_dumpRaw(data.data(), data.size(), (int)sizeof(T));
+		}
+		/// @brief Dumps an unsigned integer as a LEB128 varint.
+		/// @param[in] value The value.
+		/// @note Every byte holds 7 bits of the value so values below 128 take 1 byte and the largest values take 10 bytes.
+		void dumpVarint(uint64_t value);
+		/// @brief Dumps a signed integer as a zigzag-encoded LEB128 varint.
+		/// @param[in] value The value.
+		/// @note Zigzag encoding maps small negative values to small unsigned values so they stay short as well.
+		void dumpZigzag(int64_t value);
+		/// @brief Dumps many unsigned integers as LEB128 varints.
+		/// @param[in] values Span of the values.
+		/// @note The values are encoded into a buffer first and written in a few large chunks.
+		void dumpVarints(Span<const uint64_t> values);
+		/// @brief Dumps many signed integers as zigzag-encoded LEB128 varints.
+		/// @param[in] values Span of the values.
+		/// @note The values are encoded into a buffer first and written in a few large chunks.
+		void dumpZigzags(Span<const int64_t> values);
+		/// @brief Dumps raw data with its size as a varint in front.
+		/// @param[in] data Span of the data.
+		void dumpBlob(Span<const unsigned char> data);
+		/// @brief Dumps a String with its size as a varint in front.
+		/// @param[in] string String to dump.
+		/// @note Unlike dump(), short strings need only 1 byte for the size instead of 4.
+		void dumpVarintString(const String& string);
 
 		/// @brief Loads data from file in a platform-aware format.
 		/// @return Loaded char.
@@ -214,6 +311,76 @@ namespace hltypes
 		/// @brief Loads data from file in a platform-aware format.
 		/// @return Loaded String.
 		virtual String loadString();
+		/// @brief Loads data from file in a platform-aware format.
+		/// @return Loaded BitArray.
+		virtual BitArray loadBitArray();
+		/// @brief Loads an Array from file in a platform-aware format.
+		/// @return Loaded Array.
+		/// @note The data has to have been written with dump() of an Array with the same element type.
+		template <typename T>
+		inline Array<T> loadArray()
+		{
+			this->_validate();
+			int count = this->_loadCount(_StreamMinValueSize<T>::value);
+			Array<T> result;
+			this->_loadValues(result, count, std::integral_constant<bool, _StreamRawValue<T>::value>());
+			return result;
+		}
+		/// @brief Loads a Map from file in a platform-aware format.
+		/// @return Loaded Map.
+		/// @note The data has to have been written with dump() of a Map with the same key and value types.
+		template <typename K, typename V>
+		inline Map<K, V> loadMap()
+		{
+			this->_validate();
+			int count = this->_loadCount(_StreamMinValueSize<K>::value + _StreamMinValueSize<V>::value);
+			Array<K> keys;
+			Array<V> values;
+			this->_loadValues(keys, count, std::integral_constant<bool, _StreamRawValue<K>::value>());
+			this->_loadValues(values, count, std::integral_constant<bool, _StreamRawValue<V>::value>());
+			Map<K, V> result;
+			// keys were written in order so every insertion happens at the end
+			for_iter (i, 0, count)
+			{
+				result.emplace_hint(result.end(), keys[i], values[i]);
+			}
+			return result;
+		}
+		/// @brief Loads numeric values from file in a platform-aware format with one operation.
+		/// @param[out] data Span of the values. Its size is the number of values to read.
+		/// @return Number of values read.
+		/// @note The data has to have been written with dumpRaw().
+		template <typename T>
+		inline int loadRaw(Span<T> data)
+		{
+			static_assert(std::is_arithmetic<T>::value, "loadRaw() only supports numeric types.");
+			return this->_loadRaw(data.data(), data.size(), (int)sizeof(T));
+		}
+		/// @brief Loads an unsigned integer that was stored as a LEB128 varint.
+		/// @return Loaded value.
+		/// @note Throws an exception if the varint is invalid or incomplete.
+		uint64_t loadVarint();
+		/// @brief Loads a signed integer that was stored as a zigzag-encoded LEB128 varint.
+		/// @return Loaded value.
+		/// @note Throws an exception if the varint is invalid or incomplete.
+		int64_t loadZigzag();
+		/// @brief Loads many unsigned integers that were stored as LEB128 varints.
+		/// @param[out] values Span of the values. Its size is the number of values to read.
+		/// @return Number of values read. It is smaller than the size of values if the end of the stream has been reached.
+		/// @note The data is read in large chunks and decoded from memory. Data that was read past the last value is skipped back with a seek.
+		/// @note Throws an exception if a varint is invalid.
+		int loadVarints(Span<uint64_t> values);
+		/// @brief Loads many signed integers that were stored as zigzag-encoded LEB128 varints.
+		/// @param[out] values Span of the values. Its size is the number of values to read.
+		/// @return Number of values read. It is smaller than the size of values if the end of the stream has been reached.
+		/// @see loadVarints()
+		int loadZigzags(Span<int64_t> values);
+		/// @brief Loads raw data that was stored with dumpBlob().
+		/// @return Loaded data.
+		Array<unsigned char> loadBlob();
+		/// @brief Loads a String that was stored with dumpVarintString().
+		/// @return Loaded String.
+		String loadVarintString();
 		
 	protected:
 		/// @brief Data size, mostly used for optimization and faster "eof" detection.
@@ -249,6 +416,79 @@ namespace hltypes
 		/// @return True if successful.
 		virtual bool _seek(int64_t offset, SeekMode seekMode = SeekMode::Current) = 0;
 
+		/// @brief Writes numeric values in little-endian byte order.
+		/// @param[in] data The values.
+		/// @param[in] count Number of values.
+		/// @param[in] elementSize Size of each value in bytes.
+		/// @return Number of values written.
+		int _dumpRaw(const void* data, int count, int elementSize);
+		/// @brief Reads numeric values that are in little-endian byte order.
+		/// @param[out] data The values.
+		/// @param[in] count Number of values.
+		/// @param[in] elementSize Size of each value in bytes.
+		/// @return Number of values read.
+		int _loadRaw(void* data, int count, int elementSize);
+		/// @brief Writes unsigned integers as LEB128 varints.
+		/// @param[in] values The values.
+		/// @param[in] count Number of values.
+		/// @param[in] zigzag Whether the values are signed and have to be zigzag-encoded first.
+		void _dumpVarints(const uint64_t* values, int count, bool zigzag);
+		/// @brief Reads the size in front of a blob and checks it against the remaining data.
+		/// @return The size of the blob.
+		int _loadBlobSize();
+		/// @brief Reads the number of elements in front of a container and checks it against the remaining data.
+		/// @param[in] elementSize The smallest number of bytes one element takes up in the stream.
+		/// @return The number of elements.
+		int _loadCount(int elementSize);
+		/// @brief Writes all elements of an Array with one operation.
+		template <typename T, typename A>
+		inline void _dumpValues(const Array<T, A>& array, std::true_type raw)
+		{
+			if (array.size() > 0)
+			{
+				this->dumpRaw(Span<const T>(&array[0], array.size()));
+			}
+		}
+		/// @brief Writes all elements of an Array one by one.
+		template <typename T, typename A>
+		inline void _dumpValues(const Array<T, A>& array, std::false_type raw)
+		{
+			for_iter (i, 0, array.size())
+			{
+				this->dump(array[i]);
+			}
+		}
+		/// @brief Reads elements into an Array with one operation.
+		template <typename T, typename A>
+		inline void _loadValues(Array<T, A>& array, int count, std::true_type raw)
+		{
+			array.add(T(), count);
+			if (count > 0 && this->loadRaw(Span<T>(&array[0], count)) != count)
+			{
+				throw Exception("Array data in stream is incomplete");
+			}
+		}
+		/// @brief Reads elements into an Array one by one.
+		template <typename T, typename A>
+		inline void _loadValues(Array<T, A>& array, int count, std::false_type raw)
+		{
+			array.reserve(count);
+			T value = T();
+			for_iter (i, 0, count)
+			{
+				this->_loadValue(value);
+				array.add(value);
+			}
+		}
+		/// @brief Loads a single value that is not written as a raw block.
+		inline void _loadValue(bool& value) { value = this->loadBool(); }
+		inline void _loadValue(String& value) { value = this->loadString(); }
+		void _loadValue(BitArray& value);
+		template <typename T, typename A>
+		inline void _loadValue(Array<T, A>& value) { value = this->loadArray<T>(); }
+		template <typename K, typename V, typename A>
+		inline void _loadValue(Map<K, V, A>& value) { value = this->loadMap<K, V>(); }
+
 	private:
 		/// @brief Copy constructor.
 		/// @note Usage is not allowed and it will throw an exception.
@@ -0,0 +1,449 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+///
+/// @section DESCRIPTION
+///
+/// Provides vectorized kernels for searching and reducing contiguous arithmetic data.
+
+#ifndef HLTYPES_SIMD_H
+#define HLTYPES_SIMD_H
+
+#include <stdint.h>
+#include <string.h>
+#include <type_traits>
+
+#include "hltypesUtil.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#if !defined(HLTYPES_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define HLTYPES_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+/// @brief Number of elements processed per block in the generic kernels.
+/// @note The inner loops over a block have no early exits so compilers can vectorize them.
+#define HLTYPES_SIMD_BLOCK 16
+
+namespace hltypes
+{
+	/// @brief Defines the type used for the sum of elements of type T.
+	/// @note Integers are summed up in 64 bits and floating point values in double precision.
+	template <typename T, bool Arithmetic = std::is_arithmetic<T>::value, bool Integral = std::is_integral<T>::value, bool Signed = std::is_signed<T>::value>
+	struct _SumType
+	{
+		typedef T type;
+	};
+	template <typename T>
+	struct _SumType<T, true, true, true>
+	{
+		typedef int64_t type;
+	};
+	template <typename T>
+	struct _SumType<T, true, true, false>
+	{
+		typedef uint64_t type;
+	};
+	template <typename T, bool Signed>
+	struct _SumType<T, true, false, Signed>
+	{
+		typedef double type;
+	};
+
+	/// @brief Finds the first occurrence of a value.
+	/// @param[in] data The data.
+	/// @param[in] size Number of elements.
+	/// @param[in] value Value to search for.
+	/// @return Index of the value or -1 if it could not be found.
+	template <typename T>
+	inline int _simdIndexOf(const T* data, int size, const T& value)
+	{
+		int i = 0;
+		bool found = false;
+		for (; i + HLTYPES_SIMD_BLOCK <= size; i += HLTYPES_SIMD_BLOCK)
+		{
+			for_iter (j, 0, HLTYPES_SIMD_BLOCK)
+			{
+				found |= (data[i + j] == value);
+			}
+			if (found)
+			{
+				break;
+			}
+		}
+		for (; i < size; ++i)
+		{
+			if (data[i] == value)
+			{
+				return i;
+			}
+		}
+		return -1;
+	}
+	/// @brief Counts the occurrences of a value.
+	/// @param[in] data The data.
+	/// @param[in] size Number of elements.
+	/// @param[in] value Value to search for.
+	/// @return Number of occurrences.
+	template <typename T>
+	inline int _simdCount(const T* data, int size, const T& value)
+	{
+		int result = 0;
+		for_iter (i, 0, size)
+		{
+			result += (data[i] == value ? 1 : 0);
+		}
+		return result;
+	}
+	/// @brief Compares two blocks of data for being equal.
+	/// @param[in] data The data.
+	/// @param[in] other The other data.
+	/// @param[in] size Number of elements.
+	/// @return True if all pairs of elements are equal.
+	/// @note Integers are compared with memcmp(), floating point values with operator== so that 0.0 equals -0.0 and NaN never equals anything.
+	template <typename T>
+	inline bool _simdEquals(const T* data, const T* other, int size)
+	{
+		if (size <= 0)
+		{
+			return true;
+		}
+		if (std::is_integral<T>::value)
+		{
+			return (memcmp(data, other, (size_t)size * sizeof(T)) == 0);
+		}
+		int i = 0;
+		bool different = false;
+		for (; i + HLTYPES_SIMD_BLOCK <= size; i += HLTYPES_SIMD_BLOCK)
+		{
+			for_iter (j, 0, HLTYPES_SIMD_BLOCK)
+			{
+				different |= !(data[i + j] == other[i + j]);
+			}
+			if (different)
+			{
+				return false;
+			}
+		}
+		for (; i < size; ++i)
+		{
+			if (!(data[i] == other[i]))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+	/// @brief Finds the minimum and maximum values.
+	/// @param[in] data The data.
+	/// @param[in] size Number of elements. Has to be greater than 0.
+	/// @param[out] minimum The minimum value.
+	/// @param[out] maximum The maximum value.
+	template <typename T>
+	inline void _simdMinMax(const T* data, int size, T& minimum, T& maximum)
+	{
+		int i = 0;
+		if (size >= HLTYPES_SIMD_BLOCK)
+		{
+			T minimums[HLTYPES_SIMD_BLOCK];
+			T maximums[HLTYPES_SIMD_BLOCK];
+			for_iter (j, 0, HLTYPES_SIMD_BLOCK)
+			{
+				minimums[j] = maximums[j] = data[j];
+			}
+			for (i = HLTYPES_SIMD_BLOCK; i + HLTYPES_SIMD_BLOCK <= size; i += HLTYPES_SIMD_BLOCK)
+			{
+				for_iter (j, 0, HLTYPES_SIMD_BLOCK)
+				{
+					minimums[j] = (data[i + j] < minimums[j] ? data[i + j] : minimums[j]);
+					maximums[j] = (maximums[j] < data[i + j] ? data[i + j] : maximums[j]);
+				}
+			}
+			minimum = minimums[0];
+			maximum = maximums[0];
+			for_iter (j, 1, HLTYPES_SIMD_BLOCK)
+			{
+				minimum = (minimums[j] < minimum ? minimums[j] : minimum);
+				maximum = (maximum < maximums[j] ? maximums[j] : maximum);
+			}
+		}
+		else
+		{
+			minimum = maximum = data[0];
+			i = 1;
+		}
+		for (; i < size; ++i)
+		{
+			minimum = (data[i] < minimum ? data[i] : minimum);
+			maximum = (maximum < data[i] ? data[i] : maximum);
+		}
+	}
+	/// @brief Calculates the sum of all values.
+	/// @param[in] data The data.
+	/// @param[in] size Number of elements.
+	/// @return The sum.
+	template <typename T>
+	inline typename _SumType<T>::type _simdSum(const T* data, int size)
+	{
+		typedef typename _SumType<T>::type S;
+		S sums[HLTYPES_SIMD_BLOCK];
+		for_iter (j, 0, HLTYPES_SIMD_BLOCK)
+		{
+			sums[j] = (S)0;
+		}
+		int i = 0;
+		for (; i + HLTYPES_SIMD_BLOCK <= size; i += HLTYPES_SIMD_BLOCK)
+		{
+			for_iter (j, 0, HLTYPES_SIMD_BLOCK)
+			{
+				sums[j] += (S)data[i + j];
+			}
+		}
+		S result = (S)0;
+		for_iter (j, 0, HLTYPES_SIMD_BLOCK)
+		{
+			result += sums[j];
+		}
+		for (; i < size; ++i)
+		{
+			result += (S)data[i];
+		}
+		return result;
+	}
+	/// @brief Counts the set bits of a 64 bit word.
+	/// @param[in] value The word.
+	/// @return Number of set bits.
+	inline int _bitCount64(uint64_t value)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		return __builtin_popcountll(value);
+#else
+		value -= (value >> 1) & 0x5555555555555555ULL;
+		value = (value & 0x3333333333333333ULL) + ((value >> 2) & 0x3333333333333333ULL);
+		value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+		return (int)((value * 0x0101010101010101ULL) >> 56);
+#endif
+	}
+	/// @brief Finds the lowest set bit of a 64 bit word.
+	/// @param[in] value The word.
+	/// @return Index of the lowest set bit.
+	/// @note value must not be 0.
+	inline int _bitScanForward64(uint64_t value)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		return __builtin_ctzll(value);
+#elif defined(_MSC_VER)
+		unsigned long index = 0;
+		if (_BitScanForward(&index, (unsigned long)(value & 0xFFFFFFFF)))
+		{
+			return (int)index;
+		}
+		_BitScanForward(&index, (unsigned long)(value >> 32));
+		return (int)index + 32;
+#else
+		int result = 0;
+		while ((value & 1) == 0)
+		{
+			value >>= 1;
+			++result;
+		}
+		return result;
+#endif
+	}
+
+#ifdef HLTYPES_SIMD_SSE2
+	/// @brief Adds up the 32 bit lanes of a vector.
+	/// @param[in] value The vector.
+	/// @return The sum of the lanes.
+	inline int _simdHorizontalSum(__m128i value)
+	{
+		value = _mm_add_epi32(value, _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2)));
+		value = _mm_add_epi32(value, _mm_shuffle_epi32(value, _MM_SHUFFLE(2, 3, 0, 1)));
+		return _mm_cvtsi128_si32(value);
+	}
+	/// @brief Finds the first occurrence of a 32 bit value.
+	/// @param[in] data The data.
+	/// @param[in] size Number of elements.
+	/// @param[in] value Value to search for.
+	/// @return Index of the value or -1 if it could not be found.
+	inline int _simdIndexOf32(const int32_t* data, int size, int32_t value)
+	{
+		__m128i needle = _mm_set1_epi32(value);
+		__m128i matches;
+		int i = 0;
+		for (; i + 16 <= size; i += 16)
+		{
+			matches = _mm_or_si128(
+				_mm_or_si128(_mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(data + i)), needle), _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(data + i + 4)), needle)),
+				_mm_or_si128(_mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(data + i + 8)), needle), _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(data + i + 12)), needle)));
+			if (_mm_movemask_epi8(matches) != 0)
+			{
+				break;
+			}
+		}
+		for (; i < size; ++i)
+		{
+			if (data[i] == value)
+			{
+				return i;
+			}
+		}
+		return -1;
+	}
+	/// @brief Counts the occurrences of a 32 bit value.
+	/// @param[in] data The data.
+	/// @param[in] size Number of elements.
+	/// @param[in] value Value to search for.
+	/// @return Number of occurrences.
+	inline int _simdCount32(const int32_t* data, int size, int32_t value)
+	{
+		__m128i needle = _mm_set1_epi32(value);
+		__m128i counts = _mm_setzero_si128();
+		int i = 0;
+		for (; i + 4 <= size; i += 4)
+		{
+			// matching lanes are -1
+			counts = _mm_sub_epi32(counts, _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(data + i)), needle));
+		}
+		int result = _simdHorizontalSum(counts);
+		for (; i < size; ++i)
+		{
+			result += (data[i] == value ? 1 : 0);
+		}
+		return result;
+	}
+	/// @brief Finds the first occurrence of a byte.
+	/// @param[in] data The data.
+	/// @param[in] size Number of elements.
+	/// @param[in] value Value to search for.
+	/// @return Index of the value or -1 if it could not be found.
+	inline int _simdIndexOf8(const unsigned char* data, int size, unsigned char value)
+	{
+		const void* result = memchr(data, value, size);
+		return (result != NULL ? (int)((const unsigned char*)result - data) : -1);
+	}
+	/// @brief Counts the occurrences of a byte.
+	/// @param[in] data The data.
+	/// @param[in] size Number of elements.
+	/// @param[in] value Value to search for.
+	/// @return Number of occurrences.
+	inline int _simdCount8(const unsigned char* data, int size, unsigned char value)
+	{
+		__m128i needle = _mm_set1_epi8((char)value);
+		__m128i zero = _mm_setzero_si128();
+		__m128i totals = _mm_setzero_si128();
+		__m128i counts;
+		int i = 0;
+		int blockEnd = 0;
+		while (i + 16 <= size)
+		{
+			// byte counters overflow after 255 iterations
+			counts = _mm_setzero_si128();
+			blockEnd = hmin(i + 255 * 16, size - size % 16);
+			for (; i < blockEnd; i += 16)
+			{
+				counts = _mm_sub_epi8(counts, _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(data + i)), needle));
+			}
+			totals = _mm_add_epi64(totals, _mm_sad_epu8(counts, zero));
+		}
+		int result = _mm_cvtsi128_si32(totals) + _mm_cvtsi128_si32(_mm_unpackhi_epi64(totals, totals));
+		for (; i < size; ++i)
+		{
+			result += (data[i] == value ? 1 : 0);
+		}
+		return result;
+	}
+	/// @brief Finds the minimum and maximum 32 bit signed values.
+	/// @param[in] data The data.
+	/// @param[in] size Number of elements. Has to be greater than 0.
+	/// @param[out] minimum The minimum value.
+	/// @param[out] maximum The maximum value.
+	inline void _simdMinMax32(const int32_t* data, int size, int32_t& minimum, int32_t& maximum)
+	{
+		int i = 0;
+		minimum = maximum = data[0];
+		if (size >= 4)
+		{
+			__m128i minimums = _mm_loadu_si128((const __m128i*)data);
+			__m128i maximums = minimums;
+			__m128i values;
+			__m128i mask;
+			for (i = 4; i + 4 <= size; i += 4)
+			{
+				values = _mm_loadu_si128((const __m128i*)(data + i));
+				mask = _mm_cmpgt_epi32(minimums, values);
+				minimums = _mm_or_si128(_mm_and_si128(mask, values), _mm_andnot_si128(mask, minimums));
+				mask = _mm_cmpgt_epi32(values, maximums);
+				maximums = _mm_or_si128(_mm_and_si128(mask, values), _mm_andnot_si128(mask, maximums));
+			}
+			int32_t lanes[4];
+			_mm_storeu_si128((__m128i*)lanes, minimums);
+			minimum = hmin(hmin(lanes[0], lanes[1]), hmin(lanes[2], lanes[3]));
+			_mm_storeu_si128((__m128i*)lanes, maximums);
+			maximum = hmax(hmax(lanes[0], lanes[1]), hmax(lanes[2], lanes[3]));
+		}
+		for (; i < size; ++i)
+		{
+			minimum = hmin(minimum, data[i]);
+			maximum = hmax(maximum, data[i]);
+		}
+	}
+	/// @brief Finds the minimum and maximum float values.
+	/// @param[in] data The data.
+	/// @param[in] size Number of elements. Has to be greater than 0.
+	/// @param[out] minimum The minimum value.
+	/// @param[out] maximum The maximum value.
+	/// @note The result is unspecified if there are NaN values.
+	inline void _simdMinMaxFloat(const float* data, int size, float& minimum, float& maximum)
+	{
+		int i = 0;
+		minimum = maximum = data[0];
+		if (size >= 4)
+		{
+			__m128 minimums = _mm_loadu_ps(data);
+			__m128 maximums = minimums;
+			__m128 values;
+			for (i = 4; i + 4 <= size; i += 4)
+			{
+				values = _mm_loadu_ps(data + i);
+				minimums = _mm_min_ps(minimums, values);
+				maximums = _mm_max_ps(maximums, values);
+			}
+			float lanes[4];
+			_mm_storeu_ps(lanes, minimums);
+			minimum = hmin(hmin(lanes[0], lanes[1]), hmin(lanes[2], lanes[3]));
+			_mm_storeu_ps(lanes, maximums);
+			maximum = hmax(hmax(lanes[0], lanes[1]), hmax(lanes[2], lanes[3]));
+		}
+		for (; i < size; ++i)
+		{
+			minimum = hmin(minimum, data[i]);
+			maximum = hmax(maximum, data[i]);
+		}
+	}
+
+	/// @brief Overloads that select the SSE2 kernels for the supported types.
+	inline int _simdIndexOf(const int* data, int size, const int& value) { return _simdIndexOf32((const int32_t*)data, size, (int32_t)value); }
+	inline int _simdIndexOf(const unsigned int* data, int size, const unsigned int& value) { return _simdIndexOf32((const int32_t*)data, size, (int32_t)value); }
+	inline int _simdIndexOf(const char* data, int size, const char& value) { return _simdIndexOf8((const unsigned char*)data, size, (unsigned char)value); }
+	inline int _simdIndexOf(const signed char* data, int size, const signed char& value) { return _simdIndexOf8((const unsigned char*)data, size, (unsigned char)value); }
+	inline int _simdIndexOf(const unsigned char* data, int size, const unsigned char& value) { return _simdIndexOf8(data, size, value); }
+	inline int _simdCount(const int* data, int size, const int& value) { return _simdCount32((const int32_t*)data, size, (int32_t)value); }
+	inline int _simdCount(const unsigned int* data, int size, const unsigned int& value) { return _simdCount32((const int32_t*)data, size, (int32_t)value); }
+	inline int _simdCount(const char* data, int size, const char& value) { return _simdCount8((const unsigned char*)data, size, (unsigned char)value); }
+	inline int _simdCount(const signed char* data, int size, const signed char& value) { return _simdCount8((const unsigned char*)data, size, (unsigned char)value); }
+	inline int _simdCount(const unsigned char* data, int size, const unsigned char& value) { return _simdCount8(data, size, value); }
+	inline void _simdMinMax(const int* data, int size, int& minimum, int& maximum) { _simdMinMax32((const int32_t*)data, size, (int32_t&)minimum, (int32_t&)maximum); }
+	inline void _simdMinMax(const float* data, int size, float& minimum, float& maximum) { _simdMinMaxFloat(data, size, minimum, maximum); }
+#endif
+
+}
+
+#endif
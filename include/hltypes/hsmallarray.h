@@ -0,0 +1,615 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+///
+/// @section DESCRIPTION
+///
+/// Provides an array that stores a small number of elements inline and adds high level methods.
+
+#ifndef HLTYPES_SMALL_ARRAY_H
+#define HLTYPES_SMALL_ARRAY_H
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "harray.h"
+#include "hcontainer.h"
+#include "hexception.h"
+#include "hltypesUtil.h"
+#include "hstring.h"
+
+namespace hltypes
+{
+	/// @brief std::vector-like storage that keeps up to N elements in an inline buffer and spills to the heap beyond that.
+	/// @note Only the subset of the std::vector interface used by Container is provided.
+	template <typename T, int N>
+	class _SmallVector
+	{
+	public:
+		static_assert(N > 0, "The inline capacity of _SmallVector must be positive.");
+
+		typedef T value_type;
+		typedef T* iterator;
+		typedef const T* const_iterator;
+		typedef std::reverse_iterator<iterator> reverse_iterator;
+		typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+		typedef size_t size_type;
+		typedef std::allocator<T> allocator_type;
+
+		inline _SmallVector() : elements((T*)&this->buffer), count(0), limit(N)
+		{
+		}
+		inline explicit _SmallVector(const allocator_type& allocator) : elements((T*)&this->buffer), count(0), limit(N)
+		{
+		}
+		inline _SmallVector(const _SmallVector& other) : elements((T*)&this->buffer), count(0), limit(N)
+		{
+			this->insert(this->end(), other.begin(), other.end());
+		}
+		inline _SmallVector(_SmallVector&& other) : elements((T*)&this->buffer), count(0), limit(N)
+		{
+			this->_take(other);
+		}
+		inline ~_SmallVector()
+		{
+			this->clear();
+			this->_release();
+		}
+		inline _SmallVector& operator=(const _SmallVector& other)
+		{
+			if (this != &other)
+			{
+				this->clear();
+				this->insert(this->end(), other.begin(), other.end());
+			}
+			return (*this);
+		}
+		inline _SmallVector& operator=(_SmallVector&& other)
+		{
+			if (this != &other)
+			{
+				this->clear();
+				this->_release();
+				this->_take(other);
+			}
+			return (*this);
+		}
+
+		inline allocator_type get_allocator() const { return allocator_type(); }
+		inline size_type size() const { return (size_type)this->count; }
+		inline bool empty() const { return (this->count == 0); }
+		inline size_type capacity() const { return (size_type)this->limit; }
+		inline bool isInline() const { return (this->elements == (T*)&this->buffer); }
+		inline T* data() { return this->elements; }
+		inline const T* data() const { return this->elements; }
+		inline iterator begin() { return this->elements; }
+		inline const_iterator begin() const { return this->elements; }
+		inline iterator end() { return (this->elements + this->count); }
+		inline const_iterator end() const { return (this->elements + this->count); }
+		inline reverse_iterator rbegin() { return reverse_iterator(this->end()); }
+		inline const_reverse_iterator rbegin() const { return const_reverse_iterator(this->end()); }
+		inline reverse_iterator rend() { return reverse_iterator(this->begin()); }
+		inline const_reverse_iterator rend() const { return const_reverse_iterator(this->begin()); }
+		inline T& front() { return this->elements[0]; }
+		inline const T& front() const { return this->elements[0]; }
+		inline T& back() { return this->elements[this->count - 1]; }
+		inline const T& back() const { return this->elements[this->count - 1]; }
+
+		inline void reserve(size_type size)
+		{
+			if ((int)size > this->limit)
+			{
+				this->_commit(this->_allocate((int)size), (int)size, 0);
+			}
+		}
+		inline void shrink_to_fit()
+		{
+			if (this->isInline() || this->count == this->limit)
+			{
+				return;
+			}
+			if (this->count <= N)
+			{
+				this->_commit((T*)&this->buffer, N, 0);
+			}
+			else
+			{
+				this->_commit(this->_allocate(this->count), this->count, 0);
+			}
+		}
+		inline void clear()
+		{
+			this->_destroy(this->elements, this->elements + this->count);
+			this->count = 0;
+		}
+		inline void push_back(const T& element)
+		{
+			this->emplace_back(element);
+		}
+		inline void push_back(T&& element)
+		{
+			this->emplace_back(std::move(element));
+		}
+		template <typename... Args>
+		inline void emplace_back(Args&&... args)
+		{
+			// the new element is constructed before existing elements are moved in case args refer to one of them
+			int newLimit = this->_grownLimit(1);
+			T* data = (newLimit != this->limit ? this->_allocate(newLimit) : this->elements);
+			new (data + this->count) T(std::forward<Args>(args)...);
+			this->_commit(data, newLimit, 1);
+		}
+		inline void pop_back()
+		{
+			--this->count;
+			this->elements[this->count].~T();
+		}
+		template <typename... Args>
+		inline iterator emplace(const_iterator position, Args&&... args)
+		{
+			int index = (int)(position - this->elements);
+			this->emplace_back(std::forward<Args>(args)...);
+			std::rotate(this->elements + index, this->elements + (this->count - 1), this->elements + this->count);
+			return (this->elements + index);
+		}
+		inline iterator insert(const_iterator position, const T& element)
+		{
+			return this->emplace(position, element);
+		}
+		inline iterator insert(const_iterator position, T&& element)
+		{
+			return this->emplace(position, std::move(element));
+		}
+		inline iterator insert(const_iterator position, size_type times, const T& element)
+		{
+			int index = (int)(position - this->elements);
+			int amount = (int)times;
+			if (amount > 0)
+			{
+				int newLimit = this->_grownLimit(amount);
+				T* data = (newLimit != this->limit ? this->_allocate(newLimit) : this->elements);
+				std::uninitialized_fill_n(data + this->count, amount, element);
+				this->_commit(data, newLimit, amount);
+				std::rotate(this->elements + index, this->elements + (this->count - amount), this->elements + this->count);
+			}
+			return (this->elements + index);
+		}
+		template <typename I, typename = typename std::enable_if<!std::is_integral<I>::value>::type>
+		inline iterator insert(const_iterator position, I first, I last)
+		{
+			int index = (int)(position - this->elements);
+			int amount = (int)std::distance(first, last);
+			if (amount > 0)
+			{
+				// the new elements are constructed before existing elements are moved in case the range is part of this storage
+				int newLimit = this->_grownLimit(amount);
+				T* data = (newLimit != this->limit ? this->_allocate(newLimit) : this->elements);
+				std::uninitialized_copy(first, last, data + this->count);
+				this->_commit(data, newLimit, amount);
+				std::rotate(this->elements + index, this->elements + (this->count - amount), this->elements + this->count);
+			}
+			return (this->elements + index);
+		}
+		template <typename I, typename = typename std::enable_if<!std::is_integral<I>::value>::type>
+		inline void assign(I first, I last)
+		{
+			this->clear();
+			this->insert(this->end(), first, last);
+		}
+		inline iterator erase(const_iterator position)
+		{
+			return this->erase(position, position + 1);
+		}
+		inline iterator erase(const_iterator first, const_iterator last)
+		{
+			iterator begin = this->elements + (first - this->elements);
+			if (first != last)
+			{
+				iterator newEnd = std::move(begin + (last - first), this->end(), begin);
+				this->_destroy(newEnd, this->end());
+				this->count = (int)(newEnd - this->elements);
+			}
+			return begin;
+		}
+		inline void swap(_SmallVector& other)
+		{
+			if (this != &other)
+			{
+				_SmallVector temp(std::move(other));
+				other = std::move(*this);
+				*this = std::move(temp);
+			}
+		}
+
+	protected:
+		/// @brief Inline buffer for up to N elements.
+		typename std::aligned_storage<sizeof(T) * N, std::alignment_of<T>::value>::type buffer;
+		/// @brief Pointer to the elements, either the inline buffer or heap memory.
+		T* elements;
+		/// @brief Number of elements.
+		int count;
+		/// @brief Number of elements that fit into the current memory.
+		int limit;
+
+		/// @brief Gets the capacity required to add more elements.
+		/// @param[in] amount Number of elements that are going to be added.
+		/// @return The current capacity if the elements fit, otherwise the grown capacity.
+		inline int _grownLimit(int amount) const
+		{
+			if (this->count + amount <= this->limit)
+			{
+				return this->limit;
+			}
+			return hmax(this->limit * 2, this->count + amount);
+		}
+		/// @brief Allocates uninitialized heap memory.
+		/// @param[in] size Number of elements.
+		/// @return Pointer to the memory.
+		static inline T* _allocate(int size)
+		{
+			return (T*)::operator new(sizeof(T) * size);
+		}
+		/// @brief Destroys a range of elements.
+		/// @param[in] first Start of the range.
+		/// @param[in] last End of the range.
+		static inline void _destroy(T* first, T* last)
+		{
+			for (; first != last; ++first)
+			{
+				first->~T();
+			}
+		}
+		/// @brief Switches to new memory if it differs from the current one and takes over added elements.
+		/// @param[in] data The memory which already contains the added elements after the position of the current elements.
+		/// @param[in] newLimit Capacity of data.
+		/// @param[in] added Number of elements that have been constructed in data.
+		inline void _commit(T* data, int newLimit, int added)
+		{
+			if (data != this->elements)
+			{
+				std::uninitialized_copy(std::make_move_iterator(this->elements), std::make_move_iterator(this->elements + this->count), data);
+				this->_destroy(this->elements, this->elements + this->count);
+				this->_release();
+				this->elements = data;
+				this->limit = newLimit;
+			}
+			this->count += added;
+		}
+		/// @brief Frees heap memory if it is used.
+		/// @note Elements have to be destroyed already.
+		inline void _release()
+		{
+			if (!this->isInline())
+			{
+				::operator delete(this->elements);
+				this->elements = (T*)&this->buffer;
+				this->limit = N;
+			}
+		}
+		/// @brief Takes over the elements of other storage.
+		/// @param[in] other The other storage.
+		/// @note This storage has to be empty and inline. other is left empty.
+		inline void _take(_SmallVector& other)
+		{
+			if (!other.isInline())
+			{
+				this->elements = other.elements;
+				this->count = other.count;
+				this->limit = other.limit;
+				other.elements = (T*)&other.buffer;
+				other.count = 0;
+				other.limit = N;
+			}
+			else
+			{
+				std::uninitialized_copy(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()), this->elements);
+				this->count = other.count;
+				other.clear();
+			}
+		}
+
+	};
+
+	template <typename T, int N>
+	struct _ContiguousStorage<_SmallVector<T, N> > : std::true_type
+	{
+	};
+
+	/// @brief Array-like container that stores up to N elements inline and only allocates heap memory beyond that.
+	/// @note Use it for small short-lived collections to avoid heap allocations.
+	/// @note Moving a SmallArray moves its elements individually while they are stored inline.
+	template <typename T, int N>
+	class SmallArray : public Container<_SmallVector<T, N>, T>
+	{
+	public:
+		/// @brief Empty constructor.
+		inline SmallArray() :
+			Container<_SmallVector<T, N>, T>()
+		{
+		}
+		/// @brief Copy constructor.
+		/// @param[in] other Container to copy.
+		inline SmallArray(const Container<_SmallVector<T, N>, T>& other) :
+			Container<_SmallVector<T, N>, T>(other)
+		{
+		}
+		/// @brief Move constructor.
+		/// @param[in] other Container to move.
+		/// @note other is left empty.
+		inline SmallArray(Container<_SmallVector<T, N>, T>&& other) :
+			Container<_SmallVector<T, N>, T>(std::move(other))
+		{
+		}
+		/// @brief Constructor from single element.
+		/// @param[in] element Element to insert.
+		/// @note The explicit prevents "var = element" from working.
+		inline explicit SmallArray(const T& element) :
+			Container<_SmallVector<T, N>, T>(element)
+		{
+		}
+		/// @brief Constructor from single element.
+		/// @param[in] element Element to insert.
+		/// @param[in] times Number of times to insert element.
+		inline SmallArray(const T& element, int times) :
+			Container<_SmallVector<T, N>, T>(element, times)
+		{
+		}
+		/// @brief Constructor from C-type array.
+		/// @param[in] other C-type array to copy.
+		/// @param[in] count Number of elements to copy.
+		inline SmallArray(const T other[], const int count) :
+			Container<_SmallVector<T, N>, T>(other, count)
+		{
+		}
+		/// @brief Constructor from C-type array.
+		/// @param[in] other C-type array to copy.
+		/// @param[in] start Start index of elements to copy.
+		/// @param[in] count Number of elements to copy.
+		inline SmallArray(const T other[], const int start, const int count) :
+			Container<_SmallVector<T, N>, T>(other, start, count)
+		{
+		}
+		/// @brief Constructor from Array.
+		/// @param[in] other Array to copy.
+		inline SmallArray(const Array<T>& other) :
+			Container<_SmallVector<T, N>, T>()
+		{
+			this->_reserve(other.size());
+			for (typename Array<T>::const_iterator_t it = other.begin(); it != other.end(); ++it)
+			{
+				this->add(*it);
+			}
+		}
+		/// @brief Constructor from Array.
+		/// @param[in] other Array to move.
+		/// @note The elements of other are moved and other is left empty.
+		inline SmallArray(Array<T>&& other) :
+			Container<_SmallVector<T, N>, T>()
+		{
+			this->_reserve(other.size());
+			for (typename Array<T>::iterator_t it = other.begin(); it != other.end(); ++it)
+			{
+				this->add(std::move(*it));
+			}
+			other.clear();
+		}
+		/// @brief Gets the number of elements that are stored inline without heap allocation.
+		/// @return The number of elements that are stored inline.
+		static inline int inlineCapacity()
+		{
+			return N;
+		}
+		/// @brief Checks if the elements are stored in the inline buffer.
+		/// @return True if the elements are stored in the inline buffer.
+		inline bool isInline() const
+		{
+			return this->_capacity() == N;
+		}
+		/// @brief Reserves memory for a number of elements.
+		/// @param[in] count Number of elements to reserve memory for.
+		/// @note Reserving more than N elements moves the elements to the heap.
+		inline void reserve(int count)
+		{
+			this->_reserve(count);
+		}
+		/// @brief Gets the number of elements memory has been reserved for.
+		/// @return The number of elements memory has been reserved for.
+		inline int capacity() const
+		{
+			return this->_capacity();
+		}
+		/// @brief Releases reserved memory that is not used by any element.
+		/// @note Moves the elements back into the inline buffer if they fit.
+		inline void shrinkToFit()
+		{
+			this->_shrinkToFit();
+		}
+		/// @brief Removes element at given index.
+		/// @param[in] index Index of element to remove.
+		/// @return The removed element.
+		inline T removeAt(int index)
+		{
+			return Container<_SmallVector<T, N>, T>::removeAt(index);
+		}
+		/// @brief Removes n elements at given index of SmallArray.
+		/// @param[in] index Start index of elements to remove.
+		/// @param[in] count Number of elements to remove.
+		/// @return SmallArray of all removed elements.
+		/// @note Elements in the returned SmallArray are in the same order as in the orignal SmallArray.
+		inline SmallArray<T, N> removeAt(int index, int count)
+		{
+			return this->template _removeAt<SmallArray<T, N> >(index, count);
+		}
+		/// @brief Removes first element of SmallArray.
+		/// @return The removed element.
+		inline T removeFirst()
+		{
+			return Container<_SmallVector<T, N>, T>::removeFirst();
+		}
+		/// @brief Removes n elements from the beginning of SmallArray.
+		/// @param[in] count Number of elements to remove.
+		/// @return SmallArray of all removed elements.
+		/// @note Elements in the returned SmallArray are in the same order as in the orignal SmallArray.
+		inline SmallArray<T, N> removeFirst(const int count)
+		{
+			return this->template _removeFirst<SmallArray<T, N> >(count);
+		}
+		/// @brief Removes last element of SmallArray.
+		/// @return The removed element.
+		inline T removeLast()
+		{
+			return Container<_SmallVector<T, N>, T>::removeLast();
+		}
+		/// @brief Removes n elements from the end of SmallArray.
+		/// @param[in] count Number of elements to remove.
+		/// @return SmallArray of all removed elements.
+		/// @note Elements in the returned SmallArray are in the same order as in the orignal SmallArray.
+		inline SmallArray<T, N> removeLast(const int count)
+		{
+			return this->template _removeLast<SmallArray<T, N> >(count);
+		}
+		/// @brief Creates new SmallArray with reversed order of elements.
+		/// @return A new SmallArray.
+		inline SmallArray<T, N> reversed() const
+		{
+			return this->template _reversed<SmallArray<T, N> >();
+		}
+		/// @brief Creates new SmallArray without duplicates.
+		/// @return A new SmallArray.
+		inline SmallArray<T, N> removedDuplicates() const
+		{
+			return this->template _removedDuplicates<SmallArray<T, N> >();
+		}
+		/// @brief Creates new sorted SmallArray.
+		/// @return A new SmallArray.
+		/// @note The sorting order is ascending.
+		inline SmallArray<T, N> sorted() const
+		{
+			return this->template _sorted<SmallArray<T, N> >();
+		}
+		/// @brief Creates new sorted SmallArray.
+		/// @param[in] compareFunction Function pointer with comparison function that takes two elements of type T and returns bool.
+		/// @return A new SmallArray.
+		/// @note The sorting order is ascending.
+		/// @note compareFunction should return true if first element is less than the second element.
+		inline SmallArray<T, N> sorted(bool (*compareFunction)(T const&, T const&)) const
+		{
+			return this->template _sorted<SmallArray<T, N> >(compareFunction);
+		}
+		/// @brief Finds and returns new SmallArray of elements that match the condition.
+		/// @param[in] conditionFunction Function pointer with condition function that takes one element of type T and returns bool.
+		/// @return New SmallArray with all matching elements.
+		inline SmallArray<T, N> findAll(bool (*conditionFunction)(T const&)) const
+		{
+			return this->template _findAll<SmallArray<T, N> >(conditionFunction);
+		}
+		/// @brief Creates a new Array with copies of all elements.
+		/// @return A new Array.
+		inline Array<T> toArray() const
+		{
+			Array<T> result;
+			result.reserve(this->size());
+			result.insertAt(0, this->begin(), this->size());
+			return result;
+		}
+		/// @brief Returns element at specified position.
+		/// @param[in] index Index of the element.
+		/// @return Element at specified position.
+		/// @note The bounds are only checked if HLTYPES_CONTAINER_CHECKS is enabled.
+		inline T& operator[](int index)
+		{
+			return this->_elementAt(index);
+		}
+		/// @brief Returns element at specified position.
+		/// @param[in] index Index of the element.
+		/// @return Element at specified position.
+		/// @note The bounds are only checked if HLTYPES_CONTAINER_CHECKS is enabled.
+		inline const T& operator[](int index) const
+		{
+			return this->_elementAt(index);
+		}
+		/// @brief Returns a subarray.
+		/// @param[in] start Start index of the elements to copy.
+		/// @param[in] count Number of elements to copy.
+		/// @return Subarray created from the current SmallArray.
+		inline SmallArray<T, N> operator()(int start, const int count) const
+		{
+			return this->template _sub<SmallArray<T, N> >(start, count);
+		}
+		/// @brief Same as equals.
+		/// @see equals
+		inline bool operator==(const SmallArray<T, N>& other) const
+		{
+			return this->equals(other);
+		}
+		/// @brief Same as nequals.
+		/// @see nequals
+		inline bool operator!=(const SmallArray<T, N>& other) const
+		{
+			return this->nequals(other);
+		}
+		/// @brief Same as add.
+		/// @see add(const T& element)
+		inline SmallArray<T, N>& operator<<(const T& element)
+		{
+			this->add(element);
+			return (*this);
+		}
+		/// @brief Same as add.
+		/// @see add(T&& element)
+		inline SmallArray<T, N>& operator<<(T&& element)
+		{
+			this->add(std::move(element));
+			return (*this);
+		}
+		/// @brief Same as add.
+		/// @see add(const T& element)
+		inline SmallArray<T, N>& operator+=(const T& element)
+		{
+			this->add(element);
+			return (*this);
+		}
+		/// @brief Same as add.
+		/// @see add(T&& element)
+		inline SmallArray<T, N>& operator+=(T&& element)
+		{
+			this->add(std::move(element));
+			return (*this);
+		}
+		/// @brief Same as add.
+		/// @see add(const SmallArray<T, N>& other)
+		inline SmallArray<T, N>& operator+=(const SmallArray<T, N>& other)
+		{
+			this->add(other);
+			return (*this);
+		}
+		/// @brief Same as remove.
+		/// @see remove(T element)
+		inline SmallArray<T, N>& operator-=(T element)
+		{
+			this->remove(element);
+			return (*this);
+		}
+		/// @brief Same as toArray.
+		/// @see toArray
+		inline operator Array<T>() const
+		{
+			return this->toArray();
+		}
+
+	};
+
+}
+
+/// @brief Alias for simpler code.
+#define hsmallarray hltypes::SmallArray
+
+#endif
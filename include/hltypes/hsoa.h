@@ -0,0 +1,488 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+///
+/// @section DESCRIPTION
+///
+/// Provides a structure-of-arrays container that stores each field in its own Array.
+
+#ifndef HLTYPES_SOA_H
+#define HLTYPES_SOA_H
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "hallocator.h"
+#include "harray.h"
+#include "hexception.h"
+#include "hsbase.h"
+#include "hspan.h"
+#include "hstring.h"
+
+#ifndef HLTYPES_SOA_ALIGNMENT
+/// @brief Alignment in bytes of the field Arrays of SoA.
+/// @note 64 covers the cache line size as well as the widest common SIMD registers.
+#define HLTYPES_SOA_ALIGNMENT 64
+#endif
+
+namespace hltypes
+{
+	/// @brief Calls a function object on every field Array of an SoA, from I to N - 1.
+	template <int I, int N>
+	struct _SoAFields
+	{
+		template <typename C, typename F>
+		static inline void apply(C& columns, F& function)
+		{
+			function(std::get<I>(columns));
+			_SoAFields<I + 1, N>::apply(columns, function);
+		}
+	};
+
+	template <int N>
+	struct _SoAFields<N, N>
+	{
+		template <typename C, typename F>
+		static inline void apply(C& columns, F& function)
+		{
+		}
+	};
+
+	/// @brief Loads a single value of a field with the matching StreamBase method.
+	inline void _soaLoad(StreamBase& stream, char& value) { value = stream.loadInt8(); }
+	inline void _soaLoad(StreamBase& stream, unsigned char& value) { value = stream.loadUint8(); }
+	inline void _soaLoad(StreamBase& stream, short& value) { value = stream.loadInt16(); }
+	inline void _soaLoad(StreamBase& stream, unsigned short& value) { value = stream.loadUint16(); }
+	inline void _soaLoad(StreamBase& stream, int& value) { value = stream.loadInt32(); }
+	inline void _soaLoad(StreamBase& stream, unsigned int& value) { value = stream.loadUint32(); }
+	inline void _soaLoad(StreamBase& stream, int64_t& value) { value = stream.loadInt64(); }
+	inline void _soaLoad(StreamBase& stream, uint64_t& value) { value = stream.loadUint64(); }
+	inline void _soaLoad(StreamBase& stream, float& value) { value = stream.loadFloat(); }
+	inline void _soaLoad(StreamBase& stream, double& value) { value = stream.loadDouble(); }
+	inline void _soaLoad(StreamBase& stream, String& value) { value = stream.loadString(); }
+
+	/// @brief Whether a field is written to streams as one raw block instead of value by value.
+	/// @note StreamBase writes numbers in little endian byte order so the raw block matches only on little endian platforms.
+	template <typename T>
+	struct _SoARawField
+	{
+#ifndef __BIG_ENDIAN__
+		static const bool value = std::is_arithmetic<T>::value;
+#else
+		static const bool value = false;
+#endif
+	};
+
+	/// @brief Checks if any of the field types is bool.
+	template <typename... Fields>
+	struct _SoAHasBool : std::false_type
+	{
+	};
+
+	template <typename F, typename... Fields>
+	struct _SoAHasBool<F, Fields...> : std::integral_constant<bool, std::is_same<F, bool>::value || _SoAHasBool<Fields...>::value>
+	{
+	};
+
+	/// @brief Structure-of-arrays container that keeps every field of a row in its own contiguous Array.
+	/// @note Loops over a single field touch only the memory of that field which makes them cache and SIMD friendly.
+	/// @note The field Arrays are aligned to HLTYPES_SOA_ALIGNMENT bytes.
+	/// @note Fields are accessed by their index in the template parameter list, e.g. field<0>().
+	/// @note bool fields are not supported since std::vector<bool> does not store its values contiguously. Use unsigned char instead.
+	template <typename... Fields>
+	class SoA
+	{
+		static_assert(sizeof...(Fields) > 0, "SoA needs at least one field.");
+		static_assert(!_SoAHasBool<Fields...>::value, "SoA does not support bool fields.");
+
+	public:
+		/// @brief Gets the type of a field.
+		template <int I>
+		struct Field
+		{
+			/// @brief Type of the field.
+			typedef typename std::tuple_element<I, std::tuple<Fields...> >::type type;
+			/// @brief Type of the field Array.
+			typedef Array<type, AlignedAllocator<type, HLTYPES_SOA_ALIGNMENT> > array;
+		};
+
+		/// @brief Number of fields.
+		static const int FieldCount = (int)sizeof...(Fields);
+
+		/// @brief Empty constructor.
+		inline SoA() : rowCount(0)
+		{
+		}
+		/// @brief Copy constructor.
+		/// @param[in] other SoA to copy.
+		inline SoA(const SoA<Fields...>& other) : columns(other.columns), rowCount(other.rowCount)
+		{
+		}
+		/// @brief Move constructor.
+		/// @param[in] other SoA to move.
+		/// @note other is left empty.
+		inline SoA(SoA<Fields...>&& other) : columns(std::move(other.columns)), rowCount(other.rowCount)
+		{
+			other.clear();
+		}
+		/// @brief Destructor.
+		inline ~SoA()
+		{
+		}
+
+		/// @brief Copies the rows of another SoA into this one.
+		/// @param[in] other SoA to copy.
+		/// @return This SoA.
+		inline SoA<Fields...>& operator=(const SoA<Fields...>& other)
+		{
+			this->columns = other.columns;
+			this->rowCount = other.rowCount;
+			return (*this);
+		}
+		/// @brief Moves the rows of another SoA into this one.
+		/// @param[in] other SoA to move.
+		/// @return This SoA.
+		/// @note other is left empty.
+		inline SoA<Fields...>& operator=(SoA<Fields...>&& other)
+		{
+			if (this != &other)
+			{
+				this->columns = std::move(other.columns);
+				this->rowCount = other.rowCount;
+				other.clear();
+			}
+			return (*this);
+		}
+
+		/// @brief Gets the number of rows.
+		/// @return The number of rows.
+		inline int size() const { return this->rowCount; }
+		/// @brief Checks if the SoA has no rows.
+		/// @return True if the SoA has no rows.
+		inline bool isEmpty() const { return (this->rowCount == 0); }
+		/// @brief Gets the number of rows memory has been reserved for.
+		/// @return The number of rows memory has been reserved for.
+		inline int capacity() const { return std::get<0>(this->columns).capacity(); }
+
+		/// @brief Reserves memory for a number of rows in all fields.
+		/// @param[in] count Number of rows to reserve memory for.
+		inline void reserve(int count)
+		{
+			_Reserve function(count);
+			_SoAFields<0, FieldCount>::apply(this->columns, function);
+		}
+		/// @brief Releases reserved memory that is not used by any row.
+		inline void shrinkToFit()
+		{
+			_ShrinkToFit function;
+			_SoAFields<0, FieldCount>::apply(this->columns, function);
+		}
+		/// @brief Removes all rows.
+		inline void clear()
+		{
+			_Clear function;
+			_SoAFields<0, FieldCount>::apply(this->columns, function);
+			this->rowCount = 0;
+		}
+
+		/// @brief Gets the Array of a field.
+		/// @return The Array of the field.
+		/// @note The Array is read-only so all fields keep the same number of rows. Use span() or data() to modify values in place.
+		template <int I>
+		inline const typename Field<I>::array& field() const
+		{
+			return std::get<I>(this->columns);
+		}
+		/// @brief Gets the values of a field.
+		/// @return Pointer to the first value of the field or NULL if there are no rows.
+		/// @note The pointer becomes invalid when rows are added or removed.
+		template <int I>
+		inline typename Field<I>::type* data()
+		{
+			return (this->rowCount > 0 ? &std::get<I>(this->columns)[0] : NULL);
+		}
+		/// @brief Gets the values of a field.
+		/// @return Pointer to the first value of the field or NULL if there are no rows.
+		/// @note The pointer becomes invalid when rows are added or removed.
+		template <int I>
+		inline const typename Field<I>::type* data() const
+		{
+			return (this->rowCount > 0 ? &std::get<I>(this->columns)[0] : NULL);
+		}
+		/// @brief Gets a Span of the values of a field.
+		/// @return A Span of the values of the field.
+		/// @note The Span becomes invalid when rows are added or removed.
+		template <int I>
+		inline Span<typename Field<I>::type> span()
+		{
+			return std::get<I>(this->columns).span();
+		}
+		/// @brief Gets a Span of the values of a field.
+		/// @return A Span of the values of the field.
+		/// @note The Span becomes invalid when rows are added or removed.
+		template <int I>
+		inline Span<const typename Field<I>::type> span() const
+		{
+			return std::get<I>(this->columns).span();
+		}
+		/// @brief Gets the value of a field in a row.
+		/// @param[in] index Index of the row.
+		/// @return The value of the field.
+		template <int I>
+		inline typename Field<I>::type& at(int index)
+		{
+			this->_checkIndex(index);
+			return std::get<I>(this->columns)[index];
+		}
+		/// @brief Gets the value of a field in a row.
+		/// @param[in] index Index of the row.
+		/// @return The value of the field.
+		template <int I>
+		inline const typename Field<I>::type& at(int index) const
+		{
+			this->_checkIndex(index);
+			return std::get<I>(this->columns)[index];
+		}
+
+		/// @brief Adds a row at the end.
+		/// @param[in] values Values of all fields of the row.
+		/// @return Index of the new row.
+		inline int add(const Fields&... values)
+		{
+			this->template _add<0>(values...);
+			return this->rowCount++;
+		}
+		/// @brief Removes a row and keeps the order of the following rows.
+		/// @param[in] index Index of the row.
+		/// @note All following rows are moved. Use swapRemoveAt() if the order of the rows does not matter.
+		inline void removeAt(int index)
+		{
+			this->_checkIndex(index);
+			_RemoveAt function(index);
+			_SoAFields<0, FieldCount>::apply(this->columns, function);
+			--this->rowCount;
+		}
+		/// @brief Removes a row by replacing it with the last row.
+		/// @param[in] index Index of the row.
+		/// @note This takes constant time but it changes the order of the rows.
+		inline void swapRemoveAt(int index)
+		{
+			this->_checkIndex(index);
+			_SwapRemoveAt function(index);
+			_SoAFields<0, FieldCount>::apply(this->columns, function);
+			--this->rowCount;
+		}
+		/// @brief Swaps the values of all fields of two rows.
+		/// @param[in] index1 Index of the first row.
+		/// @param[in] index2 Index of the second row.
+		inline void swapRows(int index1, int index2)
+		{
+			this->_checkIndex(index1);
+			this->_checkIndex(index2);
+			_SwapRows function(index1, index2);
+			_SoAFields<0, FieldCount>::apply(this->columns, function);
+		}
+
+		/// @brief Writes all rows to a stream.
+		/// @param[in] stream The stream.
+		/// @note Writes the number of rows and then every field after another.
+		/// @note Numeric fields are written as a single block on little endian platforms.
+		inline void dump(StreamBase& stream) const
+		{
+			stream.dump(this->rowCount);
+			_Dump function(stream);
+			_SoAFields<0, FieldCount>::apply(this->columns, function);
+		}
+		/// @brief Replaces all rows with rows read from a stream.
+		/// @param[in] stream The stream.
+		/// @note The data has to have been written with dump().
+		inline void load(StreamBase& stream)
+		{
+			this->clear();
+			int count = stream.loadInt32();
+			if (count < 0)
+			{
+				throw ContainerIndexException(count);
+			}
+			// a corrupted count must not cause a huge allocation
+			if ((int64_t)count * SoA::_minRowSize() > stream.size() - stream.position())
+			{
+				throw Exception(hsprintf("SoA row count %d in stream is invalid!", count));
+			}
+			_Load function(stream, count);
+			try
+			{
+				_SoAFields<0, FieldCount>::apply(this->columns, function);
+			}
+			catch (...)
+			{
+				// columns must not be left with different sizes
+				this->clear();
+				throw;
+			}
+			this->rowCount = count;
+		}
+
+	protected:
+		/// @brief Arrays of all fields.
+		std::tuple<Array<Fields, AlignedAllocator<Fields, HLTYPES_SOA_ALIGNMENT> >...> columns;
+		/// @brief Number of rows.
+		int rowCount;
+
+		/// @brief Gets the smallest number of bytes one row takes up in a stream.
+		/// @return The number of bytes.
+		static inline int _minRowSize()
+		{
+			const int sizes[] = { _StreamMinValueSize<Fields>::value... };
+			int result = 0;
+			for_iter (i, 0, FieldCount)
+			{
+				result += sizes[i];
+			}
+			return result;
+		}
+		/// @brief Checks if a row index is valid.
+		/// @param[in] index Index of the row.
+		inline void _checkIndex(int index) const
+		{
+			if (index < 0 || index >= this->rowCount)
+			{
+				throw ContainerIndexException(index);
+			}
+		}
+		/// @brief Adds the values of a row to the field Arrays starting with field I.
+		template <int I, typename V, typename... Values>
+		inline void _add(const V& value, const Values&... values)
+		{
+			std::get<I>(this->columns).add(value);
+			this->template _add<I + 1>(values...);
+		}
+		/// @brief Ends the recursion of adding the values of a row.
+		template <int I>
+		inline void _add()
+		{
+		}
+
+		/// @brief Reserves memory in a field Array.
+		struct _Reserve
+		{
+			int count;
+			inline _Reserve(int count) : count(count) { }
+			template <typename C>
+			inline void operator()(C& column) { column.reserve(this->count); }
+		};
+		/// @brief Releases unused memory of a field Array.
+		struct _ShrinkToFit
+		{
+			template <typename C>
+			inline void operator()(C& column) { column.shrinkToFit(); }
+		};
+		/// @brief Clears a field Array.
+		struct _Clear
+		{
+			template <typename C>
+			inline void operator()(C& column) { column.clear(); }
+		};
+		/// @brief Removes a value from a field Array.
+		struct _RemoveAt
+		{
+			int index;
+			inline _RemoveAt(int index) : index(index) { }
+			template <typename C>
+			inline void operator()(C& column) { column.removeAt(this->index); }
+		};
+		/// @brief Replaces a value in a field Array with the last value.
+		struct _SwapRemoveAt
+		{
+			int index;
+			inline _SwapRemoveAt(int index) : index(index) { }
+			template <typename C>
+			inline void operator()(C& column)
+			{
+				if (this->index < column.size() - 1)
+				{
+					column[this->index] = std::move(column.last());
+				}
+				column.removeLast();
+			}
+		};
+		/// @brief Swaps two values in a field Array.
+		struct _SwapRows
+		{
+			int index1;
+			int index2;
+			inline _SwapRows(int index1, int index2) : index1(index1), index2(index2) { }
+			template <typename C>
+			inline void operator()(C& column) { std::swap(column[this->index1], column[this->index2]); }
+		};
+		/// @brief Writes a field Array to a stream.
+		struct _Dump
+		{
+			StreamBase& stream;
+			inline _Dump(StreamBase& stream) : stream(stream) { }
+			template <typename T, typename A>
+			inline void operator()(const Array<T, A>& column) { this->_dump(column, std::integral_constant<bool, _SoARawField<T>::value>()); }
+			template <typename T, typename A>
+			inline void _dump(const Array<T, A>& column, std::true_type raw)
+			{
+				if (column.size() > 0)
+				{
+					this->stream.writeRaw((void*)&column[0], (int64_t)column.size() * (int64_t)sizeof(T));
+				}
+			}
+			template <typename T, typename A>
+			inline void _dump(const Array<T, A>& column, std::false_type raw)
+			{
+				for_iter (i, 0, column.size())
+				{
+					this->stream.dump(column[i]);
+				}
+			}
+		};
+		/// @brief Reads a field Array from a stream.
+		struct _Load
+		{
+			StreamBase& stream;
+			int count;
+			inline _Load(StreamBase& stream, int count) : stream(stream), count(count) { }
+			template <typename T, typename A>
+			inline void operator()(Array<T, A>& column) { this->_load(column, std::integral_constant<bool, _SoARawField<T>::value>()); }
+			template <typename T, typename A>
+			inline void _load(Array<T, A>& column, std::true_type raw)
+			{
+				column.add(T(), this->count);
+				if (this->count > 0)
+				{
+					int64_t size = (int64_t)this->count * (int64_t)sizeof(T);
+					if (this->stream.readRaw(&column[0], size) != size)
+					{
+						throw Exception("SoA data in stream is incomplete");
+					}
+				}
+			}
+			template <typename T, typename A>
+			inline void _load(Array<T, A>& column, std::false_type raw)
+			{
+				column.reserve(this->count);
+				T value = T();
+				for_iter (i, 0, this->count)
+				{
+					_soaLoad(this->stream, value);
+					column.add(value);
+				}
+			}
+		};
+
+	};
+
+}
+
+/// @brief Alias for simpler code.
+#define hsoa hltypes::SoA
+
+#endif
@@ -0,0 +1,228 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+///
+/// @section DESCRIPTION
+///
+/// Provides a non-owning view of contiguous elements.
+
+#ifndef HLTYPES_SPAN_H
+#define HLTYPES_SPAN_H
+
+#include <stddef.h>
+#include <type_traits>
+
+#include "hcontainer.h"
+#include "hexception.h"
+#include "hstring.h"
+
+namespace hltypes
+{
+	/// @brief Non-owning view of contiguous elements that consists only of a pointer and a number of elements.
+	/// @note Array, Stream and C-type arrays convert to Span so read-only APIs can accept all of them without copying.
+	/// @note A Span does not keep the elements alive. It becomes invalid when the owner of the elements is destroyed or reallocates.
+	/// @note Use Span<const T> for read-only access.
+	/// @note Conversions only add qualifiers. A Span of a derived class does not convert to a Span of its base class since the element sizes can differ.
+	template <typename T>
+	class Span
+	{
+	public:
+		template <typename S> friend class Span;
+
+		/// @brief Empty constructor.
+		inline Span() : elements(NULL), count(0)
+		{
+		}
+		/// @brief Constructor from pointer and number of elements.
+		/// @param[in] elements Pointer to the first element.
+		/// @param[in] count Number of elements.
+		inline Span(T* elements, int count) : elements(elements), count(count)
+		{
+			if (count < 0)
+			{
+				throw ContainerRangeException(0, count);
+			}
+		}
+		/// @brief Constructor from a C-type array.
+		/// @param[in] elements The C-type array.
+		template <typename S, size_t N>
+		inline Span(S (&elements)[N], typename std::enable_if<std::is_convertible<S(*)[], T(*)[]>::value>::type* = NULL) :
+			elements(elements), count((int)N)
+		{
+		}
+		/// @brief Constructor from an Array.
+		/// @param[in] array The Array.
+		template <typename S, typename A>
+		inline Span(Array<S, A>& array, typename std::enable_if<std::is_convertible<S(*)[], T(*)[]>::value>::type* = NULL) :
+			elements(array.data()), count(array.size())
+		{
+		}
+		/// @brief Constructor from a const Array.
+		/// @param[in] array The Array.
+		/// @note Only available for Span<const T>.
+		template <typename S, typename A>
+		inline Span(const Array<S, A>& array, typename std::enable_if<std::is_convertible<const S(*)[], T(*)[]>::value>::type* = NULL) :
+			elements(array.data()), count(array.size())
+		{
+		}
+		/// @brief Conversion constructor, e.g. from Span<T> to Span<const T>.
+		/// @param[in] other Another Span.
+		template <typename S>
+		inline Span(const Span<S>& other, typename std::enable_if<std::is_convertible<S(*)[], T(*)[]>::value>::type* = NULL) :
+			elements(other.elements), count(other.count)
+		{
+		}
+
+		/// @brief Gets the pointer to the first element.
+		/// @return Pointer to the first element or NULL if the Span is empty and was not created from a pointer.
+		inline T* data() const { return this->elements; }
+		/// @brief Gets the number of elements.
+		/// @return The number of elements.
+		inline int size() const { return this->count; }
+		/// @brief Checks if the Span has no elements.
+		/// @return True if the Span has no elements.
+		inline bool isEmpty() const { return (this->count == 0); }
+		/// @brief Gets the iterator to the first element.
+		/// @return Pointer to the first element.
+		inline T* begin() const { return this->elements; }
+		/// @brief Gets the iterator after the last element.
+		/// @return Pointer after the last element.
+		inline T* end() const { return this->elements + this->count; }
+
+		/// @brief Returns element at specified position.
+		/// @param[in] index Index of the element.
+		/// @return Element at specified position.
+		/// @note Negative indices are counted from the end.
+		inline T& at(int index) const
+		{
+			if (index < 0)
+			{
+				index += this->count;
+			}
+			if (index < 0 || index >= this->count)
+			{
+				throw ContainerIndexException(index);
+			}
+			return this->elements[index];
+		}
+		/// @brief Accesses first element of Span.
+		/// @return The first element.
+		inline T& first() const { return this->at(0); }
+		/// @brief Accesses last element of Span.
+		/// @return The last element.
+		inline T& last() const { return this->at(-1); }
+		/// @brief Gets index of the first occurrence of an element.
+		/// @param[in] element Element to search for.
+		/// @return Index of the element or -1 if it was not found.
+		inline int indexOf(const T& element) const
+		{
+			for_iter (i, 0, this->count)
+			{
+				if (this->elements[i] == element)
+				{
+					return i;
+				}
+			}
+			return -1;
+		}
+		/// @brief Checks existence of an element.
+		/// @param[in] element Element to search for.
+		/// @return True if the element is in the Span.
+		inline bool has(const T& element) const
+		{
+			return (this->indexOf(element) >= 0);
+		}
+		/// @brief Compares the elements of two Spans.
+		/// @param[in] other Another Span.
+		/// @return True if the number of elements and all elements are equal.
+		template <typename S>
+		inline bool equals(const Span<S>& other) const
+		{
+			if (this->count != other.count)
+			{
+				return false;
+			}
+			for_iter (i, 0, this->count)
+			{
+				if (!(this->elements[i] == other.elements[i]))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+		/// @brief Creates a Span of a part of the elements.
+		/// @param[in] start Start index of the elements.
+		/// @param[in] count Number of elements.
+		/// @return A Span of the elements.
+		/// @note Negative start indices are counted from the end.
+		inline Span<T> sub(int start, int count) const
+		{
+			if (start < 0)
+			{
+				start += this->count;
+			}
+			if (start < 0 || count < 0 || start + count > this->count)
+			{
+				throw ContainerRangeException(start, count);
+			}
+			return Span<T>(this->elements + start, count);
+		}
+		/// @brief Creates a copy of the elements.
+		/// @return An Array with copies of the elements.
+		inline Array<typename std::remove_const<T>::type> toArray() const
+		{
+			return Array<typename std::remove_const<T>::type>(this->elements, this->count);
+		}
+
+		/// @brief Returns element at specified position.
+		/// @param[in] index Index of the element.
+		/// @return Element at specified position.
+		/// @note The bounds are only checked if HLTYPES_CONTAINER_CHECKS is enabled.
+		inline T& operator[](int index) const
+		{
+#if HLTYPES_CONTAINER_CHECKS
+			return this->at(index);
+#else
+			return this->elements[index < 0 ? index + this->count : index];
+#endif
+		}
+		/// @brief Same as sub.
+		/// @see sub
+		inline Span<T> operator()(int start, int count) const
+		{
+			return this->sub(start, count);
+		}
+		/// @brief Same as equals.
+		/// @see equals
+		template <typename S>
+		inline bool operator==(const Span<S>& other) const
+		{
+			return this->equals(other);
+		}
+		/// @brief Same as !equals.
+		/// @see equals
+		template <typename S>
+		inline bool operator!=(const Span<S>& other) const
+		{
+			return !this->equals(other);
+		}
+
+	protected:
+		/// @brief Pointer to the first element.
+		T* elements;
+		/// @brief Number of elements.
+		int count;
+
+	};
+
+}
+
+/// @brief Alias for simpler code.
+#define hspan hltypes::Span
+
+#endif
@@ -27,82 +27,115 @@ namespace hltypes
 		/// @brief Constructor.
 		/// @param[in] initialCapacity Initial capacity of the internal buffer.
 		/// @note initialCapacity is used to prevent unnecessary calls to realloc() internally if it's not needed. This is NOT the Stream's initial size.
-		Stream(int initialCapacity = MIN_HSTREAM_CAPACITY);
+		Stream(int64_t initialCapacity = MIN_HSTREAM_CAPACITY);
 		/// @brief Constructor.
 		/// @param[in] initialData Initial data in the Stream.
 		/// @param[in] initialDataSize Initial data's size.
 		/// @note initialData is copied into the Stream.
-		Stream(unsigned char* initialData, int initialDataSize);
+		Stream(unsigned char* initialData, int64_t initialDataSize);
 		/// @brief Constructor.
 		/// @param[in] initialData Initial data in the Stream.
 		/// @param[in] initialDataSize Initial data's size.
 		/// @param[in] initialCapacity Initial capacity of the internal buffer.
 		/// @note initialData is copied into the Stream. initialCapacity will be corrected to initialDataSize if less than initialDataSize.
-		Stream(unsigned char* initialData, int initialDataSize, int initialCapacity);
+		Stream(unsigned char* initialData, int64_t initialDataSize, int64_t initialCapacity);
 		/// @brief Copy constructor.
 		/// @param[in] other Other Stream.
 		Stream(const Stream& other);
+		/// @brief Move constructor.
+		/// @param[in] other Other Stream.
+		/// @note The other Stream takes no memory afterwards and has to be cleared with clear() before it can be used again.
+		Stream(Stream&& other);
 		/// @brief Destructor.
 		~Stream();
 		/// @brief Clears the Stream.
 		/// @param[in] newCapacity New capacity of the internal buffer.
 		/// @note newCapacity is used to prevent unnecessary calls to realloc() internally if it's not needed. This is NOT the Stream's initial size.
-		void clear(int newCapacity = MIN_HSTREAM_CAPACITY);
+		void clear(int64_t newCapacity = MIN_HSTREAM_CAPACITY);
 		/// @brief Resizes internal buffer.
 		/// @param[in] newCapacity New capacity of the internal buffer.
 		/// @return True if internal buffer was resized or already the same size that was requested.
 		/// @note This does not change the data stream size. Use this to avoid allocation of too much data if not needed.
 		/// @note If newCapacity is smaller than the stream size, data will be lost and the Stream will be resized.
-		bool setCapacity(int newCapacity);
+		bool setCapacity(int64_t newCapacity);
+		/// @brief Gets the capacity of the internal buffer.
+		/// @return The capacity of the internal buffer.
+		HL_DEFINE_GET(int64_t, capacity, Capacity);
 		/// @brief Writes raw data to the Stream.
 		/// @param[in] buffer Pointer to raw data buffer.
 		/// @param[in] count Number of bytes to write.
 		/// @return Number of bytes written.
 		/// @note If return value differs from parameter count, it can indicate a writing error.
-		int writeRaw(void* buffer, int count) override;
+		int64_t writeRaw(void* buffer, int64_t count) override;
 		/// @brief Writes raw data to the Stream from another Stream.
 		/// @param[in] stream Another Stream.
 		/// @param[in] count Number of bytes to write.
 		/// @return Number of bytes written.
-		int writeRaw(StreamBase& stream, int count) override;
+		int64_t writeRaw(StreamBase& stream, int64_t count) override;
 		/// @brief Writes raw data to the Stream from another Stream.
 		/// @param[in] stream Another Stream.
 		/// @return Number of bytes written.
-		int writeRaw(StreamBase& stream) override;
+		int64_t writeRaw(StreamBase& stream) override;
 		/// @brief Writes raw data to the Stream from another Stream.
 		/// @param[in] stream Another Stream.
 		/// @param[in] count Number of bytes to write.
 		/// @return Number of bytes written.
-		int writeRaw(Stream& stream, int count) override;
+		int64_t writeRaw(Stream& stream, int64_t count) override;
 		/// @brief Writes raw data to the Stream from another Stream.
 		/// @param[in] stream Another Stream.
 		/// @return Number of bytes written.
-		int writeRaw(Stream& stream) override;
+		int64_t writeRaw(Stream& stream) override;
+		/// @brief Writes raw data to the Stream.
+		/// @param[in] buffer Span of the raw data.
+		/// @return Number of bytes written.
+		int writeRaw(Span<const unsigned char> buffer) override;
 		/// @brief Prepares Stream for manual writing without using write_raw() directly.
 		/// @param[in] count Number of bytes to prepare. Stream size is increased if necessary, but contains garbage data.
 		/// @return Number of bytes ready to be written.
 		/// @note Use this when you intend to manually write data. This does not change the current position and seeking has to be done manually as well.
 		/// @see writeRaw
-		int prepareManualWriteRaw(int count);
+		int64_t prepareManualWriteRaw(int64_t count);
 		/// @brief Writes a certain value into the buffer.
 		/// @param[in] value The value.
 		/// @param[in] count Number of bytes to write.
 		/// @return Number of bytes written.
 		/// @note If return value differs from parameter count, it can indicate a writing error.
-		int fill(unsigned char value, int count);
+		int64_t fill(unsigned char value, int64_t count);
 		/// @brief Truncates the Stream and removes data.
 		/// @param[in] targetSize The size the Stream should be truncated to.
 		/// @return True if Stream was truncated/reduced.
 		/// @note If size is greater or equal than the current size, the stream size will stay unchanged.
 		bool truncate(int64_t targetSize);
+		/// @brief Takes ownership of an existing buffer without copying it.
+		/// @param[in] buffer The buffer. It must have been allocated with malloc().
+		/// @param[in] size Size of the data in the buffer.
+		/// @param[in] capacity Size of the buffer. Corrected to size if less than size.
+		/// @note The previous data is freed and the position is set to 0.
+		/// @note The buffer will be freed with free() by the Stream.
+		void adopt(unsigned char* buffer, int64_t size, int64_t capacity);
+		/// @brief Hands out ownership of the internal buffer without copying it.
+		/// @return The internal buffer. It has to be freed with free().
+		/// @note Use size() before calling this to get the size of the data.
+		/// @note The Stream is empty afterwards.
+		unsigned char* release();
+		/// @brief Moves the data into a String and empties the Stream.
+		/// @return String with the data.
+		/// @note String cannot take ownership of a buffer so the data is copied once, but the Stream's memory is freed right away.
+		/// @note Throws an exception and leaves the Stream unchanged if the data is larger than INT_MAX bytes.
+		String detachToString();
 		/// @brief Gets a direct reference to the internal steam.
 		/// @param[in] index Reference to a specific element.
 		/// @return Direct reference to the internal steam.
-		const unsigned char& operator[](int index) const;
+		const unsigned char& operator[](int64_t index) const;
 		/// @brief Copies the other Stream into this one.
 		/// @param[in] other Other Stream.
 		/// @return This modified Stream.
 		Stream& operator=(const Stream& other);
+		/// @brief Moves the other Stream's data into this one.
+		/// @param[in] other Other Stream.
+		/// @return This modified Stream.
+		/// @note The other Stream takes no memory afterwards and has to be cleared with clear() before it can be used again.
+		Stream& operator=(Stream&& other);
 		/// @brief Casts this Array into a C-array.
 		/// @return The C-array.
 		operator char*() const;
@@ -115,6 +148,17 @@ namespace hltypes
 		/// @brief Casts this Array into a C-array.
 		/// @return The C-array.
 		operator const unsigned char*() const;
+		/// @brief Creates a Span of the data without copying it.
+		/// @return A Span of the whole data.
+		/// @note The Span becomes invalid when the Stream reallocates its internal buffer.
+		/// @note Throws an exception if the Stream is larger than 2 GB.
+		/// @note Only available for a non-const Stream since the data can be modified through the Span.
+		operator Span<unsigned char>();
+		/// @brief Creates a read-only Span of the data without copying it.
+		/// @return A Span of the whole data.
+		/// @note The Span becomes invalid when the Stream reallocates its internal buffer.
+		/// @note Throws an exception if the Stream is larger than 2 GB.
+		operator Span<const unsigned char>() const;
 
 	protected:
 		/// @brief Data stream container.
@@ -152,7 +196,7 @@ namespace hltypes
 		/// @brief Resizes internal buffer if necessary.
 		/// @param[in,out] write_size Number of bytes that is needed for the next write.
 		/// @note This does not change the data stream size. Use this to avoid allocation of too much data if not needed.
-		bool _tryIncreaseCapacity(int& write_size);
+		bool _tryIncreaseCapacity(int64_t& write_size);
 
 	};
 }
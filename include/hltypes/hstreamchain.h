@@ -0,0 +1,114 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+///
+/// @section DESCRIPTION
+///
+/// Provides data streaming from RAM in a chain of fixed-size blocks.
+
+#ifndef HLTYPES_STREAM_CHAIN_H
+#define HLTYPES_STREAM_CHAIN_H
+
+#include <stdint.h>
+
+#include "harray.h"
+#include "hltypesExport.h"
+#include "hltypesUtil.h"
+#include "hsbase.h"
+#include "hspan.h"
+
+#define DEFAULT_STREAM_CHAIN_BLOCK_SIZE 65536
+
+namespace hltypes
+{
+	class Stream;
+
+	/// @brief Provides data streaming from RAM in a chain of fixed-size blocks.
+	/// @note Unlike Stream, growing never reallocates or copies existing data and does not need contiguous address space.
+	/// @note Use writeTo() to write all data to another stream. Files use vectored I/O for this.
+	class hltypesExport StreamChain : public StreamBase
+	{
+	public:
+		/// @brief Constructor.
+		/// @param[in] blockSize Size of each block in bytes.
+		StreamChain(int blockSize = DEFAULT_STREAM_CHAIN_BLOCK_SIZE);
+		/// @brief Destructor.
+		~StreamChain();
+		/// @brief Gets the size of each block.
+		/// @return The size of each block.
+		HL_DEFINE_GET(int, blockSize, BlockSize);
+		/// @brief Gets the number of blocks that contain data.
+		/// @return The number of blocks that contain data.
+		int getBlockCount() const;
+		/// @brief Gets the data of a block.
+		/// @param[in] index Index of the block.
+		/// @return Span of the data in the block.
+		/// @note Only the last block can be smaller than the block size.
+		Span<const unsigned char> getBlock(int index) const;
+
+		/// @brief Removes all data and frees all blocks.
+		void clear();
+		/// @brief Copies all data into one contiguous Stream.
+		/// @return A Stream with all data.
+		/// @note The Stream's memory is allocated only once.
+		Stream toStream() const;
+		/// @brief Writes all data to another stream.
+		/// @param[in] stream The other stream.
+		/// @return Number of bytes written.
+		/// @note The current position is not changed.
+		int64_t writeTo(StreamBase& stream) const;
+
+	protected:
+		/// @brief Size of each block.
+		int blockSize;
+		/// @brief The blocks.
+		Array<unsigned char*> blocks;
+		/// @brief Current position.
+		int64_t chainPosition;
+
+		/// @brief Updates internal data size.
+		/// @note The data size is already kept up to date by every write so this does nothing.
+		void _updateDataSize() override;
+
+		/// @brief Reads data from the blocks.
+		/// @param[in] buffer Destination data buffer.
+		/// @param[in] count Number of elements to read.
+		/// @return Number of bytes read.
+		int _read(void* buffer, int count) override;
+		/// @brief Writes data to the blocks and adds new blocks if needed.
+		/// @param[in] buffer Source data buffer.
+		/// @param[in] count Number of elements contained in buffer.
+		/// @return Number of bytes written.
+		int _write(const void* buffer, int count) override;
+		/// @brief Checks if the StreamChain is open.
+		/// @return Always true.
+		bool _isOpen() const override;
+		/// @brief Gets current position.
+		/// @return Current position.
+		int64_t _position() const override;
+		/// @brief Seeks to position.
+		/// @param[in] offset Seeking offset in bytes.
+		/// @param[in] seekMode Seeking mode.
+		/// @return True if successful.
+		bool _seek(int64_t offset, SeekMode seekMode = SeekMode::Current) override;
+
+	private:
+		/// @brief Copy constructor.
+		/// @note Usage is not allowed and it will throw an exception.
+		StreamChain(const StreamChain& other);
+		/// @brief Assignment operator.
+		/// @note Usage is not allowed and it will throw an exception.
+		StreamChain& operator=(StreamChain& other);
+
+	};
+}
+
+/// @brief Alias for simpler code.
+typedef hltypes::StreamChain hstreamchain;
+
+#endif
+
@@ -0,0 +1,216 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+///
+/// @section DESCRIPTION
+///
+/// Provides fast reading of data in memory in the same format as StreamBase.
+
+#ifndef HLTYPES_STREAM_READER_H
+#define HLTYPES_STREAM_READER_H
+
+#include <stdint.h>
+#include <string.h>
+
+#include "hexception.h"
+#include "hltypesExport.h"
+#include "hltypesUtil.h"
+#include "hspan.h"
+#include "hstring.h"
+
+namespace hltypes
+{
+	class Stream;
+
+	/// @brief Provides fast reading of data in memory in the same format as StreamBase.
+	/// @note This is a simple cursor without virtual calls. All loading methods are inlined.
+	/// @note Works with anything that converts to a Span such as Stream, StreamView and MappedFile. The data is not copied and has to stay valid.
+	/// @note Every load is checked against the end of the data. For data that has already been validated, checking can be disabled.
+	/// Use require() once per record to check everything that the record is going to read.
+	class hltypesExport StreamReader
+	{
+	public:
+		/// @brief Constructor.
+		/// @param[in] data The data.
+		/// @param[in] position Starting position.
+		StreamReader(Span<const unsigned char> data, int position = 0);
+		/// @brief Constructor.
+		/// @param[in] stream The Stream.
+		/// @note Starts at the current position of the Stream. The position of the Stream is not changed.
+		StreamReader(const Stream& stream);
+		/// @brief Gets the current position.
+		/// @return The current position.
+		HL_DEFINE_GET(int, position, Position);
+		/// @brief Gets the size of the data.
+		/// @return The size of the data.
+		HL_DEFINE_GET(int, size, Size);
+		/// @brief Checks whether loads are checked against the end of the data.
+		/// @return True if loads are checked against the end of the data.
+		/// @note Without checking, reading past the end of the data is undefined behavior.
+		HL_DEFINE_ISSET(checked, Checked);
+
+		/// @brief Gets the number of bytes that are left.
+		/// @return The number of bytes that are left.
+		inline int remaining() const { return (this->size - this->position); }
+		/// @brief Checks if the end of the data has been reached.
+		/// @return True if the end of the data has been reached.
+		inline bool eof() const { return (this->position >= this->size); }
+		/// @brief Makes sure that a number of bytes can be read.
+		/// @param[in] count Number of bytes.
+		/// @note Throws an exception if not enough bytes are left, even if checking is disabled.
+		inline void require(int count) const
+		{
+			if (count < 0 || count > this->size - this->position)
+			{
+				throw ContainerRangeException(this->position, count);
+			}
+		}
+		/// @brief Sets the current position.
+		/// @param[in] position The new position.
+		void seek(int position);
+		/// @brief Skips bytes.
+		/// @param[in] count Number of bytes to skip. Use seek() to move back.
+		inline void skip(int count)
+		{
+			this->_check(count);
+			this->position += count;
+		}
+
+		/// @brief Loads data in a platform-aware format.
+		/// @return Loaded char.
+		inline char loadInt8() { return (char)this->_load<unsigned char>(); }
+		/// @brief Loads data in a platform-aware format.
+		/// @return Loaded unsigned char.
+		inline unsigned char loadUint8() { return this->_load<unsigned char>(); }
+		/// @brief Loads data in a platform-aware format.
+		/// @return Loaded short.
+		inline short loadInt16() { return (short)this->_load<unsigned short>(); }
+		/// @brief Loads data in a platform-aware format.
+		/// @return Loaded unsigned short.
+		inline unsigned short loadUint16() { return this->_load<unsigned short>(); }
+		/// @brief Loads data in a platform-aware format.
+		/// @return Loaded int32.
+		inline int loadInt32() { return (int)this->_load<unsigned int>(); }
+		/// @brief Loads data in a platform-aware format.
+		/// @return Loaded unsigned int32.
+		inline unsigned int loadUint32() { return this->_load<unsigned int>(); }
+		/// @brief Loads data in a platform-aware format.
+		/// @return Loaded int64.
+		inline int64_t loadInt64() { return (int64_t)this->_load<uint64_t>(); }
+		/// @brief Loads data in a platform-aware format.
+		/// @return Loaded unsigned int64.
+		inline uint64_t loadUint64() { return this->_load<uint64_t>(); }
+		/// @brief Loads data in a platform-aware format.
+		/// @return Loaded float.
+		inline float loadFloat() { return this->_load<float>(); }
+		/// @brief Loads data in a platform-aware format.
+		/// @return Loaded double.
+		inline double loadDouble() { return this->_load<double>(); }
+		/// @brief Loads data in a platform-aware format.
+		/// @return Loaded bool.
+		inline bool loadBool() { return (this->_load<unsigned char>() != 0); }
+		/// @brief Loads data in a platform-aware format.
+		/// @return Loaded String.
+		/// @note The size of the String is always checked.
+		inline String loadString()
+		{
+			int count = this->loadInt32();
+			this->require(count);
+			String result((const char*)this->data + this->position, count);
+			this->position += count;
+			return result;
+		}
+		/// @brief Loads an unsigned integer that was stored as a LEB128 varint.
+		/// @return Loaded value.
+		/// @see StreamBase::dumpVarint()
+		inline uint64_t loadVarint()
+		{
+			uint64_t result = 0ULL;
+			unsigned char byte = 0;
+			for (int shift = 0; shift < 64; shift += 7)
+			{
+				byte = this->_load<unsigned char>();
+				result |= (uint64_t)(byte & 0x7F) << shift;
+				if ((byte & 0x80) == 0)
+				{
+					return result;
+				}
+			}
+			throw Exception("Invalid varint in data");
+		}
+		/// @brief Loads a signed integer that was stored as a zigzag-encoded LEB128 varint.
+		/// @return Loaded value.
+		/// @see StreamBase::dumpZigzag()
+		inline int64_t loadZigzag()
+		{
+			uint64_t value = this->loadVarint();
+			return ((int64_t)(value >> 1) ^ -(int64_t)(value & 1));
+		}
+		/// @brief Copies raw data.
+		/// @param[out] buffer Destination buffer.
+		/// @param[in] count Number of bytes to copy.
+		inline void readRaw(void* buffer, int count)
+		{
+			this->_check(count);
+			memcpy(buffer, this->data + this->position, count);
+			this->position += count;
+		}
+		/// @brief Reads raw data without copying it.
+		/// @param[in] count Number of bytes to read.
+		/// @return Span of the read data.
+		inline Span<const unsigned char> readView(int count)
+		{
+			this->_check(count);
+			Span<const unsigned char> result(this->data + this->position, count);
+			this->position += count;
+			return result;
+		}
+
+	protected:
+		/// @brief The data.
+		const unsigned char* data;
+		/// @brief Size of the data.
+		int size;
+		/// @brief Current position.
+		int position;
+		/// @brief Whether loads are checked against the end of the data.
+		bool checked;
+
+		/// @brief Checks if a number of bytes can be read when checking is enabled.
+		/// @param[in] count Number of bytes.
+		/// @note A negative count is always rejected. For constant counts the compiler removes that check.
+		inline void _check(int count) const
+		{
+			if (count < 0 || (this->checked && count > this->size - this->position))
+			{
+				throw ContainerRangeException(this->position, count);
+			}
+		}
+		/// @brief Loads a value stored in little-endian byte order.
+		/// @return The value.
+		template <typename T>
+		inline T _load()
+		{
+			this->_check((int)sizeof(T));
+			T value;
+			// memcpy is optimized away and is safe for unaligned data
+			memcpy(&value, this->data + this->position, sizeof(T));
+#ifdef __BIG_ENDIAN__
+			hswapBytes(&value, 1, (int)sizeof(T));
+#endif
+			this->position += (int)sizeof(T);
+			return value;
+		}
+
+	};
+}
+
+/// @brief Alias for simpler code.
+typedef hltypes::StreamReader hstreamreader;
+
+#endif
+
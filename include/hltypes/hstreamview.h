@@ -0,0 +1,103 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+///
+/// @section DESCRIPTION
+///
+/// Provides read-only data streaming from external memory.
+
+#ifndef HLTYPES_STREAM_VIEW_H
+#define HLTYPES_STREAM_VIEW_H
+
+#include <stdint.h>
+
+#include "hltypesExport.h"
+#include "hsbase.h"
+#include "hspan.h"
+#include "hstring.h"
+
+namespace hltypes
+{
+	/// @brief Provides read-only data streaming from external memory.
+	/// @note The data is not copied. It has to stay valid for as long as the StreamView is used.
+	/// @note Writing is not allowed and it will throw an exception.
+	class hltypesExport StreamView : public StreamBase
+	{
+	public:
+		/// @brief Constructor.
+		/// @param[in] data The external data.
+		/// @param[in] size Size of the external data in bytes.
+		StreamView(const void* data, int64_t size);
+		/// @brief Constructor.
+		/// @param[in] data Span of the external data.
+		StreamView(Span<const unsigned char> data);
+		/// @brief Destructor.
+		~StreamView();
+
+		/// @brief Gets the viewed data.
+		/// @return Span of the viewed data.
+		Span<const unsigned char> span() const;
+		/// @brief Reads data from the current position without copying it.
+		/// @param[in] count Number of bytes to read.
+		/// @return Span of the read data. It is shorter than count if the end of the data has been reached.
+		Span<const unsigned char> readView(int count);
+
+		/// @brief Same as span().
+		/// @see span()
+		operator Span<const unsigned char>() const;
+
+	protected:
+		/// @brief The viewed data.
+		const unsigned char* data;
+		/// @brief Current position.
+		int64_t dataPosition;
+
+		/// @brief Gets special descriptor.
+		/// @return Special descriptor.
+		String _descriptor() const override;
+		/// @brief Updates internal data size.
+		/// @note The size of the viewed data does not change so this does nothing.
+		void _updateDataSize() override;
+
+		/// @brief Reads data from the viewed memory.
+		/// @param[in] buffer Destination data buffer.
+		/// @param[in] count Number of elements to read.
+		/// @return Number of bytes read.
+		int _read(void* buffer, int count) override;
+		/// @brief Always throws an exception since the data is read-only.
+		/// @param[in] buffer Source data buffer.
+		/// @param[in] count Number of elements contained in buffer.
+		/// @return Number of bytes written.
+		int _write(const void* buffer, int count) override;
+		/// @brief Checks if the StreamView is open.
+		/// @return Always true.
+		bool _isOpen() const override;
+		/// @brief Gets current position.
+		/// @return Current position.
+		int64_t _position() const override;
+		/// @brief Seeks to position.
+		/// @param[in] offset Seeking offset in bytes.
+		/// @param[in] seekMode Seeking mode.
+		/// @return True if successful.
+		bool _seek(int64_t offset, SeekMode seekMode = SeekMode::Current) override;
+
+	private:
+		/// @brief Copy constructor.
+		/// @note Usage is not allowed and it will throw an exception.
+		StreamView(const StreamView& other);
+		/// @brief Assignment operator.
+		/// @note Usage is not allowed and it will throw an exception.
+		StreamView& operator=(StreamView& other);
+
+	};
+}
+
+/// @brief Alias for simpler code.
+typedef hltypes::StreamView hstreamview;
+
+#endif
+
@@ -0,0 +1,211 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+///
+/// @section DESCRIPTION
+///
+/// Provides fast writing of data to memory in the same format as StreamBase.
+
+#ifndef HLTYPES_STREAM_WRITER_H
+#define HLTYPES_STREAM_WRITER_H
+
+#include <stdint.h>
+#include <string.h>
+
+#include "hexception.h"
+#include "hltypesExport.h"
+#include "hltypesUtil.h"
+#include "hspan.h"
+#include "hstring.h"
+
+namespace hltypes
+{
+	class Stream;
+
+	/// @brief Provides fast writing of data to memory in the same format as StreamBase.
+	/// @note This is a simple cursor without virtual calls. All dumping methods are inlined.
+	/// @note It writes either into a Span of fixed size or into a Stream which grows as needed.
+	/// @note Every store is checked against the end of the available memory. For a Stream, more memory is allocated when needed.
+	/// When checking is disabled, require() has to be used to make sure that there is enough memory, e.g. once per record.
+	class hltypesExport StreamWriter
+	{
+	public:
+		/// @brief Constructor.
+		/// @param[in] data The memory where data is written.
+		/// @param[in] position Starting position.
+		StreamWriter(Span<unsigned char> data, int position = 0);
+		/// @brief Constructor.
+		/// @param[in] stream The Stream where data is written.
+		/// @note Starts at the current position of the Stream.
+		/// @note The size and position of the Stream are only updated by finish().
+		StreamWriter(Stream& stream);
+		/// @brief Destructor.
+		/// @note Calls finish(). Errors are only logged, call finish() explicitly to handle them.
+		~StreamWriter();
+		/// @brief Gets the current position.
+		/// @return The current position.
+		HL_DEFINE_GET(int, position, Position);
+		/// @brief Gets the size of the available memory.
+		/// @return The size of the available memory.
+		HL_DEFINE_GET(int, capacity, Capacity);
+		/// @brief Checks whether stores are checked against the end of the available memory.
+		/// @return True if stores are checked against the end of the available memory.
+		/// @note Without checking, writing past the end of the available memory is undefined behavior.
+		HL_DEFINE_ISSET(checked, Checked);
+
+		/// @brief Gets the number of bytes that can be written without allocating more memory.
+		/// @return The number of bytes that can be written without allocating more memory.
+		inline int remaining() const { return (this->capacity - this->position); }
+		/// @brief Makes sure that a number of bytes can be written.
+		/// @param[in] count Number of bytes.
+		/// @note For a Stream, more memory is allocated if needed. Otherwise an exception is thrown if there is not enough memory.
+		inline void require(int count)
+		{
+			if (count < 0 || count > this->capacity - this->position)
+			{
+				this->_grow(count);
+			}
+		}
+		/// @brief Writes the size and the position back to the Stream.
+		/// @note Does nothing when writing into a Span.
+		void finish();
+
+		/// @brief Dumps data in a platform-aware format.
+		/// @param c char to dump.
+		inline void dump(char c) { this->_store((unsigned char)c); }
+		/// @brief Dumps data in a platform-aware format.
+		/// @param c unsigned char to dump.
+		inline void dump(unsigned char c) { this->_store(c); }
+		/// @brief Dumps data in a platform-aware format.
+		/// @param s short to dump.
+		inline void dump(short s) { this->_store((unsigned short)s); }
+		/// @brief Dumps data in a platform-aware format.
+		/// @param s unsigned short to dump.
+		inline void dump(unsigned short s) { this->_store(s); }
+		/// @brief Dumps data in a platform-aware format.
+		/// @param i int to dump.
+		inline void dump(int i) { this->_store((unsigned int)i); }
+		/// @brief Dumps data in a platform-aware format.
+		/// @param i unsigned int to dump.
+		inline void dump(unsigned int i) { this->_store(i); }
+		/// @brief Dumps data in a platform-aware format.
+		/// @param l int64 to dump.
+		inline void dump(int64_t l) { this->_store((uint64_t)l); }
+		/// @brief Dumps data in a platform-aware format.
+		/// @param l unsigned int64 to dump.
+		inline void dump(uint64_t l) { this->_store(l); }
+		/// @brief Dumps data in a platform-aware format.
+		/// @param f float to dump.
+		inline void dump(float f) { this->_store(f); }
+		/// @brief Dumps data in a platform-aware format.
+		/// @param d double to dump.
+		inline void dump(double d) { this->_store(d); }
+		/// @brief Dumps data in a platform-aware format.
+		/// @param b bool to dump.
+		inline void dump(bool b) { this->_store((unsigned char)(b ? 1 : 0)); }
+		/// @brief Dumps data in a platform-aware format.
+		/// @param string String to dump.
+		inline void dump(const String& string)
+		{
+			int size = string.size();
+			this->dump(size);
+			this->writeRaw(string.cStr(), size);
+		}
+		/// @brief Dumps an unsigned integer as a LEB128 varint.
+		/// @param[in] value The value.
+		/// @see StreamBase::dumpVarint()
+		inline void dumpVarint(uint64_t value)
+		{
+			while (value >= 0x80)
+			{
+				this->_store((unsigned char)(value | 0x80));
+				value >>= 7;
+			}
+			this->_store((unsigned char)value);
+		}
+		/// @brief Dumps a signed integer as a zigzag-encoded LEB128 varint.
+		/// @param[in] value The value.
+		/// @see StreamBase::dumpZigzag()
+		inline void dumpZigzag(int64_t value)
+		{
+			this->dumpVarint(((uint64_t)value << 1) ^ (uint64_t)(value >> 63));
+		}
+		/// @brief Copies raw data.
+		/// @param[in] buffer Source buffer.
+		/// @param[in] count Number of bytes to copy.
+		inline void writeRaw(const void* buffer, int count)
+		{
+			this->_check(count);
+			memcpy(this->data + this->position, buffer, count);
+			this->position += count;
+		}
+
+	protected:
+		/// @brief The memory where data is written.
+		unsigned char* data;
+		/// @brief Size of the available memory.
+		int capacity;
+		/// @brief Current position.
+		int position;
+		/// @brief Whether stores are checked against the end of the available memory.
+		bool checked;
+		/// @brief The Stream where data is written.
+		Stream* stream;
+		/// @brief Position in the Stream where writing started.
+		int64_t streamStart;
+
+		/// @brief Makes sure that a number of bytes can be written when checking is enabled.
+		/// @param[in] count Number of bytes.
+		/// @note A negative count is always rejected. For constant counts the compiler removes that check.
+		inline void _check(int count)
+		{
+			if (count < 0)
+			{
+				this->_throwRange(count);
+			}
+			if (this->checked && count > this->capacity - this->position)
+			{
+				this->_grow(count);
+			}
+		}
+		/// @brief Allocates more memory in the Stream or throws an exception.
+		/// @param[in] count Number of bytes that have to fit.
+		void _grow(int count);
+		/// @brief Throws an exception for a number of bytes that cannot be written.
+		/// @param[in] count Number of bytes.
+		/// @note Marked as not returning so the compiler knows that count is not negative after _check().
+		[[noreturn]] void _throwRange(int count) const;
+		/// @brief Stores a value in little-endian byte order.
+		/// @param[in] value The value.
+		template <typename T>
+		inline void _store(T value)
+		{
+			this->_check((int)sizeof(T));
+#ifdef __BIG_ENDIAN__
+			hswapBytes(&value, 1, (int)sizeof(T));
+#endif
+			// memcpy is optimized away and is safe for unaligned data
+			memcpy(this->data + this->position, &value, sizeof(T));
+			this->position += (int)sizeof(T);
+		}
+
+	private:
+		/// @brief Copy constructor.
+		/// @note Usage is not allowed and it will throw an exception.
+		StreamWriter(const StreamWriter& other);
+		/// @brief Assignment operator.
+		/// @note Usage is not allowed and it will throw an exception.
+		StreamWriter& operator=(StreamWriter& other);
+
+	};
+}
+
+/// @brief Alias for simpler code.
+typedef hltypes::StreamWriter hstreamwriter;
+
+#endif
+
@@ -15,6 +15,7 @@
 
 #include <stdarg.h>
 #include <stdint.h>
+#include <memory>
 #include <string>
 
 #include "hltypesExport.h"
@@ -33,7 +34,8 @@ namespace std
 
 namespace hltypes
 {
-	template <typename T> class Array;
+	template <typename T, typename A = std::allocator<T> > class Array;
+	template <typename T> class Span;
 	
 	/// @brief Encapsulates std::string and adds high level methods.
 	class hltypesExport String : std::basic_string<char>
@@ -54,6 +56,9 @@ namespace hltypes
 		/// @brief Copy constructor.
 		/// @param[in] string String to copy.
 		String(const String& string);
+		/// @brief Move constructor.
+		/// @param[in] string String to move. It is empty afterwards.
+		String(String&& string);
 		/// @brief Copy constructor.
 		/// @param[in] string A C-type string.
 		/// @param[in] length How many characters to copy.
@@ -778,6 +783,10 @@ namespace hltypes
 		/// @param[in] string String value.
 		/// @return This modified String.
 		String operator=(const String& string);
+		/// @brief Moves String into this one.
+		/// @param[in] string String value. It is empty afterwards.
+		/// @return This modified String.
+		String& operator=(String&& string);
 		/// @brief Converts bool into String.
 		/// @param[in] b Bool value.
 		/// @return This modified String.
@@ -1023,22 +1032,84 @@ namespace hltypes
 		/// @param[in] string The unsigned char string.
 		/// @return UTF-8 string.
 		static String fromUnicode(const unsigned char* string);
+		/// @brief Converts unicode unsigned int characters to a UTF-8 string.
+		/// @param[in] chars The unsigned int characters.
+		/// @return UTF-8 string.
+		static String fromUnicode(Span<const unsigned int> chars);
+		/// @brief Converts unicode wchar characters to a UTF-8 string.
+		/// @param[in] chars The wchar characters.
+		/// @return UTF-8 string.
+		static String fromUnicode(Span<const wchar_t> chars);
+		/// @brief Converts char characters to a UTF-8 string.
+		/// @param[in] chars The char characters.
+		/// @return UTF-8 string.
+		static String fromUnicode(Span<const char> chars);
+		/// @brief Converts unsigned char characters to a UTF-8 string.
+		/// @param[in] chars The unsigned char characters.
+		/// @return UTF-8 string.
+		static String fromUnicode(Span<const unsigned char> chars);
 		/// @brief Converts a unicode unsigned int Array to a UTF-8 string.
 		/// @param[in] chars The unsigned int characters.
 		/// @return UTF-8 string.
-		static String fromUnicode(Array<unsigned int> chars);
+		/// @note Required since Array converts to both a C-type array and a Span.
+		static String fromUnicode(const Array<unsigned int>& chars);
 		/// @brief Converts a unicode wchar Array to a UTF-8 string.
 		/// @param[in] chars The wchar characters.
 		/// @return UTF-8 string.
-		static String fromUnicode(Array<wchar_t> chars);
+		/// @note Required since Array converts to both a C-type array and a Span.
+		static String fromUnicode(const Array<wchar_t>& chars);
 		/// @brief Converts a char Array to a UTF-8 string.
 		/// @param[in] chars The char characters.
 		/// @return UTF-8 string.
-		static String fromUnicode(Array<char> chars);
+		/// @note Required since Array converts to both a C-type array and a Span.
+		static String fromUnicode(const Array<char>& chars);
 		/// @brief Converts an unsigned char Array to a UTF-8 string.
 		/// @param[in] chars The unsigned char characters.
 		/// @return UTF-8 string.
-		static String fromUnicode(Array<unsigned char> chars);
+		/// @note Required since Array converts to both a C-type array and a Span.
+		static String fromUnicode(const Array<unsigned char>& chars);
+		/// @brief Joins Strings with a separator.
+		/// @param[in] strings The Strings.
+		/// @param[in] separator Separator between the Strings.
+		/// @return The joined String.
+		/// @note The exact size is computed first so the result is allocated only once.
+		static String join(Span<const String> strings, const String& separator);
+		/// @brief Joins numbers with a separator.
+		/// @param[in] values The numbers.
+		/// @param[in] separator Separator between the numbers.
+		/// @return The joined String.
+		/// @note The numbers are formatted directly into the result. The result is the same as when joining String(value) for every value.
+		static String join(Span<const int> values, const String& separator);
+		/// @brief Joins numbers with a separator.
+		/// @param[in] values The numbers.
+		/// @param[in] separator Separator between the numbers.
+		/// @return The joined String.
+		/// @note The numbers are formatted directly into the result. The result is the same as when joining String(value) for every value.
+		static String join(Span<const unsigned int> values, const String& separator);
+		/// @brief Joins numbers with a separator.
+		/// @param[in] values The numbers.
+		/// @param[in] separator Separator between the numbers.
+		/// @return The joined String.
+		/// @note The numbers are formatted directly into the result. The result is the same as when joining String(value) for every value.
+		static String join(Span<const int64_t> values, const String& separator);
+		/// @brief Joins numbers with a separator.
+		/// @param[in] values The numbers.
+		/// @param[in] separator Separator between the numbers.
+		/// @return The joined String.
+		/// @note The numbers are formatted directly into the result. The result is the same as when joining String(value) for every value.
+		static String join(Span<const uint64_t> values, const String& separator);
+		/// @brief Joins numbers with a separator.
+		/// @param[in] values The numbers.
+		/// @param[in] separator Separator between the numbers.
+		/// @return The joined String.
+		/// @note The result is the same as when joining String(value) for every value.
+		static String join(Span<const float> values, const String& separator);
+		/// @brief Joins numbers with a separator.
+		/// @param[in] values The numbers.
+		/// @param[in] separator Separator between the numbers.
+		/// @return The joined String.
+		/// @note The result is the same as when joining String(value) for every value.
+		static String join(Span<const double> values, const String& separator);
 
 	};
 }
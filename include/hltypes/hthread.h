@@ -17,6 +17,12 @@
 #include "hstring.h"
 #include "hltypesUtil.h"
 
+#ifndef HLTYPES_CACHE_LINE_SIZE
+/// @brief Size of a CPU cache line in bytes.
+/// @note Used to keep data that is written by different threads in separate cache lines.
+#define HLTYPES_CACHE_LINE_SIZE 64
+#endif
+
 namespace hltypes
 {
 	/// @brief Provides functionality of a Thread for multithreading.
@@ -81,6 +87,11 @@ namespace hltypes
 		/// @brief Puts current thread to sleep.
 		/// @param[in] milliseconds How long to sleep in milliseconds.
 		static void sleep(float milliseconds);
+		/// @brief Waits a bit in the current thread while polling for a condition.
+		/// @param[in] idleCount Number of times the caller has waited so far. Reset it to 0 when the condition was met.
+		/// @note The thread spins at first, then it yields and eventually it sleeps with a doubling sleep time from 50 us up to 1 ms.
+		/// @note On Windows sleeps shorter than 1 ms only yield because of the timer resolution.
+		static void backoff(int& idleCount);
 		
 	protected:
 		/// @brief Thread name.
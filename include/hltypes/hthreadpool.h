@@ -0,0 +1,140 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+///
+/// @section DESCRIPTION
+///
+/// Provides a pool of worker threads for parallel execution of jobs.
+
+#ifndef HLTYPES_THREAD_POOL_H
+#define HLTYPES_THREAD_POOL_H
+
+#include <condition_variable>
+#include <vector>
+
+#include "hltypesExport.h"
+#include "hmutex.h"
+#include "hstring.h"
+#include "hthread.h"
+
+namespace hltypes
+{
+	/// @brief Provides a pool of worker Threads that execute batches of jobs in parallel.
+	/// @note The Thread calling execute() also processes jobs while it waits for the batch to finish.
+	/// @note Idle workers and a caller waiting for the last jobs of a batch are blocked and do not use any CPU time.
+	class hltypesExport ThreadPool
+	{
+	public:
+		/// @brief Basic constructor.
+		/// @param[in] workerCount Number of worker threads. If negative, one less than the number of processors is used.
+		/// @param[in] name Name for the pool.
+		ThreadPool(int workerCount = -1, const String& name = "");
+		/// @brief Destructor.
+		~ThreadPool();
+
+		/// @brief Gets the pool name.
+		/// @return Pool name.
+		inline String getName() const { return this->name; }
+		/// @brief Gets the number of worker threads.
+		/// @return Number of worker threads.
+		inline int getWorkerCount() const { return (int)this->workers.size(); }
+
+		/// @brief Executes a batch of jobs and waits until all of them are finished.
+		/// @param[in] function Function pointer for the job callback that takes the job index and the user data.
+		/// @param[in] data User data passed to every job.
+		/// @param[in] count Number of jobs.
+		/// @note If the pool is already executing a batch (e.g. when called from within a job), the jobs are executed serially in the calling thread.
+		/// @note If a job throws any exception, the remaining jobs are still executed and an Exception is thrown afterwards.
+		void execute(void (*function)(int, void*), void* data, int count);
+
+		/// @brief Gets the number of available processors.
+		/// @return Number of available processors.
+		static int getProcessorCount();
+		/// @brief Gets the shared ThreadPool used by parallel Container algorithms.
+		/// @return The shared ThreadPool.
+		/// @note It is created on first use.
+		static ThreadPool* getShared();
+		/// @brief Destroys the shared ThreadPool and joins its threads.
+		/// @note A new one will be created on the next call to getShared().
+		static void destroyShared();
+
+	protected:
+		/// @brief Worker thread that knows its pool.
+		class Worker : public Thread
+		{
+		public:
+			/// @brief Associated pool.
+			ThreadPool* pool;
+
+			/// @brief Basic constructor.
+			/// @param[in] pool Associated pool.
+			/// @param[in] name Name for the thread.
+			Worker(ThreadPool* pool, const String& name);
+
+		};
+
+		/// @brief Pool name.
+		String name;
+		/// @brief Worker threads.
+		std::vector<Worker*> workers;
+		/// @brief Mutex protecting the batch state.
+		Mutex mutex;
+		/// @brief Whether a batch is being executed right now.
+		bool executing;
+		/// @brief Job callback of the current batch.
+		void (*function)(int, void*);
+		/// @brief User data of the current batch.
+		void* data;
+		/// @brief Number of jobs in the current batch.
+		int jobCount;
+		/// @brief Index of the next job that has not been started yet.
+		int nextJob;
+		/// @brief Number of finished jobs in the current batch.
+		int finishedJobs;
+		/// @brief Error message of the first job that failed in the current batch.
+		String errorMessage;
+		/// @brief Whether a job failed in the current batch.
+		bool failed;
+		/// @brief Whether the workers have to exit.
+		bool stopping;
+		/// @brief Signaled when a new batch is started or the pool is destroyed.
+		std::condition_variable_any jobsAvailable;
+		/// @brief Signaled when the last job of the current batch is finished.
+		std::condition_variable_any batchFinished;
+
+		/// @brief The shared ThreadPool.
+		static ThreadPool* shared;
+		/// @brief Mutex protecting the shared ThreadPool.
+		static Mutex sharedMutex;
+
+		/// @brief Takes the next job of the current batch and executes it.
+		/// @return True if a job was executed.
+		bool _executeNextJob();
+		/// @brief Records the failure of a job in the current batch.
+		/// @param[in] message Error message.
+		/// @note Only the first failure of a batch is kept.
+		void _fail(const String& message);
+
+		/// @brief Worker thread loop.
+		/// @param[in] thread The Worker thread.
+		static void _work(Thread* thread);
+
+	private:
+		/// @brief Copy constructor.
+		/// @note Usage is not allowed and it will throw an exception.
+		ThreadPool(const ThreadPool& other);
+		/// @brief Assignment operator.
+		/// @note Usage is not allowed and it will throw an exception.
+		ThreadPool& operator=(ThreadPool& other);
+
+	};
+}
+
+/// @brief Alias for simpler code.
+typedef hltypes::ThreadPool hthreadpool;
+
+#endif
@@ -18,7 +18,7 @@
 
 namespace hltypes
 {
-	template <typename T> class Array;
+	template <typename T, typename A> class Array;
 
 	/// @brief Provides versioning functionality.
 	class hltypesExport Version
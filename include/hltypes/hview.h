@@ -0,0 +1,350 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+///
+/// @section DESCRIPTION
+///
+/// Provides lazy views over Containers and Maps that process all stages in a single pass.
+
+#ifndef HLTYPES_VIEW_H
+#define HLTYPES_VIEW_H
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "hstring.h"
+
+namespace hltypes
+{
+	/// @brief View stage that passes all elements of an iterator range.
+	template <typename I>
+	class _ViewRange
+	{
+	public:
+		typedef typename std::iterator_traits<I>::value_type value_type;
+
+		inline _ViewRange(I begin, I end, int size) : begin(begin), end(end), size(size)
+		{
+		}
+		/// @brief Gets the exact number of elements or -1 if it is not known in advance.
+		inline int _size() const
+		{
+			return this->size;
+		}
+		/// @brief Passes elements to sink until sink returns false.
+		/// @return False if sink stopped the iteration.
+		template <typename F>
+		inline bool _run(F& sink) const
+		{
+			for (I it = this->begin; it != this->end; ++it)
+			{
+				if (!sink(*it))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+	protected:
+		I begin;
+		I end;
+		int size;
+
+	};
+
+	/// @brief View stage that passes the keys of a Map.
+	template <typename I>
+	class _ViewMapKeys : public _ViewRange<I>
+	{
+	public:
+		typedef typename std::remove_const<typename std::iterator_traits<I>::value_type::first_type>::type value_type;
+
+		inline _ViewMapKeys(I begin, I end, int size) : _ViewRange<I>(begin, end, size)
+		{
+		}
+		template <typename F>
+		inline bool _run(F& sink) const
+		{
+			for (I it = this->begin; it != this->end; ++it)
+			{
+				if (!sink(it->first))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+	};
+
+	/// @brief View stage that passes the values of a Map.
+	template <typename I>
+	class _ViewMapValues : public _ViewRange<I>
+	{
+	public:
+		typedef typename std::iterator_traits<I>::value_type::second_type value_type;
+
+		inline _ViewMapValues(I begin, I end, int size) : _ViewRange<I>(begin, end, size)
+		{
+		}
+		template <typename F>
+		inline bool _run(F& sink) const
+		{
+			for (I it = this->begin; it != this->end; ++it)
+			{
+				if (!sink(it->second))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+	};
+
+	/// @brief View stage that passes only elements that match a condition.
+	template <typename S, typename P>
+	class _ViewWhere
+	{
+	public:
+		typedef typename S::value_type value_type;
+
+		inline _ViewWhere(const S& source, P condition) : source(source), condition(condition)
+		{
+		}
+		inline int _size() const
+		{
+			return -1;
+		}
+		template <typename F>
+		inline bool _run(F& sink) const
+		{
+			const P& condition = this->condition;
+			auto filter = [&sink, &condition](const value_type& value) -> bool
+			{
+				return (!condition(value) || sink(value));
+			};
+			return this->source._run(filter);
+		}
+
+	protected:
+		S source;
+		P condition;
+
+	};
+
+	/// @brief View stage that passes new elements obtained from the elements of the previous stage.
+	template <typename S, typename G>
+	class _ViewSelect
+	{
+	public:
+		typedef typename std::decay<decltype(std::declval<const G&>()(std::declval<const typename S::value_type&>()))>::type value_type;
+
+		inline _ViewSelect(const S& source, G generate) : source(source), generate(generate)
+		{
+		}
+		inline int _size() const
+		{
+			return this->source._size();
+		}
+		template <typename F>
+		inline bool _run(F& sink) const
+		{
+			const G& generate = this->generate;
+			auto transform = [&sink, &generate](const typename S::value_type& value) -> bool
+			{
+				return sink(generate(value));
+			};
+			return this->source._run(transform);
+		}
+
+	protected:
+		S source;
+		G generate;
+
+	};
+
+	/// @brief View stage that passes at most a number of elements and then stops the previous stages.
+	template <typename S>
+	class _ViewTake
+	{
+	public:
+		typedef typename S::value_type value_type;
+
+		inline _ViewTake(const S& source, int count) : source(source), count(count < 0 ? 0 : count)
+		{
+		}
+		inline int _size() const
+		{
+			int size = this->source._size();
+			return (size >= 0 ? (size < this->count ? size : this->count) : -1);
+		}
+		template <typename F>
+		inline bool _run(F& sink) const
+		{
+			if (this->count == 0)
+			{
+				return true;
+			}
+			int remaining = this->count;
+			auto limit = [&sink, &remaining](const value_type& value) -> bool
+			{
+				--remaining;
+				return (sink(value) && remaining > 0);
+			};
+			// stopping because the limit has been reached is not a stop requested by the sink
+			return (this->source._run(limit) || remaining == 0);
+		}
+
+	protected:
+		S source;
+		int count;
+
+	};
+
+	/// @brief View stage that drops a number of elements and passes the rest.
+	template <typename S>
+	class _ViewSkip
+	{
+	public:
+		typedef typename S::value_type value_type;
+
+		inline _ViewSkip(const S& source, int count) : source(source), count(count < 0 ? 0 : count)
+		{
+		}
+		inline int _size() const
+		{
+			int size = this->source._size();
+			return (size >= 0 ? (size > this->count ? size - this->count : 0) : -1);
+		}
+		template <typename F>
+		inline bool _run(F& sink) const
+		{
+			int remaining = this->count;
+			auto drop = [&sink, &remaining](const value_type& value) -> bool
+			{
+				if (remaining > 0)
+				{
+					--remaining;
+					return true;
+				}
+				return sink(value);
+			};
+			return this->source._run(drop);
+		}
+
+	protected:
+		S source;
+		int count;
+
+	};
+
+	/// @brief Lazy view that chains stages like where(), select() and take() without creating intermediate Containers.
+	/// @note Nothing is processed until a terminal method like toArray() or count() is called. All stages then run in a single pass.
+	/// @note take() stops the iteration early, e.g. where() is not called for elements after the last taken element.
+	/// @note A View only refers to the elements of the Container or Map it was created from, it must not outlive it.
+	/// @note Conditions and generation functions can be function pointers, function objects or lambdas.
+	template <typename S>
+	class View
+	{
+	public:
+		/// @brief Type of the elements of this View.
+		typedef typename S::value_type value_type;
+
+		/// @brief Basic constructor.
+		/// @param[in] source The last stage.
+		inline explicit View(const S& source) : source(source)
+		{
+		}
+
+		/// @brief Creates a View that only contains elements that match a condition.
+		/// @param[in] conditionFunction Callable that takes one element and returns bool.
+		/// @return A new View.
+		template <typename P>
+		inline View<_ViewWhere<S, P> > where(P conditionFunction) const
+		{
+			return View<_ViewWhere<S, P> >(_ViewWhere<S, P>(this->source, conditionFunction));
+		}
+		/// @brief Creates a View with new elements obtained from the elements of this View.
+		/// @param[in] generateFunction Callable that takes one element and returns the new element.
+		/// @return A new View.
+		template <typename G>
+		inline View<_ViewSelect<S, G> > select(G generateFunction) const
+		{
+			return View<_ViewSelect<S, G> >(_ViewSelect<S, G>(this->source, generateFunction));
+		}
+		/// @brief Creates a View with at most the first count elements of this View.
+		/// @param[in] count Maximum number of elements.
+		/// @return A new View.
+		inline View<_ViewTake<S> > take(int count) const
+		{
+			return View<_ViewTake<S> >(_ViewTake<S>(this->source, count));
+		}
+		/// @brief Creates a View without the first count elements of this View.
+		/// @param[in] count Number of elements to skip.
+		/// @return A new View.
+		inline View<_ViewSkip<S> > skip(int count) const
+		{
+			return View<_ViewSkip<S> >(_ViewSkip<S>(this->source, count));
+		}
+
+		/// @brief Processes all stages and collects the elements.
+		/// @return A new Array with the elements.
+		/// @note Memory is reserved in advance if the number of elements is known, i.e. if there is no where().
+		inline Array<value_type> toArray() const
+		{
+			Array<value_type> result;
+			int size = this->source._size();
+			if (size > 0)
+			{
+				result.reserve(size);
+			}
+			auto collect = [&result](const value_type& value) -> bool
+			{
+				result.add(value);
+				return true;
+			};
+			this->source._run(collect);
+			return result;
+		}
+		/// @brief Processes all stages and counts the elements.
+		/// @return Number of elements.
+		inline int count() const
+		{
+			int result = 0;
+			auto increment = [&result](const value_type& value) -> bool
+			{
+				++result;
+				return true;
+			};
+			this->source._run(increment);
+			return result;
+		}
+		/// @brief Processes all stages and calls a function for every element.
+		/// @param[in] function Callable that takes one element.
+		template <typename F>
+		inline void forEach(F function) const
+		{
+			auto call = [&function](const value_type& value) -> bool
+			{
+				function(value);
+				return true;
+			};
+			this->source._run(call);
+		}
+
+	protected:
+		/// @brief The last stage.
+		S source;
+
+	};
+
+}
+
+#endif
@@ -0,0 +1,167 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <new>
+
+#include "hallocator.h"
+#include "hexception.h"
+#include "hltypesUtil.h"
+
+namespace hltypes
+{
+	Arena::Arena(int blockSize) :
+		blockIndex(0),
+		offset(0),
+		usedSize(0)
+	{
+		this->blockSize = hmax(blockSize, 1);
+	}
+
+	Arena::~Arena()
+	{
+		this->clear();
+	}
+
+	int64_t Arena::getCapacity() const
+	{
+		int64_t result = 0;
+		for_iter (i, 0, (int)this->blocks.size())
+		{
+			result += (int64_t)this->blocks[i].size;
+		}
+		return result;
+	}
+
+	void* Arena::allocate(size_t size, size_t alignment)
+	{
+		if (size == 0)
+		{
+			size = 1;
+		}
+		uintptr_t address = 0;
+		size_t padding = 0;
+		while (this->blockIndex < (int)this->blocks.size())
+		{
+			Block& block = this->blocks[this->blockIndex];
+			address = (uintptr_t)(block.data + this->offset);
+			padding = (size_t)((alignment - (address & (alignment - 1))) & (alignment - 1));
+			if (this->offset + padding + size <= block.size)
+			{
+				this->offset += padding + size;
+				this->usedSize += padding + size;
+				return (void*)(address + padding);
+			}
+			// remaining blocks are tried before allocating a new one since they may be left over from before reset()
+			++this->blockIndex;
+			this->offset = 0;
+		}
+		Block block;
+		block.size = hmax((size_t)this->blockSize, size + alignment);
+		block.data = (unsigned char*)::operator new(block.size);
+		this->blocks.push_back(block);
+		this->blockIndex = (int)this->blocks.size() - 1;
+		address = (uintptr_t)block.data;
+		padding = (size_t)((alignment - (address & (alignment - 1))) & (alignment - 1));
+		this->offset = padding + size;
+		this->usedSize += padding + size;
+		return (void*)(address + padding);
+	}
+
+	void Arena::reset()
+	{
+		this->blockIndex = 0;
+		this->offset = 0;
+		this->usedSize = 0;
+	}
+
+	void Arena::clear()
+	{
+		for_iter (i, 0, (int)this->blocks.size())
+		{
+			::operator delete(this->blocks[i].data);
+		}
+		this->blocks.clear();
+		this->reset();
+	}
+
+	Arena::Arena(const Arena& other)
+	{
+		throw ObjectCannotCopyException("hltypes::Arena");
+	}
+
+	Arena& Arena::operator=(Arena& other)
+	{
+		throw ObjectCannotAssignException("hltypes::Arena");
+		return (*this);
+	}
+
+	Pool::Pool(int elementSize, int alignment, int chunkCapacity) :
+		freeList(NULL)
+	{
+		// every free element has to be able to hold the pointer to the next free element
+		alignment = hmax(alignment, (int)sizeof(void*));
+		this->elementSize = (hmax(elementSize, 1) + alignment - 1) / alignment * alignment;
+		this->chunkCapacity = hmax(chunkCapacity, 1);
+	}
+
+	Pool::~Pool()
+	{
+		this->clear();
+	}
+
+	void* Pool::allocate()
+	{
+		if (this->freeList == NULL)
+		{
+			unsigned char* chunk = (unsigned char*)::operator new((size_t)this->elementSize * this->chunkCapacity);
+			this->chunks.push_back(chunk);
+			// elements are linked in reverse so they are handed out in ascending memory order
+			for_iter_r (i, this->chunkCapacity, 0)
+			{
+				*(void**)(chunk + i * this->elementSize) = this->freeList;
+				this->freeList = chunk + i * this->elementSize;
+			}
+		}
+		void* result = this->freeList;
+		this->freeList = *(void**)result;
+		return result;
+	}
+
+	void Pool::deallocate(void* pointer)
+	{
+		if (pointer != NULL)
+		{
+			*(void**)pointer = this->freeList;
+			this->freeList = pointer;
+		}
+	}
+
+	void Pool::clear()
+	{
+		for_iter (i, 0, (int)this->chunks.size())
+		{
+			::operator delete(this->chunks[i]);
+		}
+		this->chunks.clear();
+		this->freeList = NULL;
+	}
+
+	Pool::Pool(const Pool& other)
+	{
+		throw ObjectCannotCopyException("hltypes::Pool");
+	}
+
+	Pool& Pool::operator=(Pool& other)
+	{
+		throw ObjectCannotAssignException("hltypes::Pool");
+		return (*this);
+	}
+
+}
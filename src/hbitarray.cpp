@@ -0,0 +1,335 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+
+#include <stdint.h>
+#include <utility>
+
+#include "harray.h"
+#include "hbitarray.h"
+#include "hexception.h"
+#include "hltypesUtil.h"
+#include "hsimd.h"
+#include "hstring.h"
+
+#define ALL_BITS 0xFFFFFFFFFFFFFFFFULL
+
+namespace hltypes
+{
+	BitArray::BitArray() :
+		bitCount(0)
+	{
+	}
+
+	BitArray::BitArray(int size, bool value) :
+		bitCount(0)
+	{
+		this->resize(size, value);
+	}
+
+	BitArray::BitArray(const BitArray& other) :
+		words(other.words),
+		bitCount(other.bitCount)
+	{
+	}
+
+	BitArray::BitArray(BitArray&& other) :
+		words(std::move(other.words)),
+		bitCount(other.bitCount)
+	{
+		other.words.clear();
+		other.bitCount = 0;
+	}
+
+	BitArray::~BitArray()
+	{
+	}
+
+	BitArray& BitArray::operator=(const BitArray& other)
+	{
+		this->words = other.words;
+		this->bitCount = other.bitCount;
+		return (*this);
+	}
+
+	BitArray& BitArray::operator=(BitArray&& other)
+	{
+		if (this != &other)
+		{
+			this->words = std::move(other.words);
+			this->bitCount = other.bitCount;
+			other.words.clear();
+			other.bitCount = 0;
+		}
+		return (*this);
+	}
+
+	void BitArray::resize(int size, bool value)
+	{
+		if (size < 0)
+		{
+			throw ContainerIndexException(size);
+		}
+		int oldCount = this->bitCount;
+		this->words.resize((size + 63) >> 6, (value ? ALL_BITS : 0));
+		this->bitCount = size;
+		if (value && size > oldCount && (oldCount & 63) != 0)
+		{
+			// the added bits in the previously last word were 0 before
+			this->words[oldCount >> 6] |= (ALL_BITS << (oldCount & 63));
+		}
+		this->_clearUnusedBits();
+	}
+
+	void BitArray::clear()
+	{
+		this->words.clear();
+		this->bitCount = 0;
+	}
+
+	void BitArray::add(bool value)
+	{
+		if ((this->bitCount & 63) == 0)
+		{
+			this->words.push_back(0);
+		}
+		++this->bitCount;
+		this->set(this->bitCount - 1, value);
+	}
+
+	void BitArray::set()
+	{
+		for_iter (i, 0, (int)this->words.size())
+		{
+			this->words[i] = ALL_BITS;
+		}
+		this->_clearUnusedBits();
+	}
+
+	void BitArray::reset()
+	{
+		for_iter (i, 0, (int)this->words.size())
+		{
+			this->words[i] = 0;
+		}
+	}
+
+	void BitArray::flip()
+	{
+		for_iter (i, 0, (int)this->words.size())
+		{
+			this->words[i] = ~this->words[i];
+		}
+		this->_clearUnusedBits();
+	}
+
+	void BitArray::set(int start, int count, bool value)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+		if (start < 0 || count < 0 || start + count > this->bitCount)
+		{
+			throw ContainerRangeException(start, count);
+		}
+		int end = start + count;
+		int firstWord = start >> 6;
+		int lastWord = (end - 1) >> 6;
+		uint64_t firstMask = (ALL_BITS << (start & 63));
+		uint64_t lastMask = ((end & 63) == 0 ? ALL_BITS : ~(ALL_BITS << (end & 63)));
+		if (firstWord == lastWord)
+		{
+			firstMask &= lastMask;
+		}
+		if (value)
+		{
+			this->words[firstWord] |= firstMask;
+		}
+		else
+		{
+			this->words[firstWord] &= ~firstMask;
+		}
+		if (firstWord == lastWord)
+		{
+			return;
+		}
+		for_iter (i, firstWord + 1, lastWord)
+		{
+			this->words[i] = (value ? ALL_BITS : 0);
+		}
+		if (value)
+		{
+			this->words[lastWord] |= lastMask;
+		}
+		else
+		{
+			this->words[lastWord] &= ~lastMask;
+		}
+	}
+
+	int BitArray::count() const
+	{
+		int result = 0;
+		for_iter (i, 0, (int)this->words.size())
+		{
+			result += _bitCount64(this->words[i]);
+		}
+		return result;
+	}
+
+	bool BitArray::any() const
+	{
+		for_iter (i, 0, (int)this->words.size())
+		{
+			if (this->words[i] != 0)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool BitArray::all() const
+	{
+		int fullWords = this->bitCount >> 6;
+		for_iter (i, 0, fullWords)
+		{
+			if (this->words[i] != ALL_BITS)
+			{
+				return false;
+			}
+		}
+		if ((this->bitCount & 63) != 0)
+		{
+			return (this->words[fullWords] == ~(ALL_BITS << (this->bitCount & 63)));
+		}
+		return true;
+	}
+
+	int BitArray::findNext(int start) const
+	{
+		if (start < 0)
+		{
+			start = 0;
+		}
+		if (start >= this->bitCount)
+		{
+			return -1;
+		}
+		int index = start >> 6;
+		uint64_t word = this->words[index] & (ALL_BITS << (start & 63));
+		int size = (int)this->words.size();
+		while (word == 0)
+		{
+			++index;
+			if (index >= size)
+			{
+				return -1;
+			}
+			word = this->words[index];
+		}
+		return (index << 6) + _bitScanForward64(word);
+	}
+
+	Array<int> BitArray::indices() const
+	{
+		Array<int> result;
+		result.reserve(this->count());
+		uint64_t word = 0;
+		for_iter (i, 0, (int)this->words.size())
+		{
+			word = this->words[i];
+			while (word != 0)
+			{
+				result.add((i << 6) + _bitScanForward64(word));
+				word &= word - 1;
+			}
+		}
+		return result;
+	}
+
+	bool BitArray::equals(const BitArray& other) const
+	{
+		return (this->bitCount == other.bitCount && this->words == other.words);
+	}
+
+	BitArray& BitArray::operator&=(const BitArray& other)
+	{
+		this->_checkSize(other);
+		for_iter (i, 0, (int)this->words.size())
+		{
+			this->words[i] &= other.words[i];
+		}
+		return (*this);
+	}
+
+	BitArray& BitArray::operator|=(const BitArray& other)
+	{
+		this->_checkSize(other);
+		for_iter (i, 0, (int)this->words.size())
+		{
+			this->words[i] |= other.words[i];
+		}
+		return (*this);
+	}
+
+	BitArray& BitArray::operator^=(const BitArray& other)
+	{
+		this->_checkSize(other);
+		for_iter (i, 0, (int)this->words.size())
+		{
+			this->words[i] ^= other.words[i];
+		}
+		return (*this);
+	}
+
+	BitArray BitArray::operator&(const BitArray& other) const
+	{
+		BitArray result(*this);
+		result &= other;
+		return result;
+	}
+
+	BitArray BitArray::operator|(const BitArray& other) const
+	{
+		BitArray result(*this);
+		result |= other;
+		return result;
+	}
+
+	BitArray BitArray::operator^(const BitArray& other) const
+	{
+		BitArray result(*this);
+		result ^= other;
+		return result;
+	}
+
+	BitArray BitArray::operator~() const
+	{
+		BitArray result(*this);
+		result.flip();
+		return result;
+	}
+
+	void BitArray::_clearUnusedBits()
+	{
+		if ((this->bitCount & 63) != 0)
+		{
+			this->words[this->bitCount >> 6] &= ~(ALL_BITS << (this->bitCount & 63));
+		}
+	}
+
+	void BitArray::_checkSize(const BitArray& other) const
+	{
+		if (this->bitCount != other.bitCount)
+		{
+			throw Exception(hsprintf("BitArray sizes do not match: %d != %d", this->bitCount, other.bitCount));
+		}
+	}
+
+}
@@ -0,0 +1,249 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+
+#ifdef _ZIPRESOURCE
+#include <stdio.h>
+#define MINIZ_HEADER_FILE_ONLY
+#include <miniz.cpp>
+
+#include "hdeflatestream.h"
+#include "hexception.h"
+#include "hlog.h"
+#include "hstring.h"
+
+#define MIN_DEFLATE_BUFFER_SIZE 64
+#define GZIP_HEADER_SIZE 10
+
+namespace hltypes
+{
+	HL_ENUM_CLASS_DEFINE(DeflateStream::Format,
+	(
+		HL_ENUM_DEFINE(DeflateStream::Format, Zlib);
+		HL_ENUM_DEFINE(DeflateStream::Format, Gzip);
+		HL_ENUM_DEFINE(DeflateStream::Format, Raw);
+	));
+
+	HL_ENUM_CLASS_DEFINE(DeflateStream::Strategy,
+	(
+		HL_ENUM_DEFINE(DeflateStream::Strategy, Default);
+		HL_ENUM_DEFINE(DeflateStream::Strategy, Filtered);
+		HL_ENUM_DEFINE(DeflateStream::Strategy, HuffmanOnly);
+		HL_ENUM_DEFINE(DeflateStream::Strategy, Rle);
+		HL_ENUM_DEFINE(DeflateStream::Strategy, Fixed);
+	));
+
+	static int _getMinizStrategy(DeflateStream::Strategy strategy)
+	{
+		if (strategy == DeflateStream::Strategy::Filtered)
+		{
+			return miniz::MZ_FILTERED;
+		}
+		if (strategy == DeflateStream::Strategy::HuffmanOnly)
+		{
+			return miniz::MZ_HUFFMAN_ONLY;
+		}
+		if (strategy == DeflateStream::Strategy::Rle)
+		{
+			return miniz::MZ_RLE;
+		}
+		if (strategy == DeflateStream::Strategy::Fixed)
+		{
+			return miniz::MZ_FIXED;
+		}
+		return miniz::MZ_DEFAULT_STRATEGY;
+	}
+
+	DeflateStream::DeflateStream(StreamBase& stream, Format format, int level, Strategy strategy, int bufferSize) :
+		StreamBase(),
+		stream(stream),
+		format(format),
+		level(hclamp(level, 0, 9)),
+		strategy(strategy),
+		bufferSize(hmax(bufferSize, MIN_DEFLATE_BUFFER_SIZE)),
+		buffer(NULL),
+		zStream(NULL),
+		crc(MZ_CRC32_INIT),
+		compressedSize(0LL)
+	{
+		if (this->format == Format::Gzip)
+		{
+			// no file name, no modification time, unknown OS
+			unsigned char header[GZIP_HEADER_SIZE] = { 0x1F, 0x8B, MZ_DEFLATED, 0, 0, 0, 0, 0, 0, 0xFF };
+			this->stream.writeRaw(header, (int64_t)GZIP_HEADER_SIZE);
+			this->compressedSize += GZIP_HEADER_SIZE;
+		}
+		miniz::mz_stream* zStream = new miniz::mz_stream();
+		// zlib framing is done by miniz, gzip framing is done here around raw data
+		int windowBits = (this->format == Format::Zlib ? MZ_DEFAULT_WINDOW_BITS : -MZ_DEFAULT_WINDOW_BITS);
+		if (miniz::mz_deflateInit2(zStream, this->level, MZ_DEFLATED, windowBits, 9, _getMinizStrategy(this->strategy)) != miniz::MZ_OK)
+		{
+			delete zStream;
+			throw Exception("Could not initialize compression!");
+		}
+		this->zStream = zStream;
+		this->buffer = new unsigned char[this->bufferSize];
+	}
+
+	DeflateStream::~DeflateStream()
+	{
+		if (this->zStream != NULL)
+		{
+			// exceptions must not leave a destructor
+			try
+			{
+				this->finish();
+			}
+			catch (_Exception& e)
+			{
+				hlog::error(logTag, "Could not finish DeflateStream: " + e.getMessage());
+			}
+			catch (...)
+			{
+				hlog::error(logTag, "Could not finish DeflateStream!");
+			}
+		}
+	}
+
+	void DeflateStream::flush()
+	{
+		this->_validate();
+		this->_deflate(miniz::MZ_SYNC_FLUSH);
+	}
+
+	void DeflateStream::finish()
+	{
+		this->_validate();
+		miniz::mz_stream* zStream = (miniz::mz_stream*)this->zStream;
+		zStream->next_in = NULL;
+		zStream->avail_in = 0;
+		try
+		{
+			this->_deflate(miniz::MZ_FINISH);
+		}
+		catch (...)
+		{
+			this->_close();
+			throw;
+		}
+		this->_close();
+		if (this->format == Format::Gzip)
+		{
+			this->stream.dump(this->crc);
+			// the size is stored modulo 2^32
+			this->stream.dump((unsigned int)(this->dataSize & 0xFFFFFFFF));
+			this->compressedSize += 8;
+		}
+	}
+
+	String DeflateStream::_descriptor() const
+	{
+		return "deflatestream";
+	}
+
+	void DeflateStream::_updateDataSize()
+	{
+	}
+
+	void DeflateStream::_close()
+	{
+		miniz::mz_stream* zStream = (miniz::mz_stream*)this->zStream;
+		miniz::mz_deflateEnd(zStream);
+		delete zStream;
+		this->zStream = NULL;
+		delete[] this->buffer;
+		this->buffer = NULL;
+	}
+
+	void DeflateStream::_deflate(int flush)
+	{
+		miniz::mz_stream* zStream = (miniz::mz_stream*)this->zStream;
+		int result = miniz::MZ_OK;
+		int produced = 0;
+		while (true)
+		{
+			zStream->next_out = this->buffer;
+			zStream->avail_out = this->bufferSize;
+			result = miniz::mz_deflate(zStream, flush);
+			if (result < 0 && result != miniz::MZ_BUF_ERROR)
+			{
+				throw Exception(hsprintf("Could not compress data: %s", miniz::mz_error(result)));
+			}
+			produced = this->bufferSize - (int)zStream->avail_out;
+			if (produced > 0)
+			{
+				if (this->stream.writeRaw(this->buffer, (int64_t)produced) != produced)
+				{
+					throw Exception("Could not write compressed data!");
+				}
+				this->compressedSize += produced;
+			}
+			if (flush == miniz::MZ_FINISH ? (result == miniz::MZ_STREAM_END) : (zStream->avail_in == 0 && zStream->avail_out > 0))
+			{
+				break;
+			}
+			if (produced == 0 && result == miniz::MZ_BUF_ERROR)
+			{
+				throw Exception("Could not compress data!");
+			}
+		}
+	}
+
+	int DeflateStream::_read(void* buffer, int count)
+	{
+		throw Exception("Cannot read from hltypes::DeflateStream!");
+		return 0;
+	}
+
+	int DeflateStream::_write(const void* buffer, int count)
+	{
+		if (count <= 0)
+		{
+			return 0;
+		}
+		miniz::mz_stream* zStream = (miniz::mz_stream*)this->zStream;
+		zStream->next_in = (const unsigned char*)buffer;
+		zStream->avail_in = count;
+		this->_deflate(miniz::MZ_NO_FLUSH);
+		if (this->format == Format::Gzip)
+		{
+			this->crc = (unsigned int)miniz::mz_crc32(this->crc, (const unsigned char*)buffer, count);
+		}
+		this->dataSize += count;
+		return count;
+	}
+
+	bool DeflateStream::_isOpen() const
+	{
+		return (this->zStream != NULL);
+	}
+
+	int64_t DeflateStream::_position() const
+	{
+		return this->dataSize;
+	}
+
+	bool DeflateStream::_seek(int64_t offset, SeekMode seekMode)
+	{
+		// compressed data cannot be changed anymore once it was written
+		return (seekMode == SeekMode::Start ? offset == this->dataSize : offset == 0);
+	}
+
+	DeflateStream::DeflateStream(const DeflateStream& other) :
+		stream(other.stream)
+	{
+		throw ObjectCannotCopyException("hltypes::DeflateStream");
+	}
+
+	DeflateStream& DeflateStream::operator=(DeflateStream& other)
+	{
+		throw ObjectCannotAssignException("hltypes::DeflateStream");
+		return (*this);
+	}
+
+}
+#endif
@@ -9,8 +9,161 @@
 #include "henum.h"
 #include "hlog.h"
 
+// the lookup table is only used if it would not be larger than this factor times the number of values
+#define LOOKUP_DENSITY_FACTOR 4
+#define LOOKUP_MIN_SIZE 64
+
 namespace hltypes
 {
+	EnumerationRegistry::EnumerationRegistry() : lookupOffset(0U)
+	{
+	}
+
+	EnumerationRegistry::~EnumerationRegistry()
+	{
+	}
+
+	int EnumerationRegistry::indexOf(unsigned int value) const
+	{
+		if (this->lookup.size() > 0)
+		{
+			unsigned int offset = value - this->lookupOffset;
+			// values below lookupOffset wrap around and are caught here as well
+			return (offset < (unsigned int)this->lookup.size() ? this->lookup[offset] : -1);
+		}
+		int min = 0;
+		int max = this->values.size() - 1;
+		int index = 0;
+		while (min <= max)
+		{
+			index = (min + max) / 2;
+			if (this->values[index] < value)
+			{
+				min = index + 1;
+			}
+			else if (this->values[index] > value)
+			{
+				max = index - 1;
+			}
+			else
+			{
+				return index;
+			}
+		}
+		return -1;
+	}
+
+	int EnumerationRegistry::indexOfName(const String& name) const
+	{
+		// lower bound so the lowest value is found if names are used more than once
+		int min = 0;
+		int max = this->nameIndices.size();
+		int index = 0;
+		while (min < max)
+		{
+			index = (min + max) / 2;
+			if (this->names[this->nameIndices[index]] < name)
+			{
+				min = index + 1;
+			}
+			else
+			{
+				max = index;
+			}
+		}
+		if (min < this->nameIndices.size() && this->names[this->nameIndices[min]] == name)
+		{
+			return this->nameIndices[min];
+		}
+		return -1;
+	}
+
+	const String& EnumerationRegistry::getName(unsigned int value) const
+	{
+		int index = this->indexOf(value);
+		if (index < 0)
+		{
+			throw EnumerationValueNotExistsException(value);
+		}
+		return this->names[index];
+	}
+
+	unsigned int EnumerationRegistry::getNextFreeValue() const
+	{
+		return (this->values.size() > 0 ? this->values.last() + 1 : 0U);
+	}
+
+	void EnumerationRegistry::add(const String& name, unsigned int value)
+	{
+		int index = 0;
+		int count = this->values.size();
+		while (index < count && this->values[index] < value)
+		{
+			++index;
+		}
+		if (index < count && this->values[index] == value)
+		{
+			throw EnumerationValueAlreadyExistsException(value);
+		}
+		this->values.insertAt(index, value);
+		this->names.insertAt(index, name);
+		// shift the indices of all values after the new one
+		for_iter (i, 0, this->nameIndices.size())
+		{
+			if (this->nameIndices[i] >= index)
+			{
+				++this->nameIndices[i];
+			}
+		}
+		// names are sorted by name and then by value so indexOfName() finds the lowest value
+		int nameIndex = 0;
+		int nameCount = this->nameIndices.size();
+		while (nameIndex < nameCount)
+		{
+			const String& other = this->names[this->nameIndices[nameIndex]];
+			if (name < other || (name == other && index < this->nameIndices[nameIndex]))
+			{
+				break;
+			}
+			++nameIndex;
+		}
+		this->nameIndices.insertAt(nameIndex, index);
+		this->_updateLookup();
+	}
+
+	Map<unsigned int, String> EnumerationRegistry::toMap() const
+	{
+		Map<unsigned int, String> result;
+		int count = this->values.size();
+		for_iter (i, 0, count)
+		{
+			result[this->values[i]] = this->names[i];
+		}
+		return result;
+	}
+
+	void EnumerationRegistry::_updateLookup()
+	{
+		this->lookup.clear();
+		this->lookupOffset = 0U;
+		int count = this->values.size();
+		if (count == 0)
+		{
+			return;
+		}
+		unsigned int range = this->values.last() - this->values.first();
+		if (range >= (unsigned int)hmax(count * LOOKUP_DENSITY_FACTOR, LOOKUP_MIN_SIZE))
+		{
+			return;
+		}
+		this->lookupOffset = this->values.first();
+		this->lookup.add(-1, (int)range + 1);
+		for_iter (i, 0, count)
+		{
+			this->lookup[this->values[i] - this->lookupOffset] = i;
+		}
+	}
+
 	Enumeration::Enumeration()
 	{
 		this->value = 0U;
@@ -27,21 +180,16 @@ namespace hltypes
 
 	String Enumeration::getName() const
 	{
-		Map<unsigned int, String>& instances = this->_getInstances();
-		if (!instances.hasKey(value))
-		{
-			throw EnumerationValueNotExistsException(value);
-		}
-		return instances[this->value];
+		return this->_getRegistry().getName(this->value);
 	}
 
 	void Enumeration::_addNewInstance(const String& className, const String& name)
 	{
 		String newName = name;
-		Map<unsigned int, String>& instances = this->_getInstances();
-		if (instances.size() > 0)
+		EnumerationRegistry& registry = this->_getRegistry();
+		if (registry.size() > 0)
 		{
-			this->value = instances.keys().max() + 1;
+			this->value = registry.getNextFreeValue();
 		}
 		if (newName == "")
 		{
@@ -52,12 +200,7 @@ namespace hltypes
 
 	void Enumeration::_addNewInstance(const String& className, const String& name, unsigned int value)
 	{
-		Map<unsigned int, String>& instances = this->_getInstances();
-		if (instances.hasKey(value))
-		{
-			throw EnumerationValueAlreadyExistsException(value);
-		}
-		instances[this->value] = name;
+		this->_getRegistry().add(name, this->value);
 #if defined(_DEBUG) && defined(_DEBUG_PRINT_HENUM)
 		// because of the order of global var initializations, mutexes get messed up
 		printf("[hltypes] Adding enum '%s::%s' under value '%u'.\n", className.cStr(), name.cStr(), this->value);
@@ -126,6 +126,12 @@ namespace hltypes
 		this->_setInternalMessage("'" + filename + "' is not writeable!", sourceFile, lineNumber);
 	}
 	
+	_FileCouldNotWriteException::_FileCouldNotWriteException(const String& filename, int count, const char* sourceFile, int lineNumber) :
+		_Exception("", sourceFile, lineNumber)
+	{
+		this->_setInternalMessage(hsprintf("%d bytes could not be written to '%s'!", count, filename.cStr()), sourceFile, lineNumber);
+	}
+	
 	_ResourceNotExistsException::_ResourceNotExistsException(const String& type, const String& name, const String& container, const char* sourceFile, int lineNumber) :
 		_Exception("", sourceFile, lineNumber)
 	{
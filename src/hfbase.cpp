@@ -6,12 +6,19 @@
 /// This program is free software; you can redistribute it and/or modify it under
 /// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
 
+#include <stdlib.h>
+#include <string.h>
+
 #include "hdir.h"
 #include "hfbase.h"
+#include "hlog.h"
+#include "hspan.h"
 #include "hstring.h"
 #include "hthread.h"
 #include "platform_internal.h"
 
+#define DEFAULT_WRITE_BUFFER_SIZE 65536
+
 namespace hltypes
 {
 	FileInfo::FileInfo() :
@@ -34,6 +41,7 @@ namespace hltypes
 
 	int FileBase::repeats = 0;
 	float FileBase::timeout = 100.0f;
+	int FileBase::defaultWriteBufferSize = DEFAULT_WRITE_BUFFER_SIZE;
 
 	void FileBase::setRepeats(int value)
 	{
@@ -45,16 +53,35 @@ namespace hltypes
 		FileBase::timeout = value;
 	}
 
+	void FileBase::setDefaultWriteBufferSize(int value)
+	{
+		FileBase::defaultWriteBufferSize = hmax(value, 0);
+	}
+
 	FileBase::FileBase(const String& filename) :
 		StreamBase(),
-		cfile(NULL)
+		cfile(NULL),
+		appendMode(false),
+		writeBuffer(NULL),
+		writeBufferSize(FileBase::defaultWriteBufferSize),
+		writeBufferCount(0),
+		writeBufferPosition(0LL),
+		lastWritten(false),
+		lastRead(false)
 	{
 		this->filename = Dir::normalize(filename);
 	}
 	
 	FileBase::FileBase() :
 		StreamBase(),
-		cfile(NULL)
+		cfile(NULL),
+		appendMode(false),
+		writeBuffer(NULL),
+		writeBufferSize(FileBase::defaultWriteBufferSize),
+		writeBufferCount(0),
+		writeBufferPosition(0LL),
+		lastWritten(false),
+		lastRead(false)
 	{
 	}
 	
@@ -63,10 +90,58 @@ namespace hltypes
 		// this measure is not universal for all derived classes!
 		if (this->_fisOpen())
 		{
-			this->_fclose();
+			// exceptions must not leave a destructor
+			try
+			{
+				this->_fclose();
+			}
+			catch (_Exception& e)
+			{
+				Log::error(logTag, "Could not close file: " + e.getMessage());
+			}
+		}
+		if (this->writeBuffer != NULL)
+		{
+			free(this->writeBuffer);
 		}
 	}
 
+	void FileBase::setWriteBufferSize(int value)
+	{
+		value = hmax(value, 0);
+		if (this->writeBufferSize != value)
+		{
+			if (this->_fisOpen())
+			{
+				this->_fflushWriteBuffer();
+			}
+			if (this->writeBuffer != NULL)
+			{
+				free(this->writeBuffer);
+				this->writeBuffer = NULL;
+			}
+			this->writeBufferSize = value;
+		}
+	}
+
+	int64_t FileBase::writeRawVectored(Span<const Span<const unsigned char> > buffers)
+	{
+		this->_validate();
+		this->_fflushWriteBuffer();
+		this->_fprepareWrite();
+		int64_t result = _platformWriteFileVectored(this->cfile, buffers.data(), buffers.size());
+		this->dataSize = hmax(this->dataSize, _platformGetFilePosition(this->cfile));
+		return result;
+	}
+
+	bool FileBase::flush()
+	{
+		this->_validate();
+		this->_fflushWriteBuffer();
+		this->lastWritten = false;
+		return _platformFlushFile(this->cfile);
+	}
+
 	String FileBase::extensionOf(const String& path)
 	{
 		// TODOhl - not UTF8 safe
@@ -99,6 +174,10 @@ namespace hltypes
 	{
 		return this->filename;
 	}
+
+	void FileBase::_updateDataSize()
+	{
+	}
 	
 	void FileBase::_fopen(const String& filename, AccessMode accessMode, int repeats, float timeout)
 	{
@@ -132,6 +211,7 @@ namespace hltypes
 		{
 			mode = "a+b";
 		}
+		this->appendMode = (accessMode == AccessMode::Append || accessMode == AccessMode::ReadAppend);
 		int attempts = repeats + 1;
 		while (true)
 		{
@@ -151,27 +231,117 @@ namespace hltypes
 		{
 			throw FileCouldNotOpenException(this->_descriptor());
 		}
+		this->lastWritten = false;
+		this->lastRead = false;
 	}
 	
 	void FileBase::_fclose()
 	{
 		this->_validate();
+		// the file is closed even if buffered data could not be written, the error is reported afterwards
+		bool written = this->_fwriteBuffer();
+		int count = this->writeBufferCount;
+		this->writeBufferCount = 0;
 		_platformCloseFile(this->cfile);
 		this->cfile = NULL;
 		this->dataSize = 0;
+		if (!written)
+		{
+			throw FileCouldNotWriteException(this->filename, count);
+		}
 	}
 	
 	int FileBase::_fread(void* buffer, int count)
 	{
+		this->_fprepareRead();
 		return _platformReadFile(buffer, 1, count, this->cfile);
 	}
 	
 	int FileBase::_fwrite(const void* buffer, int count)
 	{
-		int result = (int)_platformWriteFile(buffer, 1, count, (FILE*)this->cfile);
-		this->dataSize = hmax(this->dataSize, this->_fposition());
+		if (count <= 0)
+		{
+			return 0;
+		}
+		// small writes are collected so they don't each go through the OS file handle and the position query
+		if (count < this->writeBufferSize)
+		{
+			if (this->writeBuffer == NULL)
+			{
+				this->writeBuffer = (unsigned char*)malloc(this->writeBufferSize);
+			}
+			if (this->writeBuffer != NULL)
+			{
+				if (this->writeBufferCount + count > this->writeBufferSize)
+				{
+					this->_fflushWriteBuffer();
+				}
+				if (this->writeBufferCount == 0)
+				{
+					// in append modes all data is written at the end regardless of the current position
+					this->writeBufferPosition = (this->appendMode ? this->dataSize : _platformGetFilePosition(this->cfile));
+				}
+				memcpy(&this->writeBuffer[this->writeBufferCount], buffer, count);
+				this->writeBufferCount += count;
+				this->dataSize = hmax(this->dataSize, this->writeBufferPosition + this->writeBufferCount);
+				return count;
+			}
+		}
+		this->_fflushWriteBuffer();
+		this->_fprepareWrite();
+		int result = (int)_platformWriteFile(buffer, 1, count, this->cfile);
+		this->dataSize = hmax(this->dataSize, _platformGetFilePosition(this->cfile));
 		return result;
 	}
+
+	void FileBase::_fflushWriteBuffer()
+	{
+		if (!this->_fwriteBuffer())
+		{
+			throw FileCouldNotWriteException(this->_descriptor(), this->writeBufferCount);
+		}
+	}
+
+	bool FileBase::_fwriteBuffer()
+	{
+		if (this->writeBufferCount == 0)
+		{
+			return true;
+		}
+		this->_fprepareWrite();
+		int written = hmax((int)_platformWriteFile(this->writeBuffer, 1, this->writeBufferCount, this->cfile), 0);
+		if (written < this->writeBufferCount)
+		{
+			// the data that was not written stays in the buffer so it is not lost
+			this->writeBufferCount -= written;
+			this->writeBufferPosition += written;
+			memmove(this->writeBuffer, &this->writeBuffer[written], this->writeBufferCount);
+			return false;
+		}
+		this->writeBufferCount = 0;
+		return true;
+	}
+
+	void FileBase::_fprepareRead()
+	{
+		this->_fflushWriteBuffer();
+		if (this->lastWritten)
+		{
+			_platformFlushFile(this->cfile);
+			this->lastWritten = false;
+		}
+		this->lastRead = true;
+	}
+
+	void FileBase::_fprepareWrite()
+	{
+		if (this->lastRead)
+		{
+			_platformSeekFile(this->cfile, this->dataSize, _platformGetFilePosition(this->cfile), 0LL, SeekMode::Current);
+			this->lastRead = false;
+		}
+		this->lastWritten = true;
+	}
 	
 	bool FileBase::_fisOpen() const
 	{
@@ -180,11 +350,19 @@ namespace hltypes
 	
 	int64_t FileBase::_fposition() const
 	{
+		if (this->writeBufferCount > 0)
+		{
+			return (this->writeBufferPosition + this->writeBufferCount);
+		}
 		return _platformGetFilePosition((_platformFile*)this->cfile);
 	}
 	
 	bool FileBase::_fseek(int64_t offset, SeekMode seekMode)
 	{
+		this->_fflushWriteBuffer();
+		// seeking also satisfies the C stdio requirement between reads and writes
+		this->lastWritten = false;
+		this->lastRead = false;
 		return _platformSeekFile((_platformFile*)this->cfile, this->size(), this->_fposition(), offset, seekMode);
 	}
 	
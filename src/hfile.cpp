@@ -29,7 +29,15 @@ namespace hltypes
 	{
 		if (this->_isOpen())
 		{
-			this->close();
+			// exceptions must not leave a destructor
+			try
+			{
+				this->close();
+			}
+			catch (_Exception& e)
+			{
+				Log::error(logTag, "Could not close file: " + e.getMessage());
+			}
 		}
 	}
 	
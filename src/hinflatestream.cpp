@@ -0,0 +1,381 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+
+#ifdef _ZIPRESOURCE
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#define MINIZ_HEADER_FILE_ONLY
+#include <miniz.cpp>
+
+#include "hdeflatestream.h"
+#include "hexception.h"
+#include "hinflatestream.h"
+#include "hstring.h"
+
+#define MIN_INFLATE_BUFFER_SIZE 64
+#define INFLATE_SKIP_BUFFER_SIZE 4096
+// larger than the read-ahead of StreamBase::readLine(), read() with a delimiter and loadVarints()
+#define INFLATE_HISTORY_SIZE 65536
+#define GZIP_HEADER_SIZE 10
+#define GZIP_TRAILER_SIZE 8
+#define GZIP_FLAG_HEADER_CRC 0x02
+#define GZIP_FLAG_EXTRA 0x04
+#define GZIP_FLAG_NAME 0x08
+#define GZIP_FLAG_COMMENT 0x10
+
+namespace hltypes
+{
+	static void _skipZeroTerminated(StreamBase& stream)
+	{
+		unsigned char c = 0;
+		while (stream.readRaw(&c, 1) == 1 && c != 0)
+		{
+		}
+	}
+
+	InflateStream::InflateStream(StreamBase& stream, DeflateStream::Format format, int bufferSize) :
+		StreamBase(),
+		stream(stream),
+		format(format),
+		streamStart(stream.position()),
+		bufferSize(hmax(bufferSize, MIN_INFLATE_BUFFER_SIZE)),
+		buffer(NULL),
+		zStream(NULL),
+		crc(MZ_CRC32_INIT),
+		uncompressedPosition(0LL),
+		finished(false),
+		history(NULL),
+		historyCount(0),
+		decompressedPosition(0LL)
+	{
+		// the real size is only known at the end
+		this->dataSize = INT64_MAX;
+		this->buffer = new unsigned char[this->bufferSize];
+		this->history = new unsigned char[INFLATE_HISTORY_SIZE];
+		try
+		{
+			this->_restart();
+		}
+		catch (...)
+		{
+			this->_close();
+			throw;
+		}
+	}
+
+	InflateStream::~InflateStream()
+	{
+		this->_close();
+	}
+
+	String InflateStream::_descriptor() const
+	{
+		return "inflatestream";
+	}
+
+	void InflateStream::_updateDataSize()
+	{
+	}
+
+	void InflateStream::_restart()
+	{
+		miniz::mz_stream* zStream = (miniz::mz_stream*)this->zStream;
+		if (zStream != NULL)
+		{
+			miniz::mz_inflateEnd(zStream);
+			memset(zStream, 0, sizeof(miniz::mz_stream));
+		}
+		else
+		{
+			zStream = new miniz::mz_stream();
+			this->zStream = zStream;
+		}
+		// zlib framing is done by miniz, gzip framing is done here around raw data
+		int windowBits = (this->format == DeflateStream::Format::Zlib ? MZ_DEFAULT_WINDOW_BITS : -MZ_DEFAULT_WINDOW_BITS);
+		if (miniz::mz_inflateInit2(zStream, windowBits) != miniz::MZ_OK)
+		{
+			throw Exception("Could not initialize decompression!");
+		}
+		this->stream.seek(this->streamStart, SeekMode::Start);
+		this->crc = MZ_CRC32_INIT;
+		this->uncompressedPosition = 0LL;
+		this->finished = false;
+		this->historyCount = 0;
+		this->decompressedPosition = 0LL;
+		if (this->format == DeflateStream::Format::Gzip)
+		{
+			this->_readGzipHeader();
+		}
+	}
+
+	void InflateStream::_close()
+	{
+		if (this->zStream != NULL)
+		{
+			miniz::mz_inflateEnd((miniz::mz_stream*)this->zStream);
+			delete (miniz::mz_stream*)this->zStream;
+			this->zStream = NULL;
+		}
+		if (this->buffer != NULL)
+		{
+			delete[] this->buffer;
+			this->buffer = NULL;
+		}
+		if (this->history != NULL)
+		{
+			delete[] this->history;
+			this->history = NULL;
+		}
+	}
+
+	void InflateStream::_readGzipHeader()
+	{
+		unsigned char header[GZIP_HEADER_SIZE];
+		if (this->stream.readRaw(header, (int64_t)GZIP_HEADER_SIZE) != GZIP_HEADER_SIZE || header[0] != 0x1F || header[1] != 0x8B || header[2] != MZ_DEFLATED)
+		{
+			throw Exception("Invalid gzip header in stream!");
+		}
+		unsigned char flags = header[3];
+		if ((flags & GZIP_FLAG_EXTRA) != 0)
+		{
+			this->stream.seek(this->stream.loadUint16());
+		}
+		if ((flags & GZIP_FLAG_NAME) != 0)
+		{
+			_skipZeroTerminated(this->stream);
+		}
+		if ((flags & GZIP_FLAG_COMMENT) != 0)
+		{
+			_skipZeroTerminated(this->stream);
+		}
+		if ((flags & GZIP_FLAG_HEADER_CRC) != 0)
+		{
+			this->stream.seek(2);
+		}
+	}
+
+	void InflateStream::_finish()
+	{
+		miniz::mz_stream* zStream = (miniz::mz_stream*)this->zStream;
+		// data that was read past the end is given back, miniz can also hold some of it in the bit buffer of its decompressor (first member of its state)
+		int64_t unused = (int64_t)zStream->avail_in + (((miniz::tinfl_decompressor*)zStream->state)->m_num_bits >> 3);
+		if (unused > 0)
+		{
+			this->stream.seek(-unused);
+		}
+		zStream->avail_in = 0;
+		if (this->format == DeflateStream::Format::Gzip)
+		{
+			unsigned char trailer[GZIP_TRAILER_SIZE];
+			if (this->stream.readRaw(trailer, (int64_t)GZIP_TRAILER_SIZE) != GZIP_TRAILER_SIZE)
+			{
+				throw Exception("gzip data in stream is incomplete!");
+			}
+			unsigned int crc = (trailer[0] | (trailer[1] << 8) | (trailer[2] << 16) | ((unsigned int)trailer[3] << 24));
+			unsigned int uncompressedSize = (trailer[4] | (trailer[5] << 8) | (trailer[6] << 16) | ((unsigned int)trailer[7] << 24));
+			if (crc != this->crc || uncompressedSize != (unsigned int)(this->uncompressedPosition & 0xFFFFFFFF))
+			{
+				throw Exception("gzip data in stream is corrupted!");
+			}
+		}
+		this->dataSize = this->decompressedPosition;
+	}
+
+	void InflateStream::_readHistory(unsigned char* buffer, int count)
+	{
+		int offset = (int)(this->uncompressedPosition % INFLATE_HISTORY_SIZE);
+		int size = hmin(count, INFLATE_HISTORY_SIZE - offset);
+		memcpy(buffer, &this->history[offset], size);
+		if (size < count)
+		{
+			memcpy(&buffer[size], this->history, count - size);
+		}
+		this->uncompressedPosition += count;
+	}
+
+	void InflateStream::_writeHistory(const unsigned char* data, int count)
+	{
+		int64_t position = this->decompressedPosition;
+		// only the last part is kept if more data was decompressed at once than fits
+		if (count > INFLATE_HISTORY_SIZE)
+		{
+			position += count - INFLATE_HISTORY_SIZE;
+			data += count - INFLATE_HISTORY_SIZE;
+			count = INFLATE_HISTORY_SIZE;
+		}
+		int offset = (int)(position % INFLATE_HISTORY_SIZE);
+		int size = hmin(count, INFLATE_HISTORY_SIZE - offset);
+		memcpy(&this->history[offset], data, size);
+		if (size < count)
+		{
+			memcpy(this->history, &data[size], count - size);
+		}
+		this->historyCount = (int)hmin((int64_t)this->historyCount + count, (int64_t)INFLATE_HISTORY_SIZE);
+	}
+
+	void InflateStream::_skip(int64_t count)
+	{
+		unsigned char buffer[INFLATE_SKIP_BUFFER_SIZE];
+		int read = 0;
+		while (count > 0)
+		{
+			read = this->_read(buffer, (int)hmin(count, (int64_t)INFLATE_SKIP_BUFFER_SIZE));
+			if (read <= 0)
+			{
+				break;
+			}
+			count -= read;
+		}
+	}
+
+	int InflateStream::_read(void* buffer, int count)
+	{
+		if (count <= 0)
+		{
+			return 0;
+		}
+		int result = 0;
+		// data that was already decompressed before seeking back is served from the history
+		if (this->uncompressedPosition < this->decompressedPosition)
+		{
+			result = (int)hmin((int64_t)count, this->decompressedPosition - this->uncompressedPosition);
+			this->_readHistory((unsigned char*)buffer, result);
+		}
+		if (result < count)
+		{
+			result += this->_inflate((unsigned char*)buffer + result, count - result);
+		}
+		return result;
+	}
+
+	int InflateStream::_inflate(unsigned char* buffer, int count)
+	{
+		if (this->finished)
+		{
+			return 0;
+		}
+		miniz::mz_stream* zStream = (miniz::mz_stream*)this->zStream;
+		zStream->next_out = buffer;
+		zStream->avail_out = count;
+		int result = miniz::MZ_OK;
+		int read = 0;
+		unsigned int availableOut = 0;
+		bool exhausted = false;
+		while (zStream->avail_out > 0)
+		{
+			if (zStream->avail_in == 0 && !exhausted)
+			{
+				read = (int)this->stream.readRaw(this->buffer, (int64_t)this->bufferSize);
+				if (read > 0)
+				{
+					zStream->next_in = this->buffer;
+					zStream->avail_in = read;
+				}
+				else
+				{
+					// miniz may still have buffered output or only be missing the final step
+					exhausted = true;
+				}
+			}
+			availableOut = zStream->avail_out;
+			result = miniz::mz_inflate(zStream, miniz::MZ_NO_FLUSH);
+			if (result == miniz::MZ_STREAM_END)
+			{
+				this->finished = true;
+				break;
+			}
+			if (result < 0 && result != miniz::MZ_BUF_ERROR)
+			{
+				throw Exception(hsprintf("Could not decompress data: %s", miniz::mz_error(result)));
+			}
+			if (exhausted && zStream->avail_in == 0 && zStream->avail_out == availableOut)
+			{
+				throw Exception("Compressed data in stream is incomplete!");
+			}
+		}
+		int produced = count - (int)zStream->avail_out;
+		if (this->format == DeflateStream::Format::Gzip && produced > 0)
+		{
+			this->crc = (unsigned int)miniz::mz_crc32(this->crc, buffer, produced);
+		}
+		this->_writeHistory(buffer, produced);
+		this->decompressedPosition += produced;
+		this->uncompressedPosition += produced;
+		if (this->finished)
+		{
+			this->_finish();
+		}
+		return produced;
+	}
+
+	int InflateStream::_write(const void* buffer, int count)
+	{
+		throw FileNotWriteableException(this->_descriptor());
+		return 0;
+	}
+
+	bool InflateStream::_isOpen() const
+	{
+		return (this->zStream != NULL);
+	}
+
+	int64_t InflateStream::_position() const
+	{
+		return this->uncompressedPosition;
+	}
+
+	bool InflateStream::_seek(int64_t offset, SeekMode seekMode)
+	{
+		int64_t target = 0LL;
+		if (seekMode == SeekMode::Current)
+		{
+			target = this->uncompressedPosition + offset;
+		}
+		else if (seekMode == SeekMode::Start)
+		{
+			target = offset;
+		}
+		else if (seekMode == SeekMode::End)
+		{
+			// the size is only known after everything has been decompressed
+			this->_skip(INT64_MAX);
+			target = this->dataSize + offset;
+		}
+		target = hmax(target, (int64_t)0);
+		// only seeking back further than the history requires decompressing everything again
+		if (target < this->decompressedPosition - this->historyCount)
+		{
+			this->_restart();
+		}
+		if (target <= this->decompressedPosition)
+		{
+			this->uncompressedPosition = target;
+		}
+		else
+		{
+			this->uncompressedPosition = this->decompressedPosition;
+			this->_skip(target - this->decompressedPosition);
+		}
+		return true;
+	}
+
+	InflateStream::InflateStream(const InflateStream& other) :
+		stream(other.stream)
+	{
+		throw ObjectCannotCopyException("hltypes::InflateStream");
+	}
+
+	InflateStream& InflateStream::operator=(InflateStream& other)
+	{
+		throw ObjectCannotAssignException("hltypes::InflateStream");
+		return (*this);
+	}
+
+}
+#endif
@@ -0,0 +1,149 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "hexception.h"
+#include "hlinereader.h"
+#include "hsbase.h"
+#include "hspan.h"
+#include "hstring.h"
+
+#define MIN_LINE_READER_BUFFER_SIZE 16
+
+namespace hltypes
+{
+	LineReader::LineReader(StreamBase& stream, int bufferSize) : stream(stream), buffer(NULL), capacity(0), start(0), end(0), scanned(0), lineCount(0)
+	{
+		this->capacity = hmax(bufferSize, MIN_LINE_READER_BUFFER_SIZE);
+		// using malloc because realloc is used later
+		this->buffer = (char*)malloc(this->capacity);
+		if (this->buffer == NULL)
+		{
+			throw Exception(hsprintf("Could not allocate %d bytes of memory for LineReader!", this->capacity));
+		}
+	}
+
+	LineReader::~LineReader()
+	{
+		free(this->buffer);
+	}
+
+	bool LineReader::readLine(Span<const char>& line)
+	{
+		char* found = NULL;
+		while (true)
+		{
+			// only the characters that were added since the last call are scanned
+			found = (char*)memchr(this->buffer + this->scanned, '\n', this->end - this->scanned);
+			if (found != NULL)
+			{
+				int lineEnd = (int)(found - this->buffer);
+				this->scanned = lineEnd + 1;
+				break;
+			}
+			this->scanned = this->end;
+			if (!this->_fill())
+			{
+				if (this->start >= this->end)
+				{
+					line = Span<const char>();
+					return false;
+				}
+				// the last line has no line ending
+				break;
+			}
+		}
+		int lineStart = this->start;
+		int lineEnd = (found != NULL ? (int)(found - this->buffer) : this->end);
+		if (lineEnd > lineStart && this->buffer[lineEnd - 1] == '\r')
+		{
+			--lineEnd;
+		}
+		line = Span<const char>(this->buffer + lineStart, lineEnd - lineStart);
+		this->start = this->scanned;
+		++this->lineCount;
+		return true;
+	}
+
+	bool LineReader::readLine(String& line)
+	{
+		Span<const char> data;
+		if (!this->readLine(data))
+		{
+			line = "";
+			return false;
+		}
+		line.set(data.data(), data.size());
+		return true;
+	}
+
+	String LineReader::readLine()
+	{
+		String result;
+		this->readLine(result);
+		return result;
+	}
+
+	bool LineReader::eof()
+	{
+		return (this->start >= this->end && !this->_fill());
+	}
+
+	int64_t LineReader::position() const
+	{
+		return (this->stream.position() - (this->end - this->start));
+	}
+
+	bool LineReader::_fill()
+	{
+		if (this->start > 0)
+		{
+			int remaining = this->end - this->start;
+			if (remaining > 0)
+			{
+				memmove(this->buffer, this->buffer + this->start, remaining);
+			}
+			this->scanned -= this->start;
+			this->end = remaining;
+			this->start = 0;
+		}
+		if (this->end >= this->capacity)
+		{
+			// the current line does not fit into the buffer
+			int newCapacity = this->capacity * 2;
+			char* newBuffer = (char*)realloc(this->buffer, newCapacity);
+			if (newBuffer == NULL)
+			{
+				throw Exception(hsprintf("Could not allocate %d bytes of memory for LineReader!", newCapacity));
+			}
+			this->buffer = newBuffer;
+			this->capacity = newCapacity;
+		}
+		int read = (int)this->stream.readRaw(this->buffer + this->end, (int64_t)(this->capacity - this->end));
+		if (read <= 0)
+		{
+			return false;
+		}
+		this->end += read;
+		return true;
+	}
+
+	LineReader::LineReader(const LineReader& other) : stream(other.stream)
+	{
+		throw ObjectCannotCopyException("hltypes::LineReader");
+	}
+
+	LineReader& LineReader::operator=(LineReader& other)
+	{
+		throw ObjectCannotAssignException("hltypes::LineReader");
+		return (*this);
+	}
+
+}
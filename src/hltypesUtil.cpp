@@ -601,8 +601,59 @@ int64_t hpotFloor(int64_t value)
 	return result;
 }
 
+void hswapBytes(void* data, int64_t count, int elementSize)
+{
+	unsigned char* bytes = (unsigned char*)data;
+	// memcpy keeps unaligned data safe and is optimized away
+	if (elementSize == 2)
+	{
+		uint16_t value = 0;
+		for_itert (int64_t, i, 0, count)
+		{
+			memcpy(&value, bytes + i * 2, 2);
+			value = (uint16_t)((value >> 8) | (value << 8));
+			memcpy(bytes + i * 2, &value, 2);
+		}
+	}
+	else if (elementSize == 4)
+	{
+		uint32_t value = 0;
+		for_itert (int64_t, i, 0, count)
+		{
+			memcpy(&value, bytes + i * 4, 4);
+			value = ((value >> 24) | ((value >> 8) & 0xFF00) | ((value << 8) & 0xFF0000) | (value << 24));
+			memcpy(bytes + i * 4, &value, 4);
+		}
+	}
+	else if (elementSize == 8)
+	{
+		uint64_t value = 0ULL;
+		for_itert (int64_t, i, 0, count)
+		{
+			memcpy(&value, bytes + i * 8, 8);
+			value = ((value >> 56) | ((value >> 40) & 0xFF00ULL) | ((value >> 24) & 0xFF0000ULL) | ((value >> 8) & 0xFF000000ULL) |
+				((value << 8) & 0xFF00000000ULL) | ((value << 24) & 0xFF0000000000ULL) | ((value << 40) & 0xFF000000000000ULL) | (value << 56));
+			memcpy(bytes + i * 8, &value, 8);
+		}
+	}
+	else if (elementSize > 1)
+	{
+		unsigned char* element = NULL;
+		for_itert (int64_t, i, 0, count)
+		{
+			element = bytes + i * elementSize;
+			for_iter (j, 0, elementSize / 2)
+			{
+				hswap(element[j], element[elementSize - 1 - j]);
+			}
+		}
+	}
+}
+
 // CRC32 stuff
 
+#define CRC32_BUFFER_SIZE 1048576
+
 static unsigned int crc32Table[256] = {0};
 static bool crc32TableCreated = false;
 void createCrc32Table()
@@ -632,49 +683,67 @@ void createCrc32Table()
 	crc32TableCreated = true;
 }
 
-unsigned int hcrc32(const unsigned char* data, unsigned int size)
+static unsigned int _updateCrc32(unsigned int crc, const unsigned char* data, int64_t size)
 {
-	createCrc32Table();
-	unsigned int crc = 0xFFFFFFFF;
-	for_itert (unsigned int, i, 0, size)
+	for_itert (int64_t, i, 0, size)
 	{
 		crc = ((crc >> 8) & 0xFFFFFF) ^ crc32Table[(crc ^ data[i]) & 0xFF];
 	}
+	return crc;
+}
+
+unsigned int hcrc32(const unsigned char* data, int64_t size)
+{
+	createCrc32Table();
+	unsigned int crc = _updateCrc32(0xFFFFFFFF, data, size);
 	return ((crc & 0xFFFFFFFF) ^ 0xFFFFFFFF);
 }
 
-unsigned int hcrc32(hltypes::StreamBase* stream, unsigned int size)
+unsigned int hcrc32(hltypes::StreamBase* stream, int64_t size)
 {
-	size = hmin(size, (unsigned int)(stream->size() - stream->position()));
+	size = hmin(size, stream->size() - stream->position());
 	if (size <= 0)
 	{
 		return 0;
 	}
-	unsigned char* data = new unsigned char[size];
-	int read = stream->readRaw(data, size);
-	if (read == 0)
+	createCrc32Table();
+	// reading in chunks so large streams don't have to be loaded into memory at once
+	int64_t bufferSize = hmin(size, (int64_t)CRC32_BUFFER_SIZE);
+	unsigned char* data = new unsigned char[(size_t)bufferSize];
+	unsigned int crc = 0xFFFFFFFF;
+	int64_t total = 0;
+	int64_t read = 0;
+	while (total < size)
 	{
-		delete[] data;
-		return 0;
+		read = stream->readRaw(data, hmin(size - total, bufferSize));
+		if (read <= 0)
+		{
+			break;
+		}
+		crc = _updateCrc32(crc, data, read);
+		total += read;
 	}
-	stream->seek(-read);
-	unsigned int result = hcrc32(data, size);
 	delete[] data;
-	return result;
+	if (total == 0)
+	{
+		return 0;
+	}
+	stream->seek(-total);
+	return ((crc & 0xFFFFFFFF) ^ 0xFFFFFFFF);
 }
 
 unsigned int hcrc32(hltypes::StreamBase* stream)
 {
-	return hcrc32(stream, (unsigned int)(stream->size() - stream->position()));
+	return hcrc32(stream, stream->size() - stream->position());
 }
 
-unsigned int hcrc32(hltypes::Stream* stream, unsigned int size)
+unsigned int hcrc32(hltypes::Stream* stream, int64_t size)
 {
-	return hcrc32(&stream->operator[]((int)stream->position()), hmin(size, (unsigned int)(stream->size() - stream->position())));
+	return hcrc32(&stream->operator[](stream->position()), hmin(size, stream->size() - stream->position()));
 }
 
 unsigned int hcrc32(hltypes::Stream* stream)
 {
-	return hcrc32(&stream->operator[]((int)stream->position()), (unsigned int)(stream->size() - stream->position()));
+	return hcrc32(&stream->operator[](stream->position()), stream->size() - stream->position());
 }
 
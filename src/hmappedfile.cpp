@@ -0,0 +1,315 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
+
+#define __HL_INCLUDE_PLATFORM_HEADERS
+#include "hdir.h"
+#include "hexception.h"
+#include "hlog.h"
+#include "hmappedfile.h"
+#include "hplatform.h"
+#include "hspan.h"
+#include "hstring.h"
+
+namespace hltypes
+{
+	HL_ENUM_CLASS_DEFINE(MappedFile::AccessPattern,
+	(
+		HL_ENUM_DEFINE(MappedFile::AccessPattern, Normal);
+		HL_ENUM_DEFINE(MappedFile::AccessPattern, Sequential);
+		HL_ENUM_DEFINE(MappedFile::AccessPattern, Random);
+		HL_ENUM_DEFINE(MappedFile::AccessPattern, WillNeed);
+	));
+
+	MappedFile::MappedFile() :
+		StreamBase(),
+		writable(false),
+		mapped(false),
+		data(NULL),
+		dataPosition(0LL)
+	{
+	}
+
+	MappedFile::~MappedFile()
+	{
+		if (this->mapped)
+		{
+			this->close();
+		}
+	}
+
+	void MappedFile::open(const String& filename, bool writable)
+	{
+		if (this->mapped)
+		{
+			this->close();
+		}
+		this->filename = Dir::normalize(filename);
+		int64_t size = 0LL;
+		unsigned char* data = NULL;
+#ifdef _WIN32
+		DWORD access = (writable ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ);
+#ifndef _UWP
+		HANDLE file = CreateFileW(this->filename.wStr().c_str(), access, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+#else
+		HANDLE file = CreateFile2(this->filename.wStr().c_str(), access, FILE_SHARE_READ, OPEN_EXISTING, NULL);
+#endif
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			throw FileCouldNotOpenException(this->filename);
+		}
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file, &fileSize))
+		{
+			CloseHandle(file);
+			throw FileCouldNotOpenException(this->filename);
+		}
+		size = (int64_t)fileSize.QuadPart;
+		// empty files cannot be mapped
+		if (size > 0)
+		{
+#ifndef _UWP
+			HANDLE mapping = CreateFileMappingW(file, NULL, (writable ? PAGE_READWRITE : PAGE_READONLY), 0, 0, NULL);
+#else
+			HANDLE mapping = CreateFileMappingFromApp(file, NULL, (writable ? PAGE_READWRITE : PAGE_READONLY), 0, NULL);
+#endif
+			if (mapping != NULL)
+			{
+#ifndef _UWP
+				data = (unsigned char*)MapViewOfFile(mapping, (writable ? FILE_MAP_WRITE : FILE_MAP_READ), 0, 0, 0);
+#else
+				data = (unsigned char*)MapViewOfFileFromApp(mapping, (writable ? FILE_MAP_WRITE : FILE_MAP_READ), 0, 0);
+#endif
+				// the view keeps the mapping alive
+				CloseHandle(mapping);
+			}
+		}
+		CloseHandle(file);
+#else
+		int file = ::open(this->filename.cStr(), (writable ? O_RDWR : O_RDONLY));
+		if (file < 0)
+		{
+			throw FileCouldNotOpenException(this->filename);
+		}
+		struct stat info;
+		if (fstat(file, &info) != 0)
+		{
+			::close(file);
+			throw FileCouldNotOpenException(this->filename);
+		}
+		size = (int64_t)info.st_size;
+		// the whole file has to fit into the address space which matters on 32-bit platforms
+		if ((uint64_t)size > (uint64_t)SIZE_MAX)
+		{
+			::close(file);
+			throw FileCouldNotOpenException(this->filename);
+		}
+		// empty files cannot be mapped
+		if (size > 0)
+		{
+			void* address = mmap(NULL, (size_t)size, (writable ? (PROT_READ | PROT_WRITE) : PROT_READ), MAP_SHARED, file, 0);
+			if (address != MAP_FAILED)
+			{
+				data = (unsigned char*)address;
+			}
+		}
+		// the mapping stays valid after the file descriptor is closed
+		::close(file);
+#endif
+		if (size > 0 && data == NULL)
+		{
+			throw FileCouldNotOpenException(this->filename);
+		}
+		this->writable = writable;
+		this->mapped = true;
+		this->data = data;
+		this->dataSize = size;
+		this->dataPosition = 0LL;
+	}
+
+	void MappedFile::close()
+	{
+		this->_validate();
+		if (this->data != NULL)
+		{
+#ifdef _WIN32
+			UnmapViewOfFile(this->data);
+#else
+			munmap(this->data, (size_t)this->dataSize);
+#endif
+		}
+		this->writable = false;
+		this->mapped = false;
+		this->data = NULL;
+		this->dataSize = 0LL;
+		this->dataPosition = 0LL;
+	}
+
+	bool MappedFile::advise(AccessPattern accessPattern)
+	{
+		this->_validate();
+		if (this->data == NULL)
+		{
+			return true;
+		}
+#ifndef _WIN32
+		int advice = MADV_NORMAL;
+		if (accessPattern == AccessPattern::Sequential)
+		{
+			advice = MADV_SEQUENTIAL;
+		}
+		else if (accessPattern == AccessPattern::Random)
+		{
+			advice = MADV_RANDOM;
+		}
+		else if (accessPattern == AccessPattern::WillNeed)
+		{
+			advice = MADV_WILLNEED;
+		}
+		return (madvise(this->data, (size_t)this->dataSize, advice) == 0);
+#else
+		// Windows has no per-mapping access hints, its own read-ahead heuristics are used
+		return true;
+#endif
+	}
+
+	bool MappedFile::flush()
+	{
+		this->_validate();
+		if (this->data == NULL || !this->writable)
+		{
+			return true;
+		}
+#ifdef _WIN32
+		return (FlushViewOfFile(this->data, 0) != FALSE);
+#else
+		return (msync(this->data, (size_t)this->dataSize, MS_SYNC) == 0);
+#endif
+	}
+
+	Span<const unsigned char> MappedFile::span() const
+	{
+		this->_validate();
+		if (this->dataSize > INT_MAX)
+		{
+			throw Exception("MappedFile is too large to be converted to a Span!");
+		}
+		return Span<const unsigned char>(this->data, (int)this->dataSize);
+	}
+
+	Span<unsigned char> MappedFile::writableSpan()
+	{
+		this->_validate();
+		if (!this->writable)
+		{
+			throw FileNotWriteableException(this->filename);
+		}
+		if (this->dataSize > INT_MAX)
+		{
+			throw Exception("MappedFile is too large to be converted to a Span!");
+		}
+		return Span<unsigned char>(this->data, (int)this->dataSize);
+	}
+
+	Span<const unsigned char> MappedFile::readView(int count)
+	{
+		this->_validate();
+		int readSize = (int)hclamp((int64_t)count, (int64_t)0, this->dataSize - this->dataPosition);
+		Span<const unsigned char> result(this->data + this->dataPosition, readSize);
+		this->dataPosition += readSize;
+		return result;
+	}
+
+	MappedFile::operator Span<const unsigned char>() const
+	{
+		return this->span();
+	}
+
+	String MappedFile::_descriptor() const
+	{
+		return this->filename;
+	}
+
+	void MappedFile::_updateDataSize()
+	{
+	}
+
+	int MappedFile::_read(void* buffer, int count)
+	{
+		int readSize = (int)hclamp((int64_t)count, (int64_t)0, this->dataSize - this->dataPosition);
+		if (readSize > 0)
+		{
+			memcpy(buffer, &this->data[this->dataPosition], readSize);
+			this->dataPosition += readSize;
+		}
+		return readSize;
+	}
+
+	int MappedFile::_write(const void* buffer, int count)
+	{
+		if (!this->writable)
+		{
+			throw FileNotWriteableException(this->filename);
+		}
+		int writeSize = (int)hclamp((int64_t)count, (int64_t)0, this->dataSize - this->dataPosition);
+		if (writeSize > 0)
+		{
+			memcpy(&this->data[this->dataPosition], buffer, writeSize);
+			this->dataPosition += writeSize;
+		}
+		return writeSize;
+	}
+
+	bool MappedFile::_isOpen() const
+	{
+		return this->mapped;
+	}
+
+	int64_t MappedFile::_position() const
+	{
+		return this->dataPosition;
+	}
+
+	bool MappedFile::_seek(int64_t offset, SeekMode seekMode)
+	{
+		if (seekMode == SeekMode::Current)
+		{
+			this->dataPosition = hclamp(this->dataPosition + offset, (int64_t)0, this->dataSize);
+		}
+		else if (seekMode == SeekMode::Start)
+		{
+			this->dataPosition = hclamp(offset, (int64_t)0, this->dataSize);
+		}
+		else if (seekMode == SeekMode::End)
+		{
+			this->dataPosition = hclamp(this->dataSize + offset, (int64_t)0, this->dataSize);
+		}
+		return true;
+	}
+
+	MappedFile::MappedFile(const MappedFile& other)
+	{
+		throw ObjectCannotCopyException("hltypes::MappedFile");
+	}
+
+	MappedFile& MappedFile::operator=(MappedFile& other)
+	{
+		throw ObjectCannotAssignException("hltypes::MappedFile");
+		return (*this);
+	}
+
+}
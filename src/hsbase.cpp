@@ -6,21 +6,70 @@
 /// This program is free software; you can redistribute it and/or modify it under
 /// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
 
+#include <limits.h>
 #include <string.h>
 #include <stdarg.h>
 
 #include "harray.h"
+#include "hbitarray.h"
 #include "hexception.h"
 #include "hfbase.h"
 #include "hlog.h"
 #include "hsbase.h"
+#include "hspan.h"
 #include "hstream.h"
 #include "hstring.h"
 
 #define BUFFER_SIZE 4096
+// _read() and _write() work with int so larger data is processed in chunks
+#define RAW_CHUNK_SIZE ((int64_t)0x40000000)
+#define RAW_COPY_BUFFER_SIZE ((int64_t)1048576)
+#define BYTE_SWAP_BUFFER_SIZE 4096
+#define MAX_VARINT_SIZE 10
+#define VARINT_BUFFER_SIZE 4096
 
 namespace hltypes
 {
+	static inline uint64_t _zigzagEncode(int64_t value)
+	{
+		return (((uint64_t)value << 1) ^ (uint64_t)(value >> 63));
+	}
+
+	static inline int64_t _zigzagDecode(uint64_t value)
+	{
+		return ((int64_t)(value >> 1) ^ -(int64_t)(value & 1));
+	}
+
+	static inline int _encodeVarint(uint64_t value, unsigned char* data)
+	{
+		int size = 0;
+		while (value >= 0x80)
+		{
+			data[size] = (unsigned char)(value | 0x80);
+			value >>= 7;
+			++size;
+		}
+		data[size] = (unsigned char)value;
+		return (size + 1);
+	}
+
+	// returns the number of used bytes, 0 if the data ends before the varint does and -1 if the varint is invalid
+	static inline int _decodeVarint(const unsigned char* data, int size, uint64_t& value)
+	{
+		value = 0ULL;
+		int count = hmin(size, MAX_VARINT_SIZE);
+		for_iter (i, 0, count)
+		{
+			value |= (uint64_t)(data[i] & 0x7F) << (i * 7);
+			if ((data[i] & 0x80) == 0)
+			{
+				// the last possible byte can only hold the highest bit
+				return ((i < MAX_VARINT_SIZE - 1 || data[i] <= 1) ? i + 1 : -1);
+			}
+		}
+		return (size >= MAX_VARINT_SIZE ? -1 : 0);
+	}
+
 	HL_ENUM_CLASS_DEFINE(StreamBase::SeekMode,
 	(
 		HL_ENUM_DEFINE(StreamBase::SeekMode, Current);
@@ -79,6 +128,7 @@ namespace hltypes
 		Array<String> parts;
 		int read;
 		int index;
+		int searchStart = 0;
 		char c[BUFFER_SIZE + 1];
 		while (!this->eof())
 		{
@@ -91,13 +141,15 @@ namespace hltypes
 			result += c;
 			if (delimiter != "")
 			{
-				index = (int)result.indexOf(delimiter);
+				// only the new data is searched, the delimiter could begin at the end of the previous chunk though
+				index = (int)result.indexOf(delimiter, searchStart);
 				if (index >= 0)
 				{
 					this->_seek(index - result.size() + delimiter.size(), SeekMode::Current);
 					result = result(0, index);
 					break;
 				}
+				searchStart = hmax(result.size() - delimiter.size() + 1, 0);
 			}
 		}
 		result.replace("\r", "");
@@ -174,65 +226,135 @@ namespace hltypes
 		this->write(result);
 	}
 
-	int StreamBase::readRaw(void* buffer, int count)
+	int64_t StreamBase::readRaw(void* buffer, int64_t count)
 	{
 		this->_validate();
-		return this->_read(buffer, count);
+		int64_t result = 0;
+		int current = 0;
+		int read = 0;
+		while (count > 0)
+		{
+			current = (int)hmin(count, RAW_CHUNK_SIZE);
+			read = this->_read((unsigned char*)buffer + result, current);
+			if (read <= 0)
+			{
+				break;
+			}
+			result += read;
+			count -= read;
+			if (read < current)
+			{
+				break;
+			}
+		}
+		return result;
 	}
 	
-	int StreamBase::writeRaw(void* buffer, int count)
+	int StreamBase::readRaw(Span<unsigned char> buffer)
+	{
+		return (int)this->readRaw(buffer.data(), (int64_t)buffer.size());
+	}
+
+	int64_t StreamBase::writeRaw(void* buffer, int64_t count)
 	{
 		this->_validate();
-		int result = this->_write(buffer, count);
+		int64_t result = 0;
+		int current = 0;
+		int written = 0;
+		while (count > 0)
+		{
+			current = (int)hmin(count, RAW_CHUNK_SIZE);
+			written = this->_write((unsigned char*)buffer + result, current);
+			if (written <= 0)
+			{
+				break;
+			}
+			result += written;
+			count -= written;
+			if (written < current)
+			{
+				break;
+			}
+		}
 		this->_updateDataSize();
 		return result;
 	}
 		
-	int StreamBase::writeRaw(StreamBase& stream, int count)
+	int64_t StreamBase::writeRaw(StreamBase& stream, int64_t count)
 	{
 		this->_validate();
-		count = (int)hmin((int64_t)count, stream.size() - stream.position());
-		unsigned char* buffer = new unsigned char[count];
-		stream.readRaw(buffer, count);
-		stream.seek(-count);
-		int result = this->_write(buffer, count);
+		count = hmin(count, stream.size() - stream.position());
+		if (count <= 0)
+		{
+			return 0;
+		}
+		// copying through a limited buffer so large data doesn't have to be in memory twice
+		unsigned char* buffer = new unsigned char[(size_t)hmin(count, RAW_COPY_BUFFER_SIZE)];
+		int64_t result = 0;
+		int64_t read = 0;
+		int64_t written = 0;
+		while (result < count)
+		{
+			read = stream.readRaw(buffer, hmin(count - result, RAW_COPY_BUFFER_SIZE));
+			if (read <= 0)
+			{
+				break;
+			}
+			written = this->writeRaw(buffer, read);
+			result += written;
+			if (written < read)
+			{
+				stream.seek(written - read);
+				break;
+			}
+		}
 		delete[] buffer;
-		this->_updateDataSize();
+		stream.seek(-result);
 		return result;
 	}
 
-	int StreamBase::writeRaw(StreamBase& stream)
+	int64_t StreamBase::writeRaw(StreamBase& stream)
+	{
+		return this->writeRaw(stream, stream.size() - stream.position());
+	}
+
+	int64_t StreamBase::writeRaw(Stream& stream, int64_t count)
 	{
 		this->_validate();
-		int size = (int)(stream.size() - stream.position());
-		if (size > INT_MAX)
+		int64_t position = stream.position();
+		count = hmin(count, stream.size() - position);
+		if (count <= 0)
 		{
-			Log::errorf(logTag, "Data too large for writing in %s: %d bytes", stream._descriptor().cStr(), size);
 			return 0;
 		}
-		return this->writeRaw(stream, (int)(stream.size() - stream.position()));
+		return this->writeRaw((void*)&stream[position], count);
 	}
 
-	int StreamBase::writeRaw(Stream& stream, int count)
+	int64_t StreamBase::writeRaw(Stream& stream)
 	{
-		this->_validate();
-		int64_t position = stream.position();
-		count = (int)hmin((int64_t)count, stream.size() - position);
-		int result = this->_write(&stream[(int)position], count);
-		this->_updateDataSize();
-		return result;
+		return this->writeRaw(stream, stream.size() - stream.position());
+	}
+
+	int StreamBase::writeRaw(Span<const unsigned char> buffer)
+	{
+		return (int)this->writeRaw((void*)buffer.data(), (int64_t)buffer.size());
 	}
 
-	int StreamBase::writeRaw(Stream& stream)
+	int64_t StreamBase::writeRawVectored(Span<const Span<const unsigned char> > buffers)
 	{
 		this->_validate();
-		int size = (int)(stream.size() - stream.position());
-		if (size > INT_MAX)
+		int64_t result = 0;
+		int written = 0;
+		for_iter (i, 0, buffers.size())
 		{
-			Log::errorf(logTag, "Data too large for writing in %s: %d bytes", stream._descriptor().cStr(), size);
-			return 0;
+			written = this->writeRaw(buffers[i]);
+			result += written;
+			if (written < buffers[i].size())
+			{
+				break;
+			}
 		}
-		return this->writeRaw(stream, (int)(stream.size() - stream.position()));
+		return result;
 	}
 
 	void StreamBase::_updateDataSize()
@@ -377,6 +499,25 @@ namespace hltypes
 		this->dump(String(c));
 	}
 
+	void StreamBase::dump(const BitArray& bitArray)
+	{
+		this->_validate();
+		this->dump(bitArray.size());
+		int count = bitArray.wordCount();
+		if (count > 0)
+		{
+#ifndef __BIG_ENDIAN__
+			this->_write(bitArray.data(), count * 8);
+			this->_updateDataSize();
+#else
+			for_iter (i, 0, count)
+			{
+				this->dump(bitArray.words[i]);
+			}
+#endif
+		}
+	}
+
 	char StreamBase::loadInt8()
 	{
 		return (char)this->loadUint8();
@@ -500,6 +641,279 @@ namespace hltypes
 		return this->read(this->loadInt32());
 	}
 
+	BitArray StreamBase::loadBitArray()
+	{
+		this->_validate();
+		int size = this->loadInt32();
+		if (size < 0)
+		{
+			throw ContainerIndexException(size);
+		}
+		// a corrupted size must not cause a huge allocation
+		if (((int64_t)size + 63) / 64 * 8 > this->size() - this->position())
+		{
+			throw Exception(hsprintf("BitArray size %d in stream is invalid!", size));
+		}
+		BitArray result(size);
+		int count = result.wordCount();
+		if (count > 0)
+		{
+#ifndef __BIG_ENDIAN__
+			this->_read(&result.words[0], count * 8);
+#else
+			for_iter (i, 0, count)
+			{
+				result.words[i] = this->loadUint64();
+			}
+#endif
+			result._clearUnusedBits();
+		}
+		return result;
+	}
+
+	int StreamBase::_dumpRaw(const void* data, int count, int elementSize)
+	{
+		this->_validate();
+		if (count <= 0)
+		{
+			return 0;
+		}
+#ifndef __BIG_ENDIAN__
+		return (int)(this->writeRaw((void*)data, (int64_t)count * elementSize) / elementSize);
+#else
+		if (elementSize == 1)
+		{
+			return (int)this->writeRaw((void*)data, (int64_t)count);
+		}
+		// the caller's data must not change so the bytes are swapped in a copy
+		unsigned char buffer[BYTE_SWAP_BUFFER_SIZE];
+		int chunkCount = hmax(BYTE_SWAP_BUFFER_SIZE / elementSize, 1);
+		int result = 0;
+		int current = 0;
+		int64_t written = 0;
+		while (result < count)
+		{
+			current = hmin(count - result, chunkCount);
+			memcpy(buffer, (const unsigned char*)data + (int64_t)result * elementSize, current * elementSize);
+			hswapBytes(buffer, current, elementSize);
+			written = this->writeRaw(buffer, (int64_t)current * elementSize);
+			result += (int)(written / elementSize);
+			if (written < (int64_t)current * elementSize)
+			{
+				break;
+			}
+		}
+		return result;
+#endif
+	}
+
+	int StreamBase::_loadRaw(void* data, int count, int elementSize)
+	{
+		this->_validate();
+		if (count <= 0)
+		{
+			return 0;
+		}
+		int result = (int)(this->readRaw(data, (int64_t)count * elementSize) / elementSize);
+#ifdef __BIG_ENDIAN__
+		hswapBytes(data, result, elementSize);
+#endif
+		return result;
+	}
+
+	void StreamBase::dumpVarint(uint64_t value)
+	{
+		this->_validate();
+		unsigned char bytes[MAX_VARINT_SIZE];
+		this->_write(bytes, _encodeVarint(value, bytes));
+		this->_updateDataSize();
+	}
+
+	void StreamBase::dumpZigzag(int64_t value)
+	{
+		this->dumpVarint(_zigzagEncode(value));
+	}
+
+	void StreamBase::dumpVarints(Span<const uint64_t> values)
+	{
+		this->_dumpVarints(values.data(), values.size(), false);
+	}
+
+	void StreamBase::dumpZigzags(Span<const int64_t> values)
+	{
+		this->_dumpVarints((const uint64_t*)values.data(), values.size(), true);
+	}
+
+	void StreamBase::dumpBlob(Span<const unsigned char> data)
+	{
+		this->dumpVarint((uint64_t)data.size());
+		if (data.size() > 0)
+		{
+			this->writeRaw(data);
+		}
+	}
+
+	void StreamBase::dumpVarintString(const String& string)
+	{
+		this->dumpBlob(Span<const unsigned char>((const unsigned char*)string.cStr(), string.size()));
+	}
+
+	uint64_t StreamBase::loadVarint()
+	{
+		this->_validate();
+		unsigned char bytes[MAX_VARINT_SIZE];
+		uint64_t value = 0ULL;
+		for_iter (i, 0, MAX_VARINT_SIZE)
+		{
+			if (this->_read(&bytes[i], 1) != 1)
+			{
+				throw Exception("Varint data in stream is incomplete");
+			}
+			if ((bytes[i] & 0x80) == 0)
+			{
+				if (_decodeVarint(bytes, i + 1, value) < 0)
+				{
+					break;
+				}
+				return value;
+			}
+		}
+		throw Exception("Invalid varint in stream");
+	}
+
+	int64_t StreamBase::loadZigzag()
+	{
+		return _zigzagDecode(this->loadVarint());
+	}
+
+	int StreamBase::loadVarints(Span<uint64_t> values)
+	{
+		this->_validate();
+		unsigned char buffer[VARINT_BUFFER_SIZE];
+		int count = values.size();
+		int result = 0;
+		int offset = 0;
+		int available = 0;
+		int requested = 0;
+		int read = 0;
+		int used = 0;
+		bool finished = false;
+		while (result < count)
+		{
+			if (available - offset < MAX_VARINT_SIZE && !finished)
+			{
+				available -= offset;
+				if (available > 0)
+				{
+					memmove(buffer, buffer + offset, available);
+				}
+				offset = 0;
+				// reading further ahead than the remaining values can use would only have to be undone
+				requested = (int)hmin((int64_t)(VARINT_BUFFER_SIZE - available), (int64_t)(count - result) * MAX_VARINT_SIZE);
+				read = (int)this->readRaw(buffer + available, (int64_t)requested);
+				available += hmax(read, 0);
+				finished = (read < requested);
+			}
+			used = _decodeVarint(buffer + offset, available - offset, values[result]);
+			if (used <= 0)
+			{
+				break;
+			}
+			offset += used;
+			++result;
+		}
+		if (offset < available)
+		{
+			this->_seek(offset - available, SeekMode::Current);
+		}
+		if (used < 0)
+		{
+			throw Exception("Invalid varint in stream");
+		}
+		return result;
+	}
+
+	int StreamBase::loadZigzags(Span<int64_t> values)
+	{
+		int result = this->loadVarints(Span<uint64_t>((uint64_t*)values.data(), values.size()));
+		for_iter (i, 0, result)
+		{
+			values[i] = _zigzagDecode((uint64_t)values[i]);
+		}
+		return result;
+	}
+
+	Array<unsigned char> StreamBase::loadBlob()
+	{
+		int size = this->_loadBlobSize();
+		Array<unsigned char> result;
+		if (size > 0)
+		{
+			result.add((unsigned char)0, size);
+			if (this->readRaw(&result[0], (int64_t)size) != size)
+			{
+				throw Exception("Blob data in stream is incomplete");
+			}
+		}
+		return result;
+	}
+
+	String StreamBase::loadVarintString()
+	{
+		return this->read(this->_loadBlobSize());
+	}
+
+	void StreamBase::_dumpVarints(const uint64_t* values, int count, bool zigzag)
+	{
+		this->_validate();
+		unsigned char buffer[VARINT_BUFFER_SIZE];
+		int size = 0;
+		for_iter (i, 0, count)
+		{
+			if (size > VARINT_BUFFER_SIZE - MAX_VARINT_SIZE)
+			{
+				this->writeRaw(buffer, (int64_t)size);
+				size = 0;
+			}
+			size += _encodeVarint((zigzag ? _zigzagEncode((int64_t)values[i]) : values[i]), buffer + size);
+		}
+		if (size > 0)
+		{
+			this->writeRaw(buffer, (int64_t)size);
+		}
+	}
+
+	int StreamBase::_loadBlobSize()
+	{
+		uint64_t size = this->loadVarint();
+		// a corrupted size must not cause a huge allocation
+		if (size > (uint64_t)INT_MAX || (int64_t)size > this->size() - this->position())
+		{
+			throw Exception(hsprintf("Blob size %llu in stream is invalid!", (unsigned long long)size));
+		}
+		return (int)size;
+	}
+
+	int StreamBase::_loadCount(int elementSize)
+	{
+		int count = this->loadInt32();
+		if (count < 0)
+		{
+			throw ContainerIndexException(count);
+		}
+		// a corrupted count must not cause a huge allocation
+		if ((int64_t)count * elementSize > this->size() - this->position())
+		{
+			throw Exception(hsprintf("Element count %d in stream is invalid!", count));
+		}
+		return count;
+	}
+
+	void StreamBase::_loadValue(BitArray& value)
+	{
+		value = this->loadBitArray();
+	}
+
 	StreamBase::StreamBase(const StreamBase& other)
 	{
 		throw ObjectCannotCopyException("hltypes::StreamBase");
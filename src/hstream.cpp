@@ -10,7 +10,10 @@
 #include <string.h>
 #include <stdlib.h>
 #endif
+#include <limits.h>
+#include <stdint.h>
 
+#include "hexception.h"
 #include "hfile.h"
 #include "hlog.h"
 #include "hltypesUtil.h"
@@ -18,35 +21,35 @@
 
 namespace hltypes
 {
-	Stream::Stream(int initialCapacity) :
+	Stream::Stream(int64_t initialCapacity) :
 		StreamBase(),
 		stream(NULL),
 		streamSize((int64_t)0),
 		streamPosition((int64_t)0),
-		capacity((int64_t)hmax(MIN_HSTREAM_CAPACITY, initialCapacity))
+		capacity(hmax((int64_t)MIN_HSTREAM_CAPACITY, initialCapacity))
 	{
 		// using malloc because realloc is used later
-		this->stream = (unsigned char*)malloc((int)this->capacity);
+		this->stream = (unsigned char*)malloc((size_t)this->capacity);
 	}
 
-	Stream::Stream(unsigned char* initialData, int initialDataSize) :
+	Stream::Stream(unsigned char* initialData, int64_t initialDataSize) :
 		StreamBase(),
 		stream(NULL),
-		streamSize((int64_t)initialDataSize),
+		streamSize(initialDataSize),
 		streamPosition((int64_t)0),
-		capacity((int64_t)initialDataSize)
+		capacity(initialDataSize)
 	{
 		// using malloc because realloc is used later
 		if (initialDataSize > 0)
 		{
-			this->stream = (unsigned char*)malloc((int)this->capacity);
+			this->stream = (unsigned char*)malloc((size_t)this->capacity);
 			if (this->stream != NULL)
 			{
-				memcpy(this->stream, initialData, initialDataSize);
+				memcpy(this->stream, initialData, (size_t)initialDataSize);
 			}
 			else
 			{
-				hlog::errorf(logTag, "Could not allocate %d bytes of memory for hstream!", this->capacity);
+				hlog::errorf(logTag, "Could not allocate %lld bytes of memory for hstream!", this->capacity);
 			}
 		}
 		else
@@ -55,30 +58,30 @@ namespace hltypes
 			this->stream = (unsigned char*)malloc(MIN_HSTREAM_CAPACITY);
 			if (this->stream == NULL)
 			{
-				hlog::errorf(logTag, "Could not allocate %d bytes of memory for hstream!", this->capacity);
+				hlog::errorf(logTag, "Could not allocate %lld bytes of memory for hstream!", this->capacity);
 			}
 		}
 		this->_updateDataSize();
 	}
 
-	Stream::Stream(unsigned char* initialData, int initialDataSize, int initialCapacity) :
+	Stream::Stream(unsigned char* initialData, int64_t initialDataSize, int64_t initialCapacity) :
 		StreamBase(),
 		stream(NULL),
-		streamSize((int64_t)initialDataSize),
+		streamSize(initialDataSize),
 		streamPosition((int64_t)0),
-		capacity((int64_t)hmax(initialCapacity, initialDataSize))
+		capacity(hmax(initialCapacity, initialDataSize))
 	{
 		// using malloc because realloc is used later
 		if (initialDataSize > 0)
 		{
-			this->stream = (unsigned char*)malloc((int)this->capacity);
+			this->stream = (unsigned char*)malloc((size_t)this->capacity);
 			if (this->stream != NULL)
 			{
-				memcpy(this->stream, initialData, initialDataSize);
+				memcpy(this->stream, initialData, (size_t)initialDataSize);
 			}
 			else
 			{
-				hlog::errorf(logTag, "Could not allocate %d bytes of memory for hstream!", this->capacity);
+				hlog::errorf(logTag, "Could not allocate %lld bytes of memory for hstream!", this->capacity);
 			}
 		}
 		else
@@ -87,7 +90,7 @@ namespace hltypes
 			this->stream = (unsigned char*)malloc(MIN_HSTREAM_CAPACITY);
 			if (this->stream == NULL)
 			{
-				hlog::errorf(logTag, "Could not allocate %d bytes of memory for hstream!", this->capacity);
+				hlog::errorf(logTag, "Could not allocate %lld bytes of memory for hstream!", this->capacity);
 			}
 		}
 		this->_updateDataSize();
@@ -104,14 +107,14 @@ namespace hltypes
 		// using malloc because realloc is used later
 		if (this->streamSize > (int64_t)0)
 		{
-			this->stream = (unsigned char*)malloc((int)this->capacity);
+			this->stream = (unsigned char*)malloc((size_t)this->capacity);
 			if (this->stream != NULL)
 			{
-				memcpy(this->stream, (unsigned char*)other, (int)this->streamSize);
+				memcpy(this->stream, (unsigned char*)other, (size_t)this->streamSize);
 			}
 			else
 			{
-				hlog::errorf(logTag, "Could not allocate %d bytes of memory for hstream!", this->capacity);
+				hlog::errorf(logTag, "Could not allocate %lld bytes of memory for hstream!", this->capacity);
 			}
 		}
 		else
@@ -120,12 +123,27 @@ namespace hltypes
 			this->stream = (unsigned char*)malloc(MIN_HSTREAM_CAPACITY);
 			if (this->stream == NULL)
 			{
-				hlog::errorf(logTag, "Could not allocate %d bytes of memory for hstream!", this->capacity);
+				hlog::errorf(logTag, "Could not allocate %lld bytes of memory for hstream!", this->capacity);
 			}
 		}
 		this->_updateDataSize();
 	}
 
+	Stream::Stream(Stream&& other) :
+		StreamBase(),
+		stream(other.stream),
+		streamSize(other.streamSize),
+		streamPosition(other.streamPosition),
+		capacity(other.capacity)
+	{
+		other.stream = NULL;
+		other.streamSize = 0;
+		other.streamPosition = 0;
+		other.capacity = 0;
+		other._updateDataSize();
+		this->_updateDataSize();
+	}
+
 	Stream::~Stream()
 	{
 		if (this->stream != NULL)
@@ -135,7 +153,7 @@ namespace hltypes
 		}
 	}
 	
-	void Stream::clear(int newCapacity)
+	void Stream::clear(int64_t newCapacity)
 	{
 		this->streamSize = 0;
 		this->streamPosition = 0;
@@ -143,12 +161,16 @@ namespace hltypes
 		this->_updateDataSize();
 	}
 	
-	bool Stream::setCapacity(int newCapacity)
+	bool Stream::setCapacity(int64_t newCapacity)
 	{
-		newCapacity = hmax(MIN_HSTREAM_CAPACITY, newCapacity); // not allowing less than MIN_HSTREAM_CAPACITY bytes
+		newCapacity = hmax((int64_t)MIN_HSTREAM_CAPACITY, newCapacity); // not allowing less than MIN_HSTREAM_CAPACITY bytes
+		if ((uint64_t)newCapacity > (uint64_t)SIZE_MAX) // e.g. more than 4 GB on 32 bit platforms
+		{
+			return false;
+		}
 		if (this->capacity != newCapacity)
 		{
-			unsigned char* newStream = (unsigned char*)realloc(this->stream, newCapacity);
+			unsigned char* newStream = (unsigned char*)realloc(this->stream, (size_t)newCapacity);
 			if (newStream == NULL) // could not reallocate enough memory
 			{
 				return false;
@@ -164,21 +186,21 @@ namespace hltypes
 		return true;
 	}
 
-	int Stream::writeRaw(void* buffer, int count)
+	int64_t Stream::writeRaw(void* buffer, int64_t count)
 	{
 		return StreamBase::writeRaw(buffer, count);
 	}
 
-	int Stream::writeRaw(StreamBase& stream, int count)
+	int64_t Stream::writeRaw(StreamBase& stream, int64_t count)
 	{
 		this->_validate();
-		int result = 0;
+		int64_t result = 0;
 		if (count > 0)
 		{
 			this->_tryIncreaseCapacity(count);
 			if (count > 0)
 			{
-				result = stream.readRaw(&this->stream[(int)this->streamPosition], count);
+				result = stream.readRaw(&this->stream[this->streamPosition], count);
 				if (result > 0)
 				{
 					stream.seek(-result);
@@ -194,25 +216,30 @@ namespace hltypes
 		return result;
 	}
 
-	int Stream::writeRaw(StreamBase& stream)
+	int64_t Stream::writeRaw(StreamBase& stream)
 	{
 		return StreamBase::writeRaw(stream);
 	}
 
-	int Stream::writeRaw(Stream& stream, int count)
+	int64_t Stream::writeRaw(Stream& stream, int64_t count)
 	{
 		return StreamBase::writeRaw(stream, count);
 	}
 
-	int Stream::writeRaw(Stream& stream)
+	int64_t Stream::writeRaw(Stream& stream)
 	{
 		return StreamBase::writeRaw(stream);
 	}
 
-	int Stream::prepareManualWriteRaw(int count)
+	int Stream::writeRaw(Span<const unsigned char> buffer)
+	{
+		return StreamBase::writeRaw(buffer);
+	}
+
+	int64_t Stream::prepareManualWriteRaw(int64_t count)
 	{
 		this->_validate();
-		int result = 0;
+		int64_t result = 0;
 		if (count > 0)
 		{
 			this->_tryIncreaseCapacity(count);
@@ -229,16 +256,16 @@ namespace hltypes
 		return result;
 	}
 
-	int Stream::fill(unsigned char value, int count)
+	int64_t Stream::fill(unsigned char value, int64_t count)
 	{
 		this->_validate();
-		int result = 0;
+		int64_t result = 0;
 		if (count > 0)
 		{
 			this->_tryIncreaseCapacity(count);
 			if (count > 0)
 			{
-				memset(&this->stream[(int)this->streamPosition], value, count);
+				memset(&this->stream[this->streamPosition], value, (size_t)count);
 				result = count;
 				this->streamPosition += count;
 				if (this->streamSize < this->streamPosition)
@@ -264,11 +291,53 @@ namespace hltypes
 		return true;
 	}
 
-	const unsigned char& Stream::operator[](int index) const
+	void Stream::adopt(unsigned char* buffer, int64_t size, int64_t capacity)
+	{
+		if (buffer == NULL)
+		{
+			throw Exception("Cannot adopt a NULL buffer!");
+		}
+		if (this->stream != NULL && this->stream != buffer)
+		{
+			free(this->stream);
+		}
+		this->stream = buffer;
+		this->streamSize = hmax(size, (int64_t)0);
+		this->streamPosition = 0;
+		this->capacity = hmax(capacity, this->streamSize);
+		this->_updateDataSize();
+	}
+
+	unsigned char* Stream::release()
+	{
+		unsigned char* result = this->stream;
+		this->stream = NULL;
+		this->capacity = 0;
+		// the Stream remains usable with a new small buffer
+		this->clear();
+		return result;
+	}
+
+	String Stream::detachToString()
+	{
+		if (this->streamSize > INT_MAX)
+		{
+			throw Exception(hsprintf("Stream is too large for a String: %lld bytes", this->streamSize));
+		}
+		String result;
+		if (this->stream != NULL && this->streamSize > 0)
+		{
+			result.set((const char*)this->stream, (int)this->streamSize);
+		}
+		this->clear();
+		return result;
+	}
+
+	const unsigned char& Stream::operator[](int64_t index) const
 	{
 		if (index < 0)
 		{
-			index = (int)((int64_t)index + this->streamSize);
+			index += this->streamSize;
 		}
 		return this->stream[index];
 	}
@@ -278,13 +347,13 @@ namespace hltypes
 		int64_t otherDataSize = other.dataSize;
 		this->streamSize = other.streamSize;
 		this->streamPosition = other.streamPosition;
-		this->setCapacity((int)other.capacity);
+		this->setCapacity(other.capacity);
 		// using malloc because realloc is used later
 		if (otherDataSize > 0)
 		{
 			if (this->capacity >= otherDataSize)
 			{
-				memcpy(this->stream, (unsigned char*)other.stream, (int)otherDataSize);
+				memcpy(this->stream, (unsigned char*)other.stream, (size_t)otherDataSize);
 			}
 			else
 			{
@@ -295,6 +364,28 @@ namespace hltypes
 		return (*this);
 	}
 
+	Stream& Stream::operator=(Stream&& other)
+	{
+		if (this != &other)
+		{
+			if (this->stream != NULL)
+			{
+				free(this->stream);
+			}
+			this->stream = other.stream;
+			this->streamSize = other.streamSize;
+			this->streamPosition = other.streamPosition;
+			this->capacity = other.capacity;
+			other.stream = NULL;
+			other.streamSize = 0;
+			other.streamPosition = 0;
+			other.capacity = 0;
+			other._updateDataSize();
+			this->_updateDataSize();
+		}
+		return (*this);
+	}
+
 	Stream::operator char*() const
 	{
 		return (char*)&this->stream[0];
@@ -315,6 +406,24 @@ namespace hltypes
 		return &this->stream[0];
 	}
 
+	Stream::operator Span<unsigned char>()
+	{
+		if (this->streamSize > INT_MAX)
+		{
+			throw Exception(hsprintf("Stream is too large for a Span: %lld bytes", this->streamSize));
+		}
+		return Span<unsigned char>(this->stream, (int)this->streamSize);
+	}
+
+	Stream::operator Span<const unsigned char>() const
+	{
+		if (this->streamSize > INT_MAX)
+		{
+			throw Exception(hsprintf("Stream is too large for a Span: %lld bytes", this->streamSize));
+		}
+		return Span<const unsigned char>(this->stream, (int)this->streamSize);
+	}
+
 	void Stream::_updateDataSize()
 	{
 		this->dataSize = this->streamSize;
@@ -334,12 +443,14 @@ namespace hltypes
 	int Stream::_write(const void* buffer, int count)
 	{
 		int result = 0;
-		if (count > 0)
+		int64_t writeSize = count;
+		if (writeSize > 0)
 		{
-			this->_tryIncreaseCapacity(count);
+			this->_tryIncreaseCapacity(writeSize);
+			count = (int)writeSize;
 			if (count > 0)
 			{
-				memcpy(&this->stream[(int)this->streamPosition], buffer, count);
+				memcpy(&this->stream[this->streamPosition], buffer, count);
 				result = count;
 				this->streamPosition += result;
 				this->streamSize = hmax(this->streamSize, this->streamPosition);
@@ -375,13 +486,18 @@ namespace hltypes
 		return true;
 	}
 	
-	bool Stream::_tryIncreaseCapacity(int& write_size)
+	bool Stream::_tryIncreaseCapacity(int64_t& write_size)
 	{
-		if (write_size > this->capacity - this->streamPosition && !this->setCapacity(hpotCeil((int)(write_size + this->streamPosition))))
+		if (write_size > this->capacity - this->streamPosition)
 		{
-			// could not reallocate enough memory, reduce write_size
-			write_size = (int)hmax(this->capacity - this->streamPosition, (int64_t)0);
-			return false;
+			int64_t required = write_size + this->streamPosition;
+			// large buffers may not have room for the next power of two, but enough for the exact size
+			if (!this->setCapacity(hpotCeil(required)) && !this->setCapacity(required))
+			{
+				// could not reallocate enough memory, reduce write_size
+				write_size = hmax(this->capacity - this->streamPosition, (int64_t)0);
+				return false;
+			}
 		}
 		return true;
 	}
@@ -0,0 +1,177 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "harray.h"
+#include "hexception.h"
+#include "hlog.h"
+#include "hspan.h"
+#include "hstream.h"
+#include "hstreamchain.h"
+
+#define MIN_STREAM_CHAIN_BLOCK_SIZE 16
+
+namespace hltypes
+{
+	StreamChain::StreamChain(int blockSize) :
+		StreamBase(),
+		blockSize(hmax(blockSize, MIN_STREAM_CHAIN_BLOCK_SIZE)),
+		chainPosition(0LL)
+	{
+	}
+
+	StreamChain::~StreamChain()
+	{
+		this->clear();
+	}
+
+	int StreamChain::getBlockCount() const
+	{
+		return this->blocks.size();
+	}
+
+	Span<const unsigned char> StreamChain::getBlock(int index) const
+	{
+		if (index < 0 || index >= this->blocks.size())
+		{
+			throw ContainerIndexException(index);
+		}
+		int64_t start = (int64_t)index * this->blockSize;
+		return Span<const unsigned char>(this->blocks[index], (int)hmin(this->dataSize - start, (int64_t)this->blockSize));
+	}
+
+	void StreamChain::clear()
+	{
+		foreach (unsigned char*, it, this->blocks)
+		{
+			free(*it);
+		}
+		this->blocks.clear();
+		this->dataSize = 0LL;
+		this->chainPosition = 0LL;
+	}
+
+	Stream StreamChain::toStream() const
+	{
+		Stream result(this->dataSize);
+		int count = this->blocks.size();
+		for_iter (i, 0, count)
+		{
+			result.writeRaw(this->getBlock(i));
+		}
+		result.rewind();
+		return result;
+	}
+
+	int64_t StreamChain::writeTo(StreamBase& stream) const
+	{
+		Array<Span<const unsigned char> > buffers;
+		int count = this->blocks.size();
+		buffers.reserve(count);
+		for_iter (i, 0, count)
+		{
+			buffers += this->getBlock(i);
+		}
+		return stream.writeRawVectored(buffers);
+	}
+
+	void StreamChain::_updateDataSize()
+	{
+	}
+
+	int StreamChain::_read(void* buffer, int count)
+	{
+		int result = 0;
+		int index = 0;
+		int offset = 0;
+		int size = 0;
+		count = (int)hclamp((int64_t)count, (int64_t)0, this->dataSize - this->chainPosition);
+		while (result < count)
+		{
+			index = (int)(this->chainPosition / this->blockSize);
+			offset = (int)(this->chainPosition % this->blockSize);
+			size = hmin(count - result, this->blockSize - offset);
+			memcpy((unsigned char*)buffer + result, this->blocks[index] + offset, size);
+			result += size;
+			this->chainPosition += size;
+		}
+		return result;
+	}
+
+	int StreamChain::_write(const void* buffer, int count)
+	{
+		int result = 0;
+		int index = 0;
+		int offset = 0;
+		int size = 0;
+		unsigned char* block = NULL;
+		while (result < count)
+		{
+			index = (int)(this->chainPosition / this->blockSize);
+			offset = (int)(this->chainPosition % this->blockSize);
+			// the position never goes past the end so at most one new block is needed
+			if (index >= this->blocks.size())
+			{
+				block = (unsigned char*)malloc(this->blockSize);
+				if (block == NULL)
+				{
+					hlog::errorf(logTag, "Could not allocate %d bytes of memory for hstreamchain!", this->blockSize);
+					break;
+				}
+				this->blocks += block;
+			}
+			size = hmin(count - result, this->blockSize - offset);
+			memcpy(this->blocks[index] + offset, (const unsigned char*)buffer + result, size);
+			result += size;
+			this->chainPosition += size;
+		}
+		this->dataSize = hmax(this->dataSize, this->chainPosition);
+		return result;
+	}
+
+	bool StreamChain::_isOpen() const
+	{
+		return true;
+	}
+
+	int64_t StreamChain::_position() const
+	{
+		return this->chainPosition;
+	}
+
+	bool StreamChain::_seek(int64_t offset, SeekMode seekMode)
+	{
+		if (seekMode == SeekMode::Current)
+		{
+			this->chainPosition = hclamp(this->chainPosition + offset, (int64_t)0, this->dataSize);
+		}
+		else if (seekMode == SeekMode::Start)
+		{
+			this->chainPosition = hclamp(offset, (int64_t)0, this->dataSize);
+		}
+		else if (seekMode == SeekMode::End)
+		{
+			this->chainPosition = hclamp(this->dataSize + offset, (int64_t)0, this->dataSize);
+		}
+		return true;
+	}
+
+	StreamChain::StreamChain(const StreamChain& other)
+	{
+		throw ObjectCannotCopyException("hltypes::StreamChain");
+	}
+
+	StreamChain& StreamChain::operator=(StreamChain& other)
+	{
+		throw ObjectCannotAssignException("hltypes::StreamChain");
+		return (*this);
+	}
+
+}
@@ -0,0 +1,46 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+
+#include "hexception.h"
+#include "hspan.h"
+#include "hstream.h"
+#include "hstreamreader.h"
+
+namespace hltypes
+{
+	StreamReader::StreamReader(Span<const unsigned char> data, int position) :
+		data(data.data()),
+		size(data.size()),
+		position(0),
+		checked(true)
+	{
+		this->seek(position);
+	}
+
+	StreamReader::StreamReader(const Stream& stream) :
+		data(NULL),
+		size(0),
+		position(0),
+		checked(true)
+	{
+		Span<const unsigned char> data = stream;
+		this->data = data.data();
+		this->size = data.size();
+		this->position = (int)stream.position();
+	}
+
+	void StreamReader::seek(int position)
+	{
+		if (position < 0 || position > this->size)
+		{
+			throw ContainerIndexException(position);
+		}
+		this->position = position;
+	}
+
+}
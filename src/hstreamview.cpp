@@ -0,0 +1,125 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+
+#include <limits.h>
+#include <string.h>
+
+#include "hexception.h"
+#include "hspan.h"
+#include "hstreamview.h"
+#include "hstring.h"
+
+namespace hltypes
+{
+	StreamView::StreamView(const void* data, int64_t size) :
+		StreamBase(),
+		data((const unsigned char*)data),
+		dataPosition(0LL)
+	{
+		this->dataSize = (this->data != NULL ? hmax(size, (int64_t)0) : 0LL);
+	}
+
+	StreamView::StreamView(Span<const unsigned char> data) :
+		StreamBase(),
+		data(data.data()),
+		dataPosition(0LL)
+	{
+		this->dataSize = (int64_t)data.size();
+	}
+
+	StreamView::~StreamView()
+	{
+	}
+
+	Span<const unsigned char> StreamView::span() const
+	{
+		if (this->dataSize > INT_MAX)
+		{
+			throw Exception("StreamView is too large to be converted to a Span!");
+		}
+		return Span<const unsigned char>(this->data, (int)this->dataSize);
+	}
+
+	Span<const unsigned char> StreamView::readView(int count)
+	{
+		int readSize = (int)hclamp((int64_t)count, (int64_t)0, this->dataSize - this->dataPosition);
+		Span<const unsigned char> result(this->data + this->dataPosition, readSize);
+		this->dataPosition += readSize;
+		return result;
+	}
+
+	StreamView::operator Span<const unsigned char>() const
+	{
+		return this->span();
+	}
+
+	String StreamView::_descriptor() const
+	{
+		return "streamview";
+	}
+
+	void StreamView::_updateDataSize()
+	{
+	}
+
+	int StreamView::_read(void* buffer, int count)
+	{
+		int readSize = (int)hclamp((int64_t)count, (int64_t)0, this->dataSize - this->dataPosition);
+		if (readSize > 0)
+		{
+			memcpy(buffer, &this->data[this->dataPosition], readSize);
+			this->dataPosition += readSize;
+		}
+		return readSize;
+	}
+
+	int StreamView::_write(const void* buffer, int count)
+	{
+		throw FileNotWriteableException(this->_descriptor());
+		return 0;
+	}
+
+	bool StreamView::_isOpen() const
+	{
+		return true;
+	}
+
+	int64_t StreamView::_position() const
+	{
+		return this->dataPosition;
+	}
+
+	bool StreamView::_seek(int64_t offset, SeekMode seekMode)
+	{
+		if (seekMode == SeekMode::Current)
+		{
+			this->dataPosition = hclamp(this->dataPosition + offset, (int64_t)0, this->dataSize);
+		}
+		else if (seekMode == SeekMode::Start)
+		{
+			this->dataPosition = hclamp(offset, (int64_t)0, this->dataSize);
+		}
+		else if (seekMode == SeekMode::End)
+		{
+			this->dataPosition = hclamp(this->dataSize + offset, (int64_t)0, this->dataSize);
+		}
+		return true;
+	}
+
+	StreamView::StreamView(const StreamView& other)
+	{
+		throw ObjectCannotCopyException("hltypes::StreamView");
+	}
+
+	StreamView& StreamView::operator=(StreamView& other)
+	{
+		throw ObjectCannotAssignException("hltypes::StreamView");
+		return (*this);
+	}
+
+}
@@ -0,0 +1,109 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+
+#include <limits.h>
+
+#include "hexception.h"
+#include "hlog.h"
+#include "hspan.h"
+#include "hstream.h"
+#include "hstreamwriter.h"
+
+namespace hltypes
+{
+	StreamWriter::StreamWriter(Span<unsigned char> data, int position) :
+		data(data.data()),
+		capacity(data.size()),
+		position(0),
+		checked(true),
+		stream(NULL),
+		streamStart(0LL)
+	{
+		if (position < 0 || position > this->capacity)
+		{
+			throw ContainerIndexException(position);
+		}
+		this->position = position;
+	}
+
+	StreamWriter::StreamWriter(Stream& stream) :
+		data(NULL),
+		capacity(0),
+		position(0),
+		checked(true),
+		stream(&stream),
+		streamStart(stream.position())
+	{
+		if (this->streamStart > INT_MAX)
+		{
+			throw Exception(hsprintf("Stream is too large for a StreamWriter: %lld bytes", this->streamStart));
+		}
+		this->data = (unsigned char*)stream;
+		this->capacity = (int)hmin(stream.getCapacity(), (int64_t)INT_MAX);
+		this->position = (int)this->streamStart;
+	}
+
+	StreamWriter::~StreamWriter()
+	{
+		// exceptions must not leave a destructor
+		try
+		{
+			this->finish();
+		}
+		catch (_Exception& e)
+		{
+			hlog::error(logTag, "Could not finish StreamWriter: " + e.getMessage());
+		}
+	}
+
+	void StreamWriter::finish()
+	{
+		if (this->stream != NULL && this->position > this->streamStart)
+		{
+			// the memory already contains the data, only the size and position of the Stream are updated
+			int64_t written = this->position - this->streamStart;
+			this->stream->seek(this->streamStart, StreamBase::SeekMode::Start);
+			this->stream->prepareManualWriteRaw(written);
+			this->stream->seek(written);
+			this->streamStart = this->position;
+		}
+	}
+
+	void StreamWriter::_grow(int count)
+	{
+		int64_t required = (int64_t)this->position + count;
+		if (this->stream == NULL || count < 0 || required > INT_MAX)
+		{
+			this->_throwRange(count);
+		}
+		// growing like Stream does so many small writes do not reallocate often
+		if (!this->stream->setCapacity(hmin(hpotCeil(required), (int64_t)INT_MAX)) && !this->stream->setCapacity(required))
+		{
+			throw Exception(hsprintf("Could not allocate %lld bytes of memory for StreamWriter!", required));
+		}
+		this->data = (unsigned char*)(*this->stream);
+		this->capacity = (int)hmin(this->stream->getCapacity(), (int64_t)INT_MAX);
+	}
+
+	void StreamWriter::_throwRange(int count) const
+	{
+		throw ContainerRangeException(this->position, count);
+	}
+
+	StreamWriter::StreamWriter(const StreamWriter& other)
+	{
+		throw ObjectCannotCopyException("hltypes::StreamWriter");
+	}
+
+	StreamWriter& StreamWriter::operator=(StreamWriter& other)
+	{
+		throw ObjectCannotAssignException("hltypes::StreamWriter");
+		return (*this);
+	}
+
+}
@@ -12,17 +12,22 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <type_traits>
+#include <utility>
 
 #include "harray.h"
 #include "hexception.h"
 #include "hlog.h"
 #include "hltypesUtil.h"
 #include "hplatform.h"
+#include "hspan.h"
 #include "hstring.h"
 #include "platform_internal.h"
 
 #define FORMAT_BUFFER_SIZE 16
 #define FORMATTING_STRING_BUFFER_SIZE 64
+// "%f" of the largest double has 309 integer digits
+#define FORMATTING_FLOAT_BUFFER_SIZE 384
 
 #define BOOL_TO_STRING(b) ((b) ? "true" : "false")
 
@@ -300,6 +305,12 @@ namespace hltypes
 	{
 	}
 
+	String::String(String&& string) :
+		stdstr(std::move((stdstr&)string))
+	{
+		string.stdstr::clear();
+	}
+
 	String::String(const char* string, const int length) :
 		stdstr(string, length)
 	{
@@ -1773,6 +1784,16 @@ namespace hltypes
 		return *this;
 	}
 
+	String& String::operator=(String&& string)
+	{
+		if (this != &string)
+		{
+			stdstr::operator=(std::move((stdstr&)string));
+			string.stdstr::clear();
+		}
+		return *this;
+	}
+
 	String String::operator=(const bool b)
 	{
 		stdstr::assign(BOOL_TO_STRING(b));
@@ -2219,48 +2240,220 @@ namespace hltypes
 		return (string != NULL ? (const char*)string : "");
 	}
 
-	String String::fromUnicode(Array<unsigned int> chars)
+	String String::fromUnicode(Span<const unsigned int> chars)
 	{
 		String result;
-		foreach (unsigned int, it, chars)
+		int size = chars.size();
+		for_iter (i, 0, size)
 		{
-			_FROM_UNICODE_FAST(result, (*it));
+			_FROM_UNICODE_FAST(result, chars.data()[i]);
 		}
 		return result;
 	}
 
-	String String::fromUnicode(Array<wchar_t> chars)
+	String String::fromUnicode(Span<const wchar_t> chars)
 	{
 		String result;
 		unsigned int code;
-		foreach (wchar_t, it, chars)
+		int size = chars.size();
+		for_iter (i, 0, size)
 		{
-			code = (*it);
+			code = chars.data()[i];
 			_FROM_UNICODE_FAST(result, code);
 		}
 		return result;
 	}
 
-	String String::fromUnicode(Array<char> chars)
+	String String::fromUnicode(Span<const char> chars)
+	{
+		return (chars.size() > 0 ? String(chars.data(), chars.size()) : String());
+	}
+
+	String String::fromUnicode(Span<const unsigned char> chars)
+	{
+		return (chars.size() > 0 ? String((const char*)chars.data(), chars.size()) : String());
+	}
+
+	String String::fromUnicode(const Array<unsigned int>& chars)
+	{
+		return String::fromUnicode(chars.span());
+	}
+
+	String String::fromUnicode(const Array<wchar_t>& chars)
+	{
+		return String::fromUnicode(chars.span());
+	}
+
+	String String::fromUnicode(const Array<char>& chars)
+	{
+		return String::fromUnicode(chars.span());
+	}
+
+	String String::fromUnicode(const Array<unsigned char>& chars)
+	{
+		return String::fromUnicode(chars.span());
+	}
+
+	// writes integers and separators directly into output that is sized for the longest possible result first
+	template <typename T>
+	static void _joinIntegers(stdstr& output, Span<const T> values, const String& separator)
+	{
+		int count = values.size();
+		const char* separatorData = separator.cStr();
+		int separatorSize = separator.size();
+		// 20 digits and a sign cover all 64 bit integers
+		output.resize((size_t)count * 21 + (size_t)(count - 1) * separatorSize);
+		char* start = &output[0];
+		char* current = start;
+		char digits[24];
+		char* digitsEnd = digits + sizeof(digits);
+		char* first = NULL;
+		T value = 0;
+		uint64_t magnitude = 0;
+		for_iter (i, 0, count)
+		{
+			if (i > 0 && separatorSize > 0)
+			{
+				memcpy(current, separatorData, separatorSize);
+				current += separatorSize;
+			}
+			value = values.data()[i];
+			magnitude = (std::is_signed<T>::value && value < (T)0 ? (uint64_t)0 - (uint64_t)value : (uint64_t)value);
+			first = digitsEnd;
+			do
+			{
+				*--first = (char)('0' + magnitude % 10);
+				magnitude /= 10;
+			} while (magnitude != 0);
+			if (std::is_signed<T>::value && value < (T)0)
+			{
+				*--first = '-';
+			}
+			memcpy(current, first, digitsEnd - first);
+			current += digitsEnd - first;
+		}
+		output.resize(current - start);
+	}
+
+	// formats like String::set(float) and String::set(double) and appends to output that has been reserved in advance
+	template <typename T>
+	static void _joinFloats(stdstr& output, Span<const T> values, const String& separator)
+	{
+		int count = values.size();
+		const char* separatorData = separator.cStr();
+		int separatorSize = separator.size();
+		output.reserve((size_t)count * (12 + separatorSize));
+		char string[FORMATTING_FLOAT_BUFFER_SIZE] = { '\0' };
+		int size = 0;
+		for_iter (i, 0, count)
+		{
+			if (i > 0)
+			{
+				output.append(separatorData, separatorSize);
+			}
+			size = _platformSprintf(string, "%f", (double)values.data()[i]);
+			while (size > 0 && string[size - 1] == '0')
+			{
+				--size;
+			}
+			while (size > 0 && string[size - 1] == '.')
+			{
+				--size;
+			}
+			output.append(string, size);
+		}
+	}
+
+	String String::join(Span<const String> strings, const String& separator)
 	{
 		String result;
-		foreach (char, it, chars)
+		int count = strings.size();
+		if (count == 0)
+		{
+			return result;
+		}
+		const String* data = strings.data();
+		int separatorSize = separator.size();
+		size_t size = (size_t)(count - 1) * separatorSize;
+		for_iter (i, 0, count)
 		{
-			result += (*it);
+			size += data[i].size();
+		}
+		stdstr& output = result;
+		output.resize(size);
+		char* current = &output[0];
+		int stringSize = 0;
+		for_iter (i, 0, count)
+		{
+			if (i > 0 && separatorSize > 0)
+			{
+				memcpy(current, separator.cStr(), separatorSize);
+				current += separatorSize;
+			}
+			stringSize = data[i].size();
+			if (stringSize > 0)
+			{
+				memcpy(current, data[i].cStr(), stringSize);
+				current += stringSize;
+			}
 		}
 		return result;
 	}
 
-	String String::fromUnicode(Array<unsigned char> chars)
+	String String::join(Span<const int> values, const String& separator)
 	{
 		String result;
-		foreach (unsigned char, it, chars)
+		if (values.size() > 0)
 		{
-			result += (char)(*it);
+			_joinIntegers<int>(result, values, separator);
 		}
 		return result;
 	}
 
+	String String::join(Span<const unsigned int> values, const String& separator)
+	{
+		String result;
+		if (values.size() > 0)
+		{
+			_joinIntegers<unsigned int>(result, values, separator);
+		}
+		return result;
+	}
+
+	String String::join(Span<const int64_t> values, const String& separator)
+	{
+		String result;
+		if (values.size() > 0)
+		{
+			_joinIntegers<int64_t>(result, values, separator);
+		}
+		return result;
+	}
+
+	String String::join(Span<const uint64_t> values, const String& separator)
+	{
+		String result;
+		if (values.size() > 0)
+		{
+			_joinIntegers<uint64_t>(result, values, separator);
+		}
+		return result;
+	}
+
+	String String::join(Span<const float> values, const String& separator)
+	{
+		String result;
+		_joinFloats<float>(result, values, separator);
+		return result;
+	}
+
+	String String::join(Span<const double> values, const String& separator)
+	{
+		String result;
+		_joinFloats<double>(result, values, separator);
+		return result;
+	}
+
 }
 
 hltypes::String hvsprintf(const char* format, va_list args)
@@ -22,6 +22,17 @@
 #include "hthread.h"
 #include "platform_internal.h"
 
+// number of idle iterations during which backoff() only spins before it starts yielding
+#define BACKOFF_SPIN_COUNT 64
+// number of idle iterations during which backoff() only yields before it starts sleeping
+#define BACKOFF_YIELD_COUNT 1000
+// sleep time in milliseconds of the first idle iteration after yielding, it doubles with every further iteration
+#define BACKOFF_MIN_SLEEP 0.05f
+// longest sleep time in milliseconds of backoff()
+#define BACKOFF_MAX_SLEEP 1.0f
+// number of idle iterations after which the sleep time stops doubling
+#define BACKOFF_SLEEP_STEPS 5
+
 #ifdef _UWP
 using namespace Windows::Foundation;
 using namespace Windows::System::Threading;
@@ -336,6 +347,29 @@ namespace hltypes
 #endif
 	}
 
+	void Thread::backoff(int& idleCount)
+	{
+		if (idleCount < BACKOFF_SPIN_COUNT)
+		{
+			++idleCount;
+		}
+		else if (idleCount < BACKOFF_YIELD_COUNT)
+		{
+			++idleCount;
+			Thread::sleep(0.0f);
+		}
+		else
+		{
+			// short sleeps first so a wait that just missed the yield phase does not always cost a full millisecond
+			int step = idleCount - BACKOFF_YIELD_COUNT;
+			if (step < BACKOFF_SLEEP_STEPS)
+			{
+				++idleCount;
+			}
+			Thread::sleep(hmin(BACKOFF_MIN_SLEEP * (float)(1 << step), BACKOFF_MAX_SLEEP));
+		}
+	}
+
 	Thread::Thread(const Thread& other) :
 		runner(this)
 	{
@@ -0,0 +1,235 @@
+/// @file
+/// @version 4.0
+///
+/// @section LICENSE
+///
+/// This program is free software; you can redistribute it and/or modify it under
+/// the terms of the BSD license: http://opensource.org/licenses/BSD-3-Clause
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+#include <exception>
+
+#define __HL_INCLUDE_PLATFORM_HEADERS
+#include "hexception.h"
+#include "hltypesUtil.h"
+#include "hmutex.h"
+#include "hplatform.h"
+#include "hstring.h"
+#include "hthread.h"
+#include "hthreadpool.h"
+
+namespace hltypes
+{
+	ThreadPool* ThreadPool::shared = NULL;
+	Mutex ThreadPool::sharedMutex;
+
+	ThreadPool::Worker::Worker(ThreadPool* pool, const String& name) :
+		Thread(&ThreadPool::_work, name)
+	{
+		this->pool = pool;
+	}
+
+	ThreadPool::ThreadPool(int workerCount, const String& name) :
+		mutex("ThreadPool Mutex"),
+		executing(false),
+		function(NULL),
+		data(NULL),
+		jobCount(0),
+		nextJob(0),
+		finishedJobs(0),
+		failed(false),
+		stopping(false)
+	{
+		this->name = name;
+		if (workerCount < 0)
+		{
+			workerCount = hmax(ThreadPool::getProcessorCount() - 1, 0);
+		}
+		Worker* worker = NULL;
+		for_iter (i, 0, workerCount)
+		{
+			worker = new Worker(this, hsprintf("%s worker %d", (this->name != "" ? this->name.cStr() : "ThreadPool"), i));
+			this->workers.push_back(worker);
+			worker->start();
+		}
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		Mutex::ScopeLock lock(&this->mutex);
+		this->stopping = true;
+		this->jobsAvailable.notify_all();
+		lock.release();
+		for_iter (i, 0, (int)this->workers.size())
+		{
+			this->workers[i]->join();
+			delete this->workers[i];
+		}
+		this->workers.clear();
+	}
+
+	void ThreadPool::execute(void (*function)(int, void*), void* data, int count)
+	{
+		if (count <= 0)
+		{
+			return;
+		}
+		Mutex::ScopeLock lock(&this->mutex);
+		if (this->executing || this->workers.size() == 0)
+		{
+			lock.release();
+			for_iter (i, 0, count)
+			{
+				(*function)(i, data);
+			}
+			return;
+		}
+		this->executing = true;
+		this->function = function;
+		this->data = data;
+		this->nextJob = 0;
+		this->finishedJobs = 0;
+		this->failed = false;
+		this->errorMessage = "";
+		this->jobCount = count;
+		this->jobsAvailable.notify_all();
+		lock.release();
+		// jobs never throw out of _executeNextJob() so the batch is always reset below
+		while (this->_executeNextJob())
+		{
+		}
+		lock.acquire(&this->mutex);
+		while (this->finishedJobs < this->jobCount)
+		{
+			this->batchFinished.wait(this->mutex);
+		}
+		bool failed = this->failed;
+		String errorMessage = this->errorMessage;
+		this->function = NULL;
+		this->data = NULL;
+		this->jobCount = 0;
+		this->nextJob = 0;
+		this->finishedJobs = 0;
+		this->executing = false;
+		lock.release();
+		if (failed)
+		{
+			throw Exception("Job in thread pool failed: " + errorMessage);
+		}
+	}
+
+	bool ThreadPool::_executeNextJob()
+	{
+		Mutex::ScopeLock lock(&this->mutex);
+		if (this->nextJob >= this->jobCount)
+		{
+			return false;
+		}
+		int index = this->nextJob;
+		++this->nextJob;
+		void (*function)(int, void*) = this->function;
+		void* data = this->data;
+		lock.release();
+		try
+		{
+			(*function)(index, data);
+		}
+		catch (_Exception& e)
+		{
+			this->_fail(e.getMessage());
+		}
+		catch (std::exception& e)
+		{
+			this->_fail(e.what());
+		}
+		catch (...)
+		{
+			this->_fail("Unknown exception");
+		}
+		lock.acquire(&this->mutex);
+		++this->finishedJobs;
+		if (this->finishedJobs >= this->jobCount)
+		{
+			this->batchFinished.notify_all();
+		}
+		return true;
+	}
+
+	void ThreadPool::_fail(const String& message)
+	{
+		Mutex::ScopeLock lock(&this->mutex);
+		if (!this->failed)
+		{
+			this->failed = true;
+			this->errorMessage = message;
+		}
+	}
+
+	void ThreadPool::_work(Thread* thread)
+	{
+		ThreadPool* pool = ((Worker*)thread)->pool;
+		Mutex::ScopeLock lock;
+		while (thread->isRunning())
+		{
+			if (!pool->_executeNextJob())
+			{
+				lock.acquire(&pool->mutex);
+				while (!pool->stopping && pool->nextJob >= pool->jobCount)
+				{
+					pool->jobsAvailable.wait(pool->mutex);
+				}
+				bool stopping = pool->stopping;
+				lock.release();
+				if (stopping)
+				{
+					break;
+				}
+			}
+		}
+	}
+
+	int ThreadPool::getProcessorCount()
+	{
+#ifdef _WIN32
+		SYSTEM_INFO info;
+		GetNativeSystemInfo(&info);
+		return hmax((int)info.dwNumberOfProcessors, 1);
+#else
+		return hmax((int)sysconf(_SC_NPROCESSORS_ONLN), 1);
+#endif
+	}
+
+	ThreadPool* ThreadPool::getShared()
+	{
+		Mutex::ScopeLock lock(&ThreadPool::sharedMutex);
+		if (ThreadPool::shared == NULL)
+		{
+			ThreadPool::shared = new ThreadPool(-1, "hltypes");
+		}
+		return ThreadPool::shared;
+	}
+
+	void ThreadPool::destroyShared()
+	{
+		Mutex::ScopeLock lock(&ThreadPool::sharedMutex);
+		if (ThreadPool::shared != NULL)
+		{
+			delete ThreadPool::shared;
+			ThreadPool::shared = NULL;
+		}
+	}
+
+	ThreadPool::ThreadPool(const ThreadPool& other)
+	{
+		throw ObjectCannotCopyException("hltypes::ThreadPool");
+	}
+
+	ThreadPool& ThreadPool::operator=(ThreadPool& other)
+	{
+		throw ObjectCannotAssignException("hltypes::ThreadPool");
+		return (*this);
+	}
+
+}
@@ -16,12 +16,11 @@
 #else
 	#include <stdlib.h>
 	#include <dirent.h>
+	#include <errno.h>
 	#include <sys/stat.h>
 	#include <sys/types.h>
+	#include <sys/uio.h>
 	#include <unistd.h>
-	#if defined(__ANDROID__) || defined(__APPLE__)
-		#include <errno.h>
-	#endif
 #endif
 
 #define __HL_INCLUDE_PLATFORM_HEADERS
@@ -30,9 +29,13 @@
 #include "hfbase.h"
 #include "hlog.h"
 #include "hplatform.h"
+#include "hspan.h"
 #include "hstring.h"
 #include "platform_internal.h"
 
+// more buffers are written with several writev() calls, most platforms allow at least this many at once
+#define VECTORED_WRITE_MAX 64
+
 #if defined(_WIN32) && defined(_MSC_VER) && !defined(_UWP)
 	#define _WIN32_MKDIR_FULL_PERMISSIONS
 #endif
@@ -164,6 +167,78 @@ namespace hltypes
 		return (int)fwrite(buffer, elementSize, elementCount, (FILE*)file);
 	}
 
+	int64_t _platformWriteFileVectored(_platformFile* file, const Span<const unsigned char>* buffers, int count)
+	{
+		int64_t result = 0;
+#ifndef _WIN32
+		// pending stdio data has to be written first since writev() bypasses the FILE buffer
+		if (fflush((FILE*)file) != 0)
+		{
+			return 0;
+		}
+		int descriptor = fileno((FILE*)file);
+		struct iovec vectors[VECTORED_WRITE_MAX];
+		int index = 0;
+		int offset = 0;
+		int vectorCount = 0;
+		ssize_t written = 0;
+		while (true)
+		{
+			vectorCount = 0;
+			for (int i = index; i < count && vectorCount < VECTORED_WRITE_MAX; ++i)
+			{
+				if (buffers[i].size() > (i == index ? offset : 0))
+				{
+					vectors[vectorCount].iov_base = (void*)(buffers[i].data() + (i == index ? offset : 0));
+					vectors[vectorCount].iov_len = (size_t)(buffers[i].size() - (i == index ? offset : 0));
+					++vectorCount;
+				}
+			}
+			if (vectorCount == 0)
+			{
+				break;
+			}
+			written = writev(descriptor, vectors, vectorCount);
+			if (written < 0 && errno == EINTR)
+			{
+				continue;
+			}
+			if (written <= 0)
+			{
+				break;
+			}
+			result += written;
+			// skip everything that was written, the last buffer may have been written only partially
+			while (index < count && written >= (ssize_t)(buffers[index].size() - offset))
+			{
+				written -= buffers[index].size() - offset;
+				offset = 0;
+				++index;
+			}
+			offset += (int)written;
+		}
+		// makes stdio pick up the new position of the file descriptor
+		fseek((FILE*)file, 0, SEEK_CUR);
+#else
+		int written = 0;
+		for_iter (i, 0, count)
+		{
+			written = (int)fwrite(buffers[i].data(), 1, buffers[i].size(), (FILE*)file);
+			result += written;
+			if (written < buffers[i].size())
+			{
+				break;
+			}
+		}
+#endif
+		return result;
+	}
+
+	bool _platformFlushFile(_platformFile* file)
+	{
+		return (fflush((FILE*)file) == 0);
+	}
+
 	int64_t _platformGetFilePosition(_platformFile* file)
 	{
 		fpos_t position = 0;
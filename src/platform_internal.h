@@ -40,6 +40,8 @@ namespace hltypes
 	void _platformCloseFile(_platformFile* file);
 	int _platformReadFile(void* buffer, int elementSize, int elementCount, _platformFile* file);
 	int _platformWriteFile(const void* buffer, int elementSize, int elementCount, _platformFile* file);
+	int64_t _platformWriteFileVectored(_platformFile* file, const Span<const unsigned char>* buffers, int count);
+	bool _platformFlushFile(_platformFile* file);
 	int64_t _platformGetFilePosition(_platformFile* file);
 	bool _platformSeekFile(_platformFile* file, int64_t size, int64_t position, int64_t offset, StreamBase::SeekMode seekMode);
 	bool _platformFileExists(const String& name);
@@ -257,7 +257,7 @@ namespace hltypes
 
 		int fread(void* file, void* buffer, int count)
 		{
-			return ((FileHandle*)file)->stream->readRaw(buffer, count);
+			return (int)((FileHandle*)file)->stream->readRaw(buffer, (int64_t)count);
 		}
 
 		bool fexists(const String& filename)
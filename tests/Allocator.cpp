@@ -0,0 +1,96 @@
+#define _HTEST_LIB hltypes
+#define _HTEST_CLASS Allocator
+#include <htest/htest.h>
+
+#include "hallocator.h"
+#include "harray.h"
+#include "hdeque.h"
+#include "hlist.h"
+#include "hmap.h"
+#include "hstring.h"
+
+HTEST_SUITE_BEGIN
+
+HTEST_CASE(arena)
+{
+	harena arena(1024);
+	HTEST_ASSERT(arena.getCapacity() == 0, "");
+	void* a = arena.allocate(10, 1);
+	void* b = arena.allocate(8, 8);
+	HTEST_ASSERT(a != NULL && b != NULL, "");
+	HTEST_ASSERT(((uintptr_t)b & 7) == 0, "");
+	HTEST_ASSERT((unsigned char*)b >= (unsigned char*)a + 10, "");
+	HTEST_ASSERT(arena.getCapacity() == 1024, "");
+	void* large = arena.allocate(4000);
+	HTEST_ASSERT(large != NULL, "");
+	HTEST_ASSERT(arena.getCapacity() > 4000, "");
+	int64_t capacity = arena.getCapacity();
+	arena.reset();
+	HTEST_ASSERT(arena.getUsedSize() == 0, "");
+	HTEST_ASSERT(arena.allocate(10, 1) == a, "");
+	arena.allocate(3000);
+	HTEST_ASSERT(arena.getCapacity() == capacity, "");
+	arena.clear();
+	HTEST_ASSERT(arena.getCapacity() == 0, "");
+}
+
+HTEST_CASE(pool)
+{
+	hpool pool(12, 8, 4);
+	HTEST_ASSERT(pool.getElementSize() == 16, "");
+	void* a = pool.allocate();
+	void* b = pool.allocate();
+	HTEST_ASSERT((unsigned char*)b == (unsigned char*)a + 16, "");
+	pool.deallocate(a);
+	HTEST_ASSERT(pool.allocate() == a, "");
+	for_iter (i, 0, 10)
+	{
+		pool.allocate();
+	}
+	HTEST_ASSERT(pool.getChunkCount() == 3, "");
+	pool.clear();
+	HTEST_ASSERT(pool.getChunkCount() == 0, "");
+}
+
+HTEST_CASE(containers)
+{
+	harena arena;
+	hltypes::ArenaAllocator<int> allocator(&arena);
+	harray<int, hltypes::ArenaAllocator<int> > a(allocator);
+	for_iter (i, 0, 100)
+	{
+		a += i;
+	}
+	HTEST_ASSERT(arena.getUsedSize() > 0, "");
+	HTEST_ASSERT(a.size() == 100 && a[99] == 99, "");
+	harray<int, hltypes::ArenaAllocator<int> > b = a.sorted();
+	HTEST_ASSERT(b == a, "");
+	a.intersect(b);
+	HTEST_ASSERT(a.size() == 100, "");
+	// results that are not copies of the whole Array keep the allocator as well
+	HTEST_ASSERT(b.get_allocator() == allocator && a(10, 5).get_allocator() == allocator, "");
+	HTEST_ASSERT(a.findAll([](int const& value) { return (value % 2 == 0); }).get_allocator() == allocator, "");
+	HTEST_ASSERT(a.partialSorted(3).get_allocator() == allocator && a.random(3).get_allocator() == allocator, "");
+	HTEST_ASSERT(a.unitedSorted(b).get_allocator() == allocator && b.removeLast(2).get_allocator() == allocator, "");
+	hltypes::List<hstr, hltypes::PoolAllocator<hstr> > l;
+	l += "a";
+	l += "b";
+	l += "c";
+	l.removeAt(1);
+	HTEST_ASSERT(l.joined(",") == "a,c", "");
+	hltypes::Deque<int, hltypes::ArenaAllocator<int> > d(allocator);
+	d += 1;
+	d.addFirst(0);
+	HTEST_ASSERT(d[0] == 0 && d[1] == 1, "");
+	HTEST_ASSERT(d(0, 1).get_allocator() == allocator, "");
+	hltypes::Map<int, hstr, hltypes::PoolAllocator<std::pair<const int, hstr> > > m;
+	m[2] = "two";
+	m[1] = "one";
+	HTEST_ASSERT(m.keys().sorted()[0] == 1, "");
+	HTEST_ASSERT(m.values().joined("") == "onetwo", "");
+	m.removeKey(1);
+	HTEST_ASSERT(m.size() == 1, "");
+}
+
+HTEST_SUITE_END
+
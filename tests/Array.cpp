@@ -2,7 +2,32 @@
 #define _HTEST_CLASS Array
 #include <htest/htest.h>
 
+#include <functional>
+#include <stdint.h>
+
 #include "harray.h"
+#include "harrayparallel.h"
+#include "hlist.h"
+
+static bool isEven(int const& value)
+{
+	return (value % 2 == 0);
+}
+
+static int doubled(int const& value)
+{
+	return value * 2;
+}
+
+static void increment(int& value)
+{
+	++value;
+}
+
+static bool greater(int const& a, int const& b)
+{
+	return (a > b);
+}
 
 HTEST_SUITE_BEGIN
 
@@ -114,6 +139,146 @@ HTEST_CASE(adding3)
 	HTEST_ASSERT(b[4] == a[1], "");
 }
 
+HTEST_CASE(moving)
+{
+	harray<hstr> a;
+	hstr text = "test";
+	a.add(hstr("first"));
+	a.add(text);
+	a += hstr("third");
+	a.addFirst(hstr("zero"));
+	a.insertAt(2, hstr("between"));
+	HTEST_ASSERT(a.size() == 5, "");
+	HTEST_ASSERT(a[0] == "zero", "");
+	HTEST_ASSERT(a[1] == "first", "");
+	HTEST_ASSERT(a[2] == "between", "");
+	HTEST_ASSERT(a[3] == "test", "");
+	HTEST_ASSERT(a[4] == "third", "");
+	HTEST_ASSERT(a.emplace('x', 3) == "xxx", "");
+	HTEST_ASSERT(a.emplaceAt(0, "y") == "y", "");
+	HTEST_ASSERT(a.size() == 7, "");
+	HTEST_ASSERT(a.first() == "y", "");
+	HTEST_ASSERT(a.last() == "xxx", "");
+	hstr removed = a.removeAt(1);
+	HTEST_ASSERT(removed == "zero", "");
+	HTEST_ASSERT(a.removeFirst() == "y", "");
+	HTEST_ASSERT(a.removeLast() == "xxx", "");
+	harray<hstr> b = a.removeAt(1, 2);
+	HTEST_ASSERT(b.size() == 2, "");
+	HTEST_ASSERT(b[0] == "between", "");
+	HTEST_ASSERT(b[1] == "test", "");
+	HTEST_ASSERT(a.size() == 2, "");
+	harray<hstr> c;
+	c.add(std::move(b));
+	HTEST_ASSERT(b.size() == 0, "");
+	HTEST_ASSERT(c.size() == 2, "");
+	HTEST_ASSERT(c[0] == "between", "");
+	c.addFirst(std::move(a));
+	HTEST_ASSERT(a.size() == 0, "");
+	HTEST_ASSERT(c.size() == 4, "");
+	HTEST_ASSERT(c[0] == "first", "");
+	HTEST_ASSERT(c[3] == "test", "");
+	harray<hstr> d(std::move(c));
+	HTEST_ASSERT(c.size() == 0, "");
+	HTEST_ASSERT(d.size() == 4, "");
+	c = std::move(d);
+	HTEST_ASSERT(d.size() == 0, "");
+	HTEST_ASSERT(c.size() == 4, "");
+}
+
+HTEST_CASE(parallel)
+{
+	harray<int> a;
+	for (int i = 0; i < 100000; ++i)
+	{
+		a += (i * 7919) % 100000;
+	}
+	harray<int> b = a;
+	hltypes::parallelSort(b, 100);
+	HTEST_ASSERT(b == a.sorted(), "parallelSort()");
+	b = a;
+	hltypes::parallelSort(b, &greater, 100);
+	HTEST_ASSERT(b == a.sorted(&greater), "parallelSort(compareFunction)");
+	HTEST_ASSERT(hltypes::parallelMapped(a, &doubled, 100) == a.mapped(&doubled), "parallelMapped()");
+	HTEST_ASSERT(hltypes::parallelFindAll(a, &isEven, 100) == a.findAll(&isEven), "parallelFindAll()");
+	HTEST_ASSERT(hltypes::parallelCount(a, &isEven, 100) == a.count(&isEven), "parallelCount()");
+	b = a;
+	hltypes::parallelEach(b, &increment, 100);
+	bool incremented = true;
+	for (int i = 0; i < a.size(); ++i)
+	{
+		incremented = (incremented && b[i] == a[i] + 1);
+	}
+	HTEST_ASSERT(incremented, "parallelEach()");
+	harray<int> c;
+	c += 3;
+	c += 1;
+	hltypes::parallelSort(c);
+	HTEST_ASSERT(c[0] == 1 && c[1] == 3, "serial fallback");
+}
+
+HTEST_CASE(arithmetic)
+{
+	harray<int> a;
+	harray<float> f;
+	harray<unsigned char> c;
+	for (int i = 0; i < 1000; ++i)
+	{
+		a += i % 37 - 18;
+		f += (float)(i % 37) * 0.5f - 9.0f;
+		c += (unsigned char)(i % 251);
+	}
+	a[777] = 5000;
+	a[3] = -5000;
+	HTEST_ASSERT(a.indexOf(5000) == 777, "");
+	HTEST_ASSERT(a.indexOf(6000) == -1, "");
+	HTEST_ASSERT(a.has(-5000), "");
+	HTEST_ASSERT(a.count(0) == 27, "");
+	HTEST_ASSERT(a.min() == -5000, "");
+	HTEST_ASSERT(a.max() == 5000, "");
+	HTEST_ASSERT(a.minmax().first == -5000 && a.minmax().second == 5000, "");
+	HTEST_ASSERT(f.indexOf(-9.0f) == 0, "");
+	HTEST_ASSERT(f.count(0.0f) == 27, "");
+	HTEST_ASSERT(f.min() == -9.0f && f.max() == 9.0f, "");
+	HTEST_ASSERT(c.indexOf(250) == 250, "");
+	HTEST_ASSERT(c.count(7) == 4, "");
+	HTEST_ASSERT(c.max() == 250, "");
+	HTEST_ASSERT(c.sum() == 124506, "");
+	harray<int> b = a;
+	HTEST_ASSERT(a == b, "");
+	b[999] = 1;
+	HTEST_ASSERT(a != b, "");
+	harray<float> g;
+	g += 0.0f;
+	harray<float> h;
+	h += -0.0f;
+	HTEST_ASSERT(g == h, "");
+	harray<int> s;
+	HTEST_ASSERT(s.sum() == 0, "");
+	s += 2000000000;
+	s += 2000000000;
+	HTEST_ASSERT(s.sum() == (int64_t)4000000000LL, "");
+	double sum = 0.0;
+	for (int i = 0; i < f.size(); ++i)
+	{
+		sum += f[i];
+	}
+	HTEST_ASSERT(hround(f.sum() * 2) == hround(sum * 2), "");
+}
+
+HTEST_CASE(capacity)
+{
+	harray<int> a;
+	a.reserve(100);
+	HTEST_ASSERT(a.capacity() >= 100, "");
+	HTEST_ASSERT(a.size() == 0, "");
+	a.add(1);
+	a.add(2);
+	a.shrinkToFit();
+	HTEST_ASSERT(a.capacity() >= 2, "");
+	HTEST_ASSERT(a.size() == 2, "");
+}
+
 HTEST_CASE(removing1)
 {
 	harray<int> a;
@@ -384,6 +549,50 @@ HTEST_CASE(difference)
 	HTEST_ASSERT((a1 / a2).size() == 0, "");
 }
 
+HTEST_CASE(sortedOperations)
+{
+	harray<int> a;
+	a << 1 << 3 << 3 << 5 << 7;
+	HTEST_ASSERT(a.binarySearch(3) == 1, "");
+	HTEST_ASSERT(a.binarySearch(4) == -1, "");
+	HTEST_ASSERT(a.binarySearch(8) == -1, "");
+	HTEST_ASSERT(a.lowerBound(3) == 1 && a.upperBound(3) == 3, "");
+	HTEST_ASSERT(a.lowerBound(0) == 0 && a.upperBound(7) == 5, "");
+	HTEST_ASSERT(a.insertSorted(4) == 3, "");
+	HTEST_ASSERT(a.insertSorted(0) == 0, "");
+	HTEST_ASSERT(a.insertSorted(9) == 7, "");
+	HTEST_ASSERT(a == (harray<int>() << 0 << 1 << 3 << 3 << 4 << 5 << 7 << 9), "");
+	harray<int> b;
+	b << 2 << 3 << 8;
+	HTEST_ASSERT(a.mergedSorted(b) == (harray<int>() << 0 << 1 << 2 << 3 << 3 << 3 << 4 << 5 << 7 << 8 << 9), "");
+	HTEST_ASSERT(a.unitedSorted(b) == a.united(b).sorted(), "");
+	HTEST_ASSERT(a.intersectedSorted(b) == a.intersected(b), "");
+	HTEST_ASSERT(b.intersectedSorted(a) == b.intersected(a), "");
+	harray<int> c = a;
+	c.uniteSorted(harray<int>());
+	HTEST_ASSERT(c == (harray<int>() << 0 << 1 << 3 << 4 << 5 << 7 << 9), "");
+	c.intersectSorted(b);
+	HTEST_ASSERT(c == harray<int>(3), "");
+	c.mergeSorted(b);
+	HTEST_ASSERT(c == (harray<int>() << 2 << 3 << 3 << 8), "");
+	harray<int> d;
+	d << 9 << 5 << 5 << 1;
+	HTEST_ASSERT(d.binarySearch(5, &greater) == 1, "");
+	HTEST_ASSERT(d.insertSorted(6, &greater) == 1, "");
+	HTEST_ASSERT(d.unitedSorted(harray<int>() << 8 << 5, &greater) == (harray<int>() << 9 << 8 << 6 << 5 << 1), "");
+	HTEST_ASSERT(harray<int>().binarySearch(1) == -1, "");
+	auto descending = [](int const& x, int const& y) { return (x > y); };
+	HTEST_ASSERT(d.binarySearch(5, descending) == 2 && d.lowerBound(5, descending) == 2 && d.upperBound(5, descending) == 4, "");
+	HTEST_ASSERT(d.insertSorted(7, descending) == 1, "");
+	harray<int> e;
+	e << 8 << 7 << 2;
+	HTEST_ASSERT(d.mergedSorted(e, descending) == (harray<int>() << 9 << 8 << 7 << 7 << 6 << 5 << 5 << 2 << 1), "");
+	HTEST_ASSERT(d.unitedSorted(e, descending) == (harray<int>() << 9 << 8 << 7 << 6 << 5 << 2 << 1), "");
+	HTEST_ASSERT(d.intersectedSorted(e, std::greater<int>()) == harray<int>(7), "");
+	d.mergeSorted(e, descending);
+	HTEST_ASSERT(d == (harray<int>() << 9 << 8 << 7 << 7 << 6 << 5 << 5 << 2 << 1), "");
+}
+
 HTEST_CASE(random)
 {
 	harray<int> a;
@@ -426,6 +635,24 @@ HTEST_CASE(join)
 	HTEST_ASSERT(b == "0212223", "");
 	b = a.joined(1.5f);
 	HTEST_ASSERT(b == "01.511.521.53", "");
+	harray<hstr> strings;
+	strings << "data/a.png" << "" << "data/b.png";
+	HTEST_ASSERT(strings.joined("\n") == "data/a.png\n\ndata/b.png", "");
+	HTEST_ASSERT(strings.joined("") == "data/a.pngdata/b.png", "");
+	HTEST_ASSERT(harray<hstr>().joined(",") == "", "");
+	harray<int64_t> numbers;
+	numbers << (int64_t)0 << (int64_t)-42 << (int64_t)INT64_MIN << (int64_t)INT64_MAX;
+	HTEST_ASSERT(numbers.joined(", ") == hstr(numbers[0]) + ", -42, " + hstr(numbers[2]) + ", " + hstr(numbers[3]), "");
+	harray<unsigned int> unsignedNumbers(4294967295U, 2);
+	HTEST_ASSERT(unsignedNumbers.joined(" ") == "4294967295 4294967295", "");
+	harray<double> doubles;
+	doubles << 0.0 << -2.5 << 100.0 << 0.125 << 1e20;
+	HTEST_ASSERT(doubles.joined(";") == "0;-2.5;100;0.125;" + hstr(1e20), "");
+	harray<float> floats(0.1f, 2);
+	HTEST_ASSERT(floats.joined(",") == hstr(0.1f) + "," + hstr(0.1f), "");
+	hlist<int> list;
+	list << 1 << 2;
+	HTEST_ASSERT(list.joined("+") == "1+2", "");
 }
 
 static bool negative(int const& i) { return (i < 0); }
@@ -0,0 +1,137 @@
+#define _HTEST_LIB hltypes
+#define _HTEST_CLASS BitArray
+#include <htest/htest.h>
+
+#include "harray.h"
+#include "hbitarray.h"
+#include "hstream.h"
+
+HTEST_SUITE_BEGIN
+
+HTEST_CASE(bits)
+{
+	hbitarray a(130);
+	HTEST_ASSERT(a.size() == 130, "");
+	HTEST_ASSERT(a.wordCount() == 3, "");
+	HTEST_ASSERT(a.none(), "");
+	a.set(0);
+	a.set(64);
+	a.set(129);
+	HTEST_ASSERT(a.test(0) && a[64] && a.test(129), "");
+	HTEST_ASSERT(!a.test(1) && !a.test(63), "");
+	HTEST_ASSERT(a.count() == 3, "");
+	a.reset(64);
+	HTEST_ASSERT(!a.test(64) && a.count() == 2, "");
+	a.flip(5);
+	HTEST_ASSERT(a.test(5), "");
+	a.set();
+	HTEST_ASSERT(a.all() && a.count() == 130, "");
+	a.flip();
+	HTEST_ASSERT(a.none(), "");
+	a.set(60, 10, true);
+	HTEST_ASSERT(a.count() == 10 && a.test(60) && a.test(69) && !a.test(59) && !a.test(70), "");
+	a.set(62, 4, false);
+	HTEST_ASSERT(a.count() == 6 && !a.test(63) && !a.test(64) && a.test(66), "");
+	a.resize(200, true);
+	HTEST_ASSERT(a.count() == 76 && a.test(130) && a.test(199), "");
+	a.add(false);
+	a.add(true);
+	HTEST_ASSERT(a.size() == 202 && a.test(201) && !a.test(200), "");
+	try
+	{
+		a.test(202);
+		HTEST_FAIL("test() out of bounds didn't throw an exception");
+	}
+	catch (hexception&)
+	{
+	}
+}
+
+HTEST_CASE(search)
+{
+	hbitarray a(1000);
+	HTEST_ASSERT(a.findFirst() == -1, "");
+	a.set(3);
+	a.set(64);
+	a.set(999);
+	HTEST_ASSERT(a.findFirst() == 3, "");
+	HTEST_ASSERT(a.findNext(4) == 64, "");
+	HTEST_ASSERT(a.findNext(65) == 999, "");
+	HTEST_ASSERT(a.findNext(1000) == -1, "");
+	harray<int> indices = a.indices();
+	HTEST_ASSERT(indices.size() == 3 && indices[0] == 3 && indices[1] == 64 && indices[2] == 999, "");
+}
+
+HTEST_CASE(operators)
+{
+	hbitarray a(70);
+	hbitarray b(70);
+	a.set(1);
+	a.set(65);
+	b.set(65);
+	b.set(69);
+	HTEST_ASSERT((a & b).indices() == harray<int>(65), "");
+	HTEST_ASSERT((a | b).count() == 3, "");
+	hbitarray c = a ^ b;
+	HTEST_ASSERT(c.count() == 2 && c.test(1) && c.test(69), "");
+	HTEST_ASSERT((~a).count() == 68, "");
+	HTEST_ASSERT(a != b, "");
+	b ^= c;
+	HTEST_ASSERT(a == b, "");
+	try
+	{
+		a &= hbitarray(71);
+		HTEST_FAIL("&= with a different size didn't throw an exception");
+	}
+	catch (hexception&)
+	{
+	}
+}
+
+HTEST_CASE(serialization)
+{
+	hbitarray a(150);
+	for (int i = 0; i < 150; i += 7)
+	{
+		a.set(i);
+	}
+	hstream stream;
+	stream.dump(a);
+	stream.dump(hbitarray());
+	stream.rewind();
+	hbitarray b = stream.loadBitArray();
+	HTEST_ASSERT(a == b, "");
+	HTEST_ASSERT(stream.loadBitArray().size() == 0, "");
+	HTEST_ASSERT(stream.eof(), "");
+	// a corrupted size must fail before anything is allocated
+	stream.clear();
+	stream.dump(0x7FFFFFFF);
+	stream.dump(1);
+	stream.rewind();
+	bool thrown = false;
+	try
+	{
+		stream.loadBitArray();
+	}
+	catch (hexception&)
+	{
+		thrown = true;
+	}
+	HTEST_ASSERT(thrown && stream.position() == 4, "size larger than the remaining data");
+	stream.clear();
+	stream.dump(-1);
+	stream.rewind();
+	thrown = false;
+	try
+	{
+		stream.loadBitArray();
+	}
+	catch (hexception&)
+	{
+		thrown = true;
+	}
+	HTEST_ASSERT(thrown, "negative size");
+}
+
+HTEST_SUITE_END
+
@@ -0,0 +1,140 @@
+#define _HTEST_LIB hltypes
+#define _HTEST_CLASS ConcurrentQueue
+#include <htest/htest.h>
+
+#include "hconcurrentqueue.h"
+#include "hmutex.h"
+#include "hstring.h"
+#include "hthread.h"
+
+#define PRODUCER_COUNT 3
+#define CONSUMER_COUNT 3
+#define TRANSFER_COUNT 30000
+
+static hconcurrentqueue<int>* queue = NULL;
+static int64_t consumedSum = 0;
+static int consumedCount = 0;
+static hmutex consumedMutex;
+static int finishedThreads = 0;
+
+// Thread::join() skips the function of a thread that has not started executing yet so threads are joined only after they finished
+static void waitForThreads(int count)
+{
+	hmutex::ScopeLock lock;
+	while (true)
+	{
+		lock.acquire(&consumedMutex);
+		bool finished = (finishedThreads >= count);
+		lock.release();
+		if (finished)
+		{
+			break;
+		}
+		hthread::sleep(1.0f);
+	}
+}
+
+static void produce(hthread* thread)
+{
+	int batch[4];
+	for (int value = 1; value <= TRANSFER_COUNT; value += 4)
+	{
+		int count = hmin(4, TRANSFER_COUNT - value + 1);
+		for_iter (i, 0, count)
+		{
+			batch[i] = value + i;
+		}
+		queue->push(batch, count);
+	}
+	hmutex::ScopeLock lock(&consumedMutex);
+	++finishedThreads;
+}
+
+static void consume(hthread* thread)
+{
+	int64_t sum = 0;
+	int count = 0;
+	int value = 0;
+	while (true)
+	{
+		value = queue->pop();
+		if (value == 0)
+		{
+			break;
+		}
+		sum += value;
+		++count;
+	}
+	hmutex::ScopeLock lock(&consumedMutex);
+	consumedSum += sum;
+	consumedCount += count;
+	++finishedThreads;
+}
+
+HTEST_SUITE_BEGIN
+
+HTEST_CASE(basic)
+{
+	hconcurrentqueue<hstr> a(2);
+	HTEST_ASSERT(a.capacity() == 2, "");
+	HTEST_ASSERT(a.tryPush("a"), "");
+	HTEST_ASSERT(a.tryPush("b"), "");
+	HTEST_ASSERT(!a.tryPush("c"), "");
+	HTEST_ASSERT(a.size() == 2, "");
+	hstr value;
+	HTEST_ASSERT(a.tryPop(value) && value == "a", "");
+	HTEST_ASSERT(a.pop() == "b", "");
+	HTEST_ASSERT(!a.tryPop(value), "");
+	hstr values[3] = { "x", "y", "z" };
+	HTEST_ASSERT(a.tryPush(values, 3) == 2, "");
+	hstr result[3];
+	HTEST_ASSERT(a.tryPop(result, 3) == 2, "");
+	HTEST_ASSERT(result[0] == "x" && result[1] == "y", "");
+	HTEST_ASSERT(a.isEmpty(), "");
+	a.push("left over");
+}
+
+HTEST_CASE(threads)
+{
+	queue = new hconcurrentqueue<int>(128);
+	consumedSum = 0;
+	consumedCount = 0;
+	finishedThreads = 0;
+	hthread* producers[PRODUCER_COUNT];
+	hthread* consumers[CONSUMER_COUNT];
+	for_iter (i, 0, CONSUMER_COUNT)
+	{
+		consumers[i] = new hthread(&consume, "consumer");
+		consumers[i]->start();
+	}
+	for_iter (i, 0, PRODUCER_COUNT)
+	{
+		producers[i] = new hthread(&produce, "producer");
+		producers[i]->start();
+	}
+	waitForThreads(PRODUCER_COUNT);
+	for_iter (i, 0, PRODUCER_COUNT)
+	{
+		producers[i]->join();
+		delete producers[i];
+	}
+	// every consumer stops after receiving a 0
+	for_iter (i, 0, CONSUMER_COUNT)
+	{
+		queue->push(0);
+	}
+	waitForThreads(PRODUCER_COUNT + CONSUMER_COUNT);
+	for_iter (i, 0, CONSUMER_COUNT)
+	{
+		consumers[i]->join();
+		delete consumers[i];
+	}
+	HTEST_ASSERT(consumedCount == PRODUCER_COUNT * TRANSFER_COUNT, "");
+	HTEST_ASSERT(consumedSum == (int64_t)PRODUCER_COUNT * TRANSFER_COUNT * (TRANSFER_COUNT + 1) / 2, "");
+	HTEST_ASSERT(queue->isEmpty(), "");
+	delete queue;
+	queue = NULL;
+}
+
+HTEST_SUITE_END
+
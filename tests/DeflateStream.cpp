@@ -0,0 +1,177 @@
+#define _HTEST_LIB hltypes
+#define _HTEST_CLASS DeflateStream
+#include <htest/htest.h>
+
+#ifdef _ZIPRESOURCE
+#include <string.h>
+
+#include "harray.h"
+#include "hdeflatestream.h"
+#include "hexception.h"
+#include "hinflatestream.h"
+#include "hspan.h"
+#include "hstream.h"
+#include "hstreamview.h"
+#include "hstring.h"
+
+static hstream createData(int size)
+{
+	hstream result(size);
+	for_iter (i, 0, size)
+	{
+		result.dump((unsigned char)((i / 7) % 50 + (i % 3 == 0 ? i % 11 : 0)));
+	}
+	result.rewind();
+	return result;
+}
+
+HTEST_SUITE_BEGIN
+
+HTEST_CASE(formats)
+{
+	hstream data = createData(200000);
+	harray<hdeflatestream::Format> formats;
+	formats += hdeflatestream::Format::Zlib;
+	formats += hdeflatestream::Format::Gzip;
+	formats += hdeflatestream::Format::Raw;
+	foreach (hdeflatestream::Format, it, formats)
+	{
+		hstream compressed;
+		{
+			hdeflatestream deflate(compressed, (*it), 6, hdeflatestream::Strategy::Default, 256);
+			for (int64_t i = 0; i < data.size(); i += 3000)
+			{
+				deflate.writeRaw(hspan<const unsigned char>(&data[(int)i], (int)hmin(data.size() - i, (int64_t)3000)));
+			}
+			HTEST_ASSERT(deflate.size() == data.size() && deflate.position() == data.size(), "");
+		}
+		HTEST_ASSERT(compressed.size() < data.size() / 4, "");
+		compressed.dump(1234);
+		compressed.rewind();
+		hinflatestream inflate(compressed, (*it), 100);
+		harray<unsigned char> result((unsigned char)0, (int)data.size() + 100);
+		HTEST_ASSERT(inflate.readRaw(&result[0], result.size()) == data.size() && memcmp(&result[0], &data[0], (size_t)data.size()) == 0, "");
+		HTEST_ASSERT(inflate.eof() && inflate.size() == data.size(), "");
+		HTEST_ASSERT(compressed.loadInt32() == 1234, "other stream is positioned right after the compressed data");
+	}
+}
+
+HTEST_CASE(gzipFraming)
+{
+	hstream data = createData(1000);
+	hstream compressed;
+	hdeflatestream deflate(compressed, hdeflatestream::Format::Gzip, 9, hdeflatestream::Strategy::Rle);
+	deflate.writeRaw(data);
+	deflate.finish();
+	HTEST_ASSERT(!deflate.isOpen() && compressed[0] == 0x1F && compressed[1] == 0x8B && deflate.getCompressedSize() == compressed.size(), "");
+	compressed.seek(-6, hseek::End);
+	unsigned char c = compressed.loadUint8();
+	compressed.seek(-1);
+	compressed.dump((unsigned char)(c ^ 0xFF));
+	compressed.rewind();
+	hinflatestream inflate(compressed, hdeflatestream::Format::Gzip);
+	try
+	{
+		inflate.read(2000);
+		HTEST_ASSERT(false, "a wrong checksum should throw an exception");
+	}
+	catch (hexception&)
+	{
+	}
+}
+
+HTEST_CASE(seekRestart)
+{
+	hstream data = createData(200000);
+	hstream compressed;
+	{
+		hdeflatestream deflate(compressed);
+		deflate.writeRaw(data);
+	}
+	compressed.rewind();
+	hinflatestream inflate(compressed, hdeflatestream::Format::Zlib, 512);
+	inflate.seek(150000, hseek::Start);
+	HTEST_ASSERT(inflate.position() == 150000 && inflate.loadUint8() == data[150000], "seeking forward skips data");
+	inflate.seek(-20001);
+	HTEST_ASSERT(inflate.position() == 130000 && inflate.loadUint8() == data[130000], "seeking backward uses the history");
+	unsigned char raw[30000] = { 0 };
+	HTEST_ASSERT(inflate.readRaw(raw, (int64_t)30000) == 30000 && memcmp(raw, &data[130001], 30000) == 0, "reading across the end of the history");
+	inflate.seek(10000, hseek::Start);
+	HTEST_ASSERT(inflate.position() == 10000 && inflate.loadUint8() == data[10000], "seeking backward further restarts");
+	inflate.seek(-5, hseek::End);
+	HTEST_ASSERT(inflate.size() == data.size() && inflate.position() == data.size() - 5 && inflate.loadUint8() == data[(int)data.size() - 5], "");
+}
+
+HTEST_CASE(readLines)
+{
+	hstream text;
+	for_iter (i, 0, 5000)
+	{
+		text.writeLine(hsprintf("line %d", i));
+	}
+	text.rewind();
+	hstream compressed;
+	{
+		hdeflatestream deflate(compressed, hdeflatestream::Format::Gzip);
+		deflate.writeRaw(text);
+	}
+	compressed.rewind();
+	hinflatestream inflate(compressed, hdeflatestream::Format::Gzip);
+	int count = 0;
+	bool correct = true;
+	while (!inflate.eof())
+	{
+		correct = (correct && inflate.readLine() == hsprintf("line %d", count));
+		++count;
+	}
+	HTEST_ASSERT(correct && count == 5000 && inflate.size() == text.size(), "reading ahead and seeking back does not decompress everything again");
+}
+
+HTEST_CASE(flush)
+{
+	hstream compressed;
+	hdeflatestream deflate(compressed, hdeflatestream::Format::Zlib, 0);
+	deflate.write("first part");
+	deflate.flush();
+	hstream partial;
+	compressed.rewind();
+	partial.writeRaw(compressed);
+	compressed.seek(0, hseek::End);
+	partial.rewind();
+	hinflatestream inflate(partial);
+	HTEST_ASSERT(inflate.read(10) == "first part", "flushed data can be decompressed");
+	deflate.write(" and the rest");
+	deflate.finish();
+	compressed.rewind();
+	hinflatestream complete(compressed);
+	HTEST_ASSERT(complete.read() == "first part and the rest", "");
+}
+
+HTEST_CASE(finishError)
+{
+	unsigned char raw[4] = { 0 };
+	hstreamview readOnly(raw);
+	{
+		// the destructor only logs the error
+		hdeflatestream deflate(readOnly, hdeflatestream::Format::Raw);
+		deflate.write("data");
+	}
+	hdeflatestream deflate(readOnly, hdeflatestream::Format::Raw);
+	bool thrown = false;
+	try
+	{
+		deflate.write("data");
+		deflate.finish();
+	}
+	catch (hexception&)
+	{
+		thrown = true;
+	}
+	HTEST_ASSERT(thrown && !deflate.isOpen(), "finish() reports errors and closes the stream");
+}
+
+HTEST_SUITE_END
+#else
+HTEST_SUITE_BEGIN
+HTEST_SUITE_END
+#endif
@@ -0,0 +1,85 @@
+#define _HTEST_LIB hltypes
+#define _HTEST_CLASS Enumeration
+#include <htest/htest.h>
+
+#include "henum.h"
+#include "hstring.h"
+
+HL_ENUM_CLASS_DECLARE(Dense,
+(
+	HL_ENUM_DECLARE(Dense, A);
+	HL_ENUM_DECLARE(Dense, B);
+	HL_ENUM_DECLARE(Dense, C);
+	HL_ENUM_DECLARE(Dense, D);
+));
+HL_ENUM_CLASS_DEFINE(Dense,
+(
+	HL_ENUM_DEFINE(Dense, A);
+	HL_ENUM_DEFINE_VALUE(Dense, C, 2);
+	HL_ENUM_DEFINE_VALUE(Dense, B, 1);
+	HL_ENUM_DEFINE_NAME(Dense, D, "Delta");
+));
+
+HL_ENUM_CLASS_DECLARE(Sparse,
+(
+	HL_ENUM_DECLARE(Sparse, Low);
+	HL_ENUM_DECLARE(Sparse, Middle);
+	HL_ENUM_DECLARE(Sparse, High);
+	HL_ENUM_DECLARE(Sparse, Alias);
+));
+HL_ENUM_CLASS_DEFINE_LOOSE(Sparse, 5,
+(
+	HL_ENUM_DEFINE_VALUE(Sparse, High, 0xFFFFFFF0);
+	HL_ENUM_DEFINE_VALUE(Sparse, Low, 5);
+	HL_ENUM_DEFINE_VALUE(Sparse, Middle, 100000);
+	HL_ENUM_DEFINE_NAME_VALUE(Sparse, Alias, "High", 200000);
+));
+
+HTEST_SUITE_BEGIN
+
+HTEST_CASE(dense)
+{
+	HTEST_ASSERT(Dense::getCount() == 4, "");
+	HTEST_ASSERT(Dense::A.value == 0 && Dense::B.value == 1 && Dense::C.value == 2 && Dense::D.value == 3, "");
+	HTEST_ASSERT(Dense::A.next() == Dense::B && Dense::D.next() == Dense::A, "");
+	HTEST_ASSERT(Dense::A.previous() == Dense::D && Dense::C.previous() == Dense::B, "");
+	HTEST_ASSERT(Dense::fromUint(2) == Dense::C && Dense::fromInt(3) == Dense::D, "");
+	HTEST_ASSERT(Dense::fromName("B") == Dense::B && Dense::fromName("Delta") == Dense::D, "");
+	HTEST_ASSERT(Dense::D.getName() == "Delta" && Dense::hasValue("C") && !Dense::hasValue("D"), "");
+	HTEST_ASSERT(Dense::hasValueFor(3) && !Dense::hasValueFor(4) && !Dense::hasValueFor(-1), "");
+	harray<Dense> values = Dense::getValues();
+	HTEST_ASSERT(values.size() == 4 && values[0] == Dense::A && values[3] == Dense::D, "");
+	HTEST_ASSERT(Dense::getAsMap().size() == 4 && Dense::getAsMap()[1] == "B", "");
+	try
+	{
+		Dense::fromUint(4);
+		HTEST_FAIL("fromUint() with invalid value didn't throw an exception");
+	}
+	catch (hexception&)
+	{
+	}
+	try
+	{
+		Dense::fromName("E");
+		HTEST_FAIL("fromName() with invalid name didn't throw an exception");
+	}
+	catch (hexception&)
+	{
+	}
+}
+
+HTEST_CASE(sparse)
+{
+	HTEST_ASSERT(Sparse::getCount() == 4, "");
+	HTEST_ASSERT(Sparse::Low.next() == Sparse::Middle && Sparse::Middle.next() == Sparse::Alias, "");
+	HTEST_ASSERT(Sparse::High.next() == Sparse::Low && Sparse::Low.previous() == Sparse::High, "");
+	HTEST_ASSERT(Sparse::fromUint(100000) == Sparse::Middle && Sparse::fromUint(0xFFFFFFF0) == Sparse::High, "");
+	// loose enums fall back to the default value
+	HTEST_ASSERT(Sparse::fromUint(7) == Sparse::Low && Sparse::fromName("None") == Sparse::Low, "");
+	// the lowest value is used if a name is used more than once
+	HTEST_ASSERT(Sparse::fromName("High") == Sparse::Alias && Sparse::High.getName() == "High", "");
+	HTEST_ASSERT(Sparse::fromName("Middle") == Sparse::Middle && Sparse::hasValueFor(200000U), "");
+}
+
+HTEST_SUITE_END
+
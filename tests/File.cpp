@@ -155,6 +155,99 @@ HTEST_CASE_WITH_DATA(serialization)
 	HTEST_ASSERT(d == 1.23456789999999, "double");
 	HTEST_ASSERT(!b, "bool");
 }
+
+HTEST_CASE_WITH_DATA(writeBuffer)
+{
+	hstr filename = tempDir + "/test.txt";
+	hfile f;
+	f.setWriteBufferSize(64);
+	f.open(filename, hfaccess::ReadWriteCreate);
+	for_iter (i, 0, 100)
+	{
+		f.dump(i);
+	}
+	HTEST_ASSERT(f.size() == 400 && f.position() == 400, "size() and position() include buffered data");
+	HTEST_ASSERT(f.flush() && hfile::hinfo(filename).size == 400, "flush()");
+	f.seek(8, hseek::Start);
+	f.dump(1000);
+	f.dump(hstr('a', 100));
+	HTEST_ASSERT(f.size() == 400 && f.position() == 116, "");
+	f.rewind();
+	HTEST_ASSERT(f.loadInt32() == 0 && f.loadInt32() == 1 && f.loadInt32() == 1000, "reading writes buffered data first");
+	f.seek(0, hseek::End);
+	f.dump(-1);
+	f.close();
+	HTEST_ASSERT(hfile::hinfo(filename).size == 404, "close() writes buffered data");
+	f.open(filename, hfaccess::Append);
+	f.write("end");
+	HTEST_ASSERT(f.size() == 407 && f.position() == 407, "");
+	f.setWriteBufferSize(0);
+	HTEST_ASSERT(f.getWriteBufferSize() == 0 && f.flush() && hfile::hinfo(filename).size == 407, "");
+	f.write("!");
+	f.close();
+	f.open(filename);
+	f.seek(-8, hseek::End);
+	HTEST_ASSERT(f.loadInt32() == -1 && f.read() == "end!", "");
+	f.close();
+	hfile::remove(filename);
+}
+#ifdef __linux__
+HTEST_CASE(writeBufferFailure)
+{
+	// every write to /dev/full fails because the device has no space left
+	hfile f;
+	f.setWriteBufferSize(65536);
+	f.open("/dev/full", hfaccess::Write);
+	unsigned char data[60000] = { 0 };
+	HTEST_ASSERT(f.writeRaw(data, (int64_t)60000) == 60000, "the data is only buffered");
+	bool thrown = false;
+	try
+	{
+		f.flush();
+	}
+	catch (hexception&)
+	{
+		thrown = true;
+	}
+	HTEST_ASSERT(thrown && f.position() == 60000, "flush() failed and the data is still buffered");
+	thrown = false;
+	try
+	{
+		f.close();
+	}
+	catch (hexception&)
+	{
+		thrown = true;
+	}
+	HTEST_ASSERT(thrown && !f.isOpen(), "close() reported the lost data and closed the file");
+}
+#endif
+
+HTEST_CASE_WITH_DATA(readAfterWrite)
+{
+	hstr filename = tempDir + "/test.txt";
+	hfile f;
+	f.open(filename, hfaccess::ReadWriteCreate);
+	for_iter (i, 0, 4)
+	{
+		f.dump(i);
+	}
+	f.rewind();
+	f.dump(10);
+	HTEST_ASSERT(f.loadInt32() == 1, "read directly after a buffered write");
+	f.dump(11);
+	HTEST_ASSERT(f.loadInt32() == 3, "");
+	f.setWriteBufferSize(0);
+	f.rewind();
+	HTEST_ASSERT(f.loadInt32() == 10, "");
+	f.dump(12);
+	HTEST_ASSERT(f.loadInt32() == 11, "read directly after an unbuffered write");
+	f.close();
+	f.open(filename);
+	HTEST_ASSERT(f.loadInt32() == 10 && f.loadInt32() == 12 && f.loadInt32() == 11 && f.loadInt32() == 3 && f.eof(), "");
+	f.close();
+	hfile::remove(filename);
+}
 HTEST_CASE_WITH_DATA(staticClear)
 {
 	hstr filename = tempDir + "/test.txt";
@@ -113,6 +113,26 @@ HTEST_CASE(adding3)
 	HTEST_ASSERT(b[4] == a[1], "");
 }
 
+HTEST_CASE(moving)
+{
+	hlist<hstr> a;
+	a.add(hstr("first"));
+	a += hstr("second");
+	a.addFirst(hstr("zero"));
+	HTEST_ASSERT(a.emplace('x', 2) == "xx", "");
+	HTEST_ASSERT(a.emplaceAt(1, "y") == "y", "");
+	HTEST_ASSERT(a.size() == 5, "");
+	HTEST_ASSERT(a[0] == "zero", "");
+	HTEST_ASSERT(a[1] == "y", "");
+	HTEST_ASSERT(a[2] == "first", "");
+	HTEST_ASSERT(a.removeLast() == "xx", "");
+	hlist<hstr> b;
+	b.add(std::move(a));
+	HTEST_ASSERT(a.size() == 0, "");
+	HTEST_ASSERT(b.size() == 4, "");
+	HTEST_ASSERT(b.removeFirst() == "zero", "");
+}
+
 HTEST_CASE(removing1)
 {
 	hlist<int> a;
@@ -179,6 +199,31 @@ HTEST_CASE(removing2)
 	HTEST_ASSERT(a == b, "");
 }
 
+HTEST_CASE(removing3)
+{
+	hlist<int> a;
+	a += 3;
+	a += 1;
+	a += 3;
+	a += 2;
+	a += 1;
+	a += 3;
+	HTEST_ASSERT(a.removeAt(-1) == 3, "");
+	a += 3;
+	a.removeDuplicates();
+	HTEST_ASSERT(a.size() == 3, "");
+	HTEST_ASSERT(a[0] == 3 && a[1] == 1 && a[2] == 2, "");
+	a += 1;
+	a += 3;
+	hlist<int> b;
+	b += 3;
+	b += 2;
+	HTEST_ASSERT(a.removeAll(b) == 3, "");
+	HTEST_ASSERT(a.size() == 2 && a[0] == 1 && a[1] == 1, "");
+	HTEST_ASSERT(a.removeAll(a) == 2, "");
+	HTEST_ASSERT(a.size() == 0, "");
+}
+
 HTEST_CASE(container)
 {
 	hlist<int> a;
@@ -0,0 +1,83 @@
+#define _HTEST_LIB hltypes
+#define _HTEST_CLASS MappedFile
+#include <htest/htest.h>
+
+#include "hexception.h"
+#include "hfile.h"
+#include "hmappedfile.h"
+#include "hspan.h"
+#include "hstring.h"
+
+HTEST_SUITE_BEGIN
+
+HTEST_CASE_WITH_DATA(read)
+{
+	hstr filename = tempDir + "/test.dat";
+	hfile f;
+	f.open(filename, hfaccess::Write);
+	f.dump(1234);
+	f.dump(hstr("testing"));
+	f.dump(3.14f);
+	f.writeLine("first line");
+	f.write("second line");
+	f.close();
+	hmappedfile m;
+	m.open(filename);
+	HTEST_ASSERT(!m.isWritable() && m.size() == hfile::hinfo(filename).size, "");
+	HTEST_ASSERT(m.advise(hmappedfile::AccessPattern::Sequential), "advise()");
+	HTEST_ASSERT(m.loadInt32() == 1234 && m.loadString() == "testing" && m.loadFloat() == 3.14f, "");
+	HTEST_ASSERT(m.readLine() == "first line", "");
+	hspan<const unsigned char> view = m.readView(6);
+	HTEST_ASSERT(view.size() == 6 && view.data() == m.span().data() + m.position() - 6 && view[0] == 's', "readView()");
+	HTEST_ASSERT(m.read() == " line" && m.eof() && m.readView(10).isEmpty(), "");
+	try
+	{
+		m.dump(1);
+		HTEST_FAIL("writing to a read-only mapping didn't throw an exception");
+	}
+	catch (hexception&)
+	{
+	}
+	m.close();
+	try
+	{
+		m.span();
+		HTEST_FAIL("span() on a closed file didn't throw an exception");
+	}
+	catch (hexception&)
+	{
+	}
+	hfile::remove(filename);
+}
+
+HTEST_CASE_WITH_DATA(write)
+{
+	hstr filename = tempDir + "/test.dat";
+	hfile::hwrite(filename, "abcdefgh");
+	hmappedfile m;
+	m.open(filename, true);
+	m.seek(2, hseek::Start);
+	m.write("XY");
+	m.writableSpan()[0] = 'Z';
+	m.seek(-1, hseek::End);
+	HTEST_ASSERT(m.writeRaw((void*)"123", 3) == 1, "writing stops at the end");
+	HTEST_ASSERT(m.flush(), "flush()");
+	m.close();
+	HTEST_ASSERT(hfile::hread(filename) == "ZbXYefg1", "");
+	hfile::hwrite(filename, "");
+	m.open(filename);
+	HTEST_ASSERT(m.size() == 0 && m.span().isEmpty() && m.eof(), "empty file");
+	m.close();
+	hfile::remove(filename);
+	try
+	{
+		m.open(filename);
+		HTEST_FAIL("mapping a missing file didn't throw an exception");
+	}
+	catch (hexception&)
+	{
+	}
+}
+
+HTEST_SUITE_END
+
@@ -0,0 +1,97 @@
+#define _HTEST_LIB hltypes
+#define _HTEST_CLASS RingBuffer
+#include <htest/htest.h>
+
+#include "hringbuffer.h"
+#include "hstring.h"
+#include "hthread.h"
+
+#define TRANSFER_COUNT 100000
+
+static hringbuffer<int>* buffer = NULL;
+
+static void produce(hthread* thread)
+{
+	int batch[7];
+	int value = 0;
+	while (value < TRANSFER_COUNT)
+	{
+		int count = hmin(7, TRANSFER_COUNT - value);
+		for_iter (i, 0, count)
+		{
+			batch[i] = value + i;
+		}
+		buffer->push(batch, count);
+		value += count;
+	}
+}
+
+HTEST_SUITE_BEGIN
+
+HTEST_CASE(basic)
+{
+	hringbuffer<hstr> a(3);
+	HTEST_ASSERT(a.capacity() == 4, "");
+	HTEST_ASSERT(a.isEmpty(), "");
+	HTEST_ASSERT(a.tryPush("a"), "");
+	hstr b = "b";
+	HTEST_ASSERT(a.tryPush(b), "");
+	hstr values[4] = { "c", "d", "e", "f" };
+	HTEST_ASSERT(a.tryPush(values, 4) == 2, "");
+	HTEST_ASSERT(!a.tryPush("g"), "");
+	HTEST_ASSERT(a.size() == 4, "");
+	hstr value;
+	HTEST_ASSERT(a.tryPop(value) && value == "a", "");
+	HTEST_ASSERT(a.pop() == "b", "");
+	hstr result[4];
+	HTEST_ASSERT(a.tryPop(result, 4) == 2, "");
+	HTEST_ASSERT(result[0] == "c" && result[1] == "d", "");
+	HTEST_ASSERT(!a.tryPop(value), "");
+	a.push("x");
+	HTEST_ASSERT(a.pop() == "x", "");
+	a.push("left over");
+	try
+	{
+		hringbuffer<int> c(0);
+		HTEST_FAIL("RingBuffer with zero capacity didn't throw an exception");
+	}
+	catch (hexception&)
+	{
+	}
+	try
+	{
+		hringbuffer<int> c((1 << 30) + 1);
+		HTEST_FAIL("RingBuffer with a capacity that cannot be rounded up didn't throw an exception");
+	}
+	catch (hexception&)
+	{
+	}
+}
+
+HTEST_CASE(threads)
+{
+	buffer = new hringbuffer<int>(64);
+	hthread producer(&produce, "producer");
+	producer.start();
+	int values[5];
+	int expected = 0;
+	bool ordered = true;
+	while (expected < TRANSFER_COUNT)
+	{
+		int count = hmin(5, TRANSFER_COUNT - expected);
+		buffer->pop(values, count);
+		for_iter (i, 0, count)
+		{
+			ordered = (ordered && values[i] == expected);
+			++expected;
+		}
+	}
+	producer.join();
+	HTEST_ASSERT(ordered, "");
+	HTEST_ASSERT(buffer->isEmpty(), "");
+	delete buffer;
+	buffer = NULL;
+}
+
+HTEST_SUITE_END
+
@@ -0,0 +1,133 @@
+#define _HTEST_LIB hltypes
+#define _HTEST_CLASS SmallArray
+#include <htest/htest.h>
+
+#include "harray.h"
+#include "hsmallarray.h"
+#include "hstring.h"
+
+static bool greater(int const& a, int const& b)
+{
+	return (a > b);
+}
+
+HTEST_SUITE_BEGIN
+
+HTEST_CASE(adding)
+{
+	hsmallarray<int, 4> a;
+	HTEST_ASSERT(a.isInline(), "");
+	HTEST_ASSERT(a.capacity() == 4, "");
+	a.add(1);
+	a.addFirst(0);
+	a.insertAt(1, 2);
+	a += 7;
+	HTEST_ASSERT(a.isInline(), "");
+	HTEST_ASSERT(a.size() == 4, "");
+	a << 20;
+	HTEST_ASSERT(!a.isInline(), "");
+	HTEST_ASSERT(a.size() == 5, "");
+	HTEST_ASSERT(a[0] == 0 && a[1] == 2 && a[2] == 1 && a[3] == 7 && a[4] == 20, "");
+	HTEST_ASSERT(a.first() == 0, "");
+	HTEST_ASSERT(a.last() == 20, "");
+	HTEST_ASSERT(a.indexOf(7) == 3, "");
+	HTEST_ASSERT(a.indexOf(8) == -1, "");
+	a.add(a);
+	HTEST_ASSERT(a.size() == 10, "");
+	HTEST_ASSERT(a(5, 5) == a(0, 5), "");
+	a.insertAt(2, 9, 3);
+	HTEST_ASSERT(a.size() == 13, "");
+	HTEST_ASSERT(a[1] == 2 && a[2] == 9 && a[4] == 9 && a[5] == 1, "");
+}
+
+HTEST_CASE(removing)
+{
+	hsmallarray<hstr, 2> a;
+	a += "a";
+	a += "b";
+	a += "c";
+	a += "d";
+	HTEST_ASSERT(a.removeAt(1) == "b", "");
+	HTEST_ASSERT(a.removeFirst() == "a", "");
+	HTEST_ASSERT(a.size() == 2, "");
+	HTEST_ASSERT(!a.isInline(), "");
+	a.shrinkToFit();
+	HTEST_ASSERT(a.isInline(), "");
+	HTEST_ASSERT(a[0] == "c" && a[1] == "d", "");
+	a.insertAt(0, "x", 3);
+	hsmallarray<hstr, 2> b = a.removeAt(1, 3);
+	HTEST_ASSERT(b.size() == 3, "");
+	HTEST_ASSERT(b[0] == "x" && b[1] == "x" && b[2] == "c", "");
+	HTEST_ASSERT(a.size() == 2 && a[0] == "x" && a[1] == "d", "");
+	HTEST_ASSERT(a.removeLast() == "d", "");
+	a.clear();
+	HTEST_ASSERT(a.size() == 0, "");
+	try
+	{
+		a.removeAt(0);
+		HTEST_FAIL("removeAt() on empty SmallArray didn't throw an exception");
+	}
+	catch (hexception&)
+	{
+	}
+}
+
+HTEST_CASE(sorting)
+{
+	hsmallarray<int, 8> a;
+	a += 5;
+	a += 3;
+	a += 9;
+	a += 1;
+	hsmallarray<int, 8> b = a.sorted();
+	HTEST_ASSERT(b[0] == 1 && b[1] == 3 && b[2] == 5 && b[3] == 9, "");
+	b = a.sorted(&greater);
+	HTEST_ASSERT(b[0] == 9 && b[1] == 5 && b[2] == 3 && b[3] == 1, "");
+	HTEST_ASSERT(a.reversed()[0] == 1, "");
+	HTEST_ASSERT(a.joined(",") == "5,3,9,1", "");
+	HTEST_ASSERT(a.min() == 1 && a.max() == 9 && a.sum() == 18, "");
+}
+
+HTEST_CASE(moving)
+{
+	hsmallarray<hstr, 2> a;
+	a += "a";
+	a += "b";
+	hsmallarray<hstr, 2> b(std::move(a));
+	HTEST_ASSERT(a.size() == 0, "");
+	HTEST_ASSERT(b.size() == 2 && b[0] == "a" && b[1] == "b", "");
+	b += "c";
+	const hstr* data = &b[0];
+	hsmallarray<hstr, 2> c(std::move(b));
+	HTEST_ASSERT(&c[0] == data, "");
+	HTEST_ASSERT(b.size() == 0 && b.isInline(), "");
+	a = c;
+	HTEST_ASSERT(a == c, "");
+	a = std::move(c);
+	HTEST_ASSERT(a.size() == 3 && c.size() == 0, "");
+}
+
+HTEST_CASE(conversion)
+{
+	harray<int> a;
+	for_iter (i, 0, 10)
+	{
+		a += i;
+	}
+	hsmallarray<int, 16> b = a;
+	HTEST_ASSERT(b.isInline(), "");
+	HTEST_ASSERT(b.size() == 10 && b[9] == 9, "");
+	harray<int> c = b.toArray();
+	HTEST_ASSERT(c == a, "");
+	harray<int> d = b;
+	HTEST_ASSERT(d == a, "");
+	harray<hstr> e;
+	e += "a";
+	e += "b";
+	hsmallarray<hstr, 1> f(std::move(e));
+	HTEST_ASSERT(e.size() == 0, "");
+	HTEST_ASSERT(f.joined("") == "ab", "");
+}
+
+HTEST_SUITE_END
+
@@ -0,0 +1,109 @@
+#define _HTEST_LIB hltypes
+#define _HTEST_CLASS SoA
+#include <htest/htest.h>
+
+#include <stdint.h>
+
+#include "hsoa.h"
+#include "hstream.h"
+#include "hstring.h"
+
+HTEST_SUITE_BEGIN
+
+HTEST_CASE(rows)
+{
+	hsoa<float, int, hstr> a;
+	HTEST_ASSERT(a.isEmpty() && a.data<0>() == NULL, "");
+	for_iter (i, 0, 10)
+	{
+		HTEST_ASSERT(a.add(i * 0.5f, i, hstr(i)) == i, "");
+	}
+	HTEST_ASSERT(a.size() == 10, "");
+	HTEST_ASSERT(a.field<1>().size() == 10 && a.field<2>()[3] == "3", "");
+	HTEST_ASSERT(((uintptr_t)a.data<0>() & (HLTYPES_SOA_ALIGNMENT - 1)) == 0, "");
+	HTEST_ASSERT(((uintptr_t)a.data<1>() & (HLTYPES_SOA_ALIGNMENT - 1)) == 0, "");
+	a.data<1>()[4] = 40;
+	HTEST_ASSERT(a.span<1>().size() == 10 && a.span<1>()[4] == 40, "");
+	HTEST_ASSERT(a.at<1>(4) == 40, "");
+	a.removeAt(0);
+	HTEST_ASSERT(a.size() == 9 && a.at<1>(0) == 1 && a.at<2>(8) == "9", "");
+	a.swapRemoveAt(1);
+	HTEST_ASSERT(a.size() == 8 && a.at<1>(1) == 9 && a.at<0>(1) == 4.5f && a.at<2>(1) == "9", "");
+	a.swapRemoveAt(7);
+	HTEST_ASSERT(a.size() == 7 && a.at<1>(6) == 7, "");
+	a.swapRows(0, 6);
+	HTEST_ASSERT(a.at<1>(0) == 7 && a.at<2>(6) == "1", "");
+	try
+	{
+		a.removeAt(7);
+		HTEST_FAIL("removeAt() out of bounds didn't throw an exception");
+	}
+	catch (hexception&)
+	{
+	}
+	a.reserve(100);
+	HTEST_ASSERT(a.capacity() >= 100, "");
+	hsoa<float, int, hstr> b = a;
+	a.clear();
+	HTEST_ASSERT(a.isEmpty() && b.size() == 7, "");
+}
+
+HTEST_CASE(serialization)
+{
+	hsoa<double, short, unsigned char, hstr> a;
+	for_iter (i, 0, 20)
+	{
+		a.add(i * 1.25, (short)-i, (unsigned char)(i * 13), hsprintf("row %d", i));
+	}
+	hstream stream;
+	a.dump(stream);
+	hsoa<double, short, unsigned char, hstr>().dump(stream);
+	stream.rewind();
+	hsoa<double, short, unsigned char, hstr> b;
+	b.load(stream);
+	HTEST_ASSERT(b.size() == 20, "");
+	HTEST_ASSERT(b.field<0>() == a.field<0>() && b.field<1>() == a.field<1>(), "");
+	HTEST_ASSERT(b.field<2>() == a.field<2>() && b.field<3>() == a.field<3>(), "");
+	b.load(stream);
+	HTEST_ASSERT(b.isEmpty() && stream.eof(), "");
+	// a count larger than the remaining data must fail before anything is allocated
+	stream.clear();
+	stream.dump(0x7FFFFFFF);
+	stream.dump(1.0);
+	stream.rewind();
+	bool thrown = false;
+	try
+	{
+		b.load(stream);
+	}
+	catch (hexception&)
+	{
+		thrown = true;
+	}
+	HTEST_ASSERT(thrown && stream.position() == 4 && b.isEmpty(), "count larger than the remaining data");
+	// truncated numbers fail after the strings were already loaded
+	hsoa<hstr, double> c;
+	for_iter (i, 0, 20)
+	{
+		c.add(hstr("a"), i * 0.5);
+	}
+	stream.clear();
+	c.dump(stream);
+	stream.rewind();
+	hstream truncated;
+	truncated.writeRaw(stream, 4 + 20 * 5 + 20 * 7);
+	truncated.rewind();
+	thrown = false;
+	try
+	{
+		c.load(truncated);
+	}
+	catch (hexception&)
+	{
+		thrown = true;
+	}
+	HTEST_ASSERT(thrown && c.isEmpty() && c.field<0>().size() == 0 && c.field<1>().size() == 0, "truncated data");
+}
+
+HTEST_SUITE_END
+
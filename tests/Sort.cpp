@@ -0,0 +1,251 @@
+#define _HTEST_LIB hltypes
+#define _HTEST_CLASS Sort
+#include <htest/htest.h>
+
+#include <limits.h>
+
+#include "harray.h"
+#include "hdeque.h"
+#include "hltypesUtil.h"
+#include "hstring.h"
+
+#define BENCHMARK_SIZE 200000
+
+struct Score
+{
+	int points;
+	int id;
+};
+
+static int _scorePoints(Score const& score)
+{
+	return score.points;
+}
+
+static float _negated(float const& value)
+{
+	return -value;
+}
+
+static bool _greater(int const& a, int const& b)
+{
+	return (a > b);
+}
+
+static harray<int> _makeInts(int count)
+{
+	harray<int> result;
+	result.reserve(count);
+	for_iter (i, 0, count)
+	{
+		result += hrand(-1000000, 1000000);
+	}
+	return result;
+}
+
+static harray<float> _makeFloats(int count)
+{
+	harray<float> result;
+	result.reserve(count);
+	for_iter (i, 0, count)
+	{
+		result += hrandf(-1000.0f, 1000.0f);
+	}
+	return result;
+}
+
+template <typename T>
+static bool _isSorted(const harray<T>& a)
+{
+	for_iter (i, 1, a.size())
+	{
+		if (a[i] < a[i - 1])
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+HTEST_SUITE_BEGIN
+
+HTEST_CASE(sortUnstable)
+{
+	harray<int> a = _makeInts(1000);
+	harray<int> b = a.sorted();
+	a.sortUnstable();
+	HTEST_ASSERT(a == b, "");
+	a.sortUnstable(&_greater);
+	HTEST_ASSERT(a == b.reversed(), "");
+	hdeque<int> d;
+	d += 3;
+	d += 1;
+	d += 2;
+	d.sortUnstable();
+	HTEST_ASSERT(d[0] == 1 && d[1] == 2 && d[2] == 3, "");
+}
+
+HTEST_CASE(partialSort)
+{
+	harray<int> a = _makeInts(1000);
+	harray<int> b = a.sorted();
+	harray<int> c = a.partialSorted(10);
+	HTEST_ASSERT(c.size() == 10, "");
+	HTEST_ASSERT(c == b(0, 10), "");
+	HTEST_ASSERT(a.partialSorted(10, &_greater) == b.reversed()(0, 10), "");
+	a.partialSort(10);
+	HTEST_ASSERT(a(0, 10) == b(0, 10), "");
+	HTEST_ASSERT(a.size() == 1000, "");
+	a.partialSort(0);
+	HTEST_ASSERT(a.partialSorted(0).size() == 0, "");
+	try
+	{
+		a.partialSort(1001);
+		HTEST_FAIL("partialSort() with too many elements didn't throw an exception");
+	}
+	catch (hexception&)
+	{
+	}
+}
+
+HTEST_CASE(nthElement)
+{
+	harray<int> a = _makeInts(1001);
+	harray<int> b = a.sorted();
+	a.nthElement(500);
+	HTEST_ASSERT(a[500] == b[500], "");
+	for_iter (i, 0, 500)
+	{
+		HTEST_ASSERT(a[i] <= a[500], "");
+	}
+	for_iter (i, 501, a.size())
+	{
+		HTEST_ASSERT(a[i] >= a[500], "");
+	}
+	a.nthElement(0, &_greater);
+	HTEST_ASSERT(a[0] == b.last(), "");
+	try
+	{
+		a.nthElement(a.size());
+		HTEST_FAIL("nthElement() out of bounds didn't throw an exception");
+	}
+	catch (hexception&)
+	{
+	}
+}
+
+HTEST_CASE(radixSort)
+{
+	harray<int> a = _makeInts(10000);
+	a += INT_MIN;
+	a += INT_MAX;
+	a += 0;
+	a += -1;
+	harray<int> b = a.sorted();
+	a.radixSort();
+	HTEST_ASSERT(a == b, "int");
+	harray<unsigned char> c;
+	c += 200;
+	c += 3;
+	c += 255;
+	c += 0;
+	c.radixSort();
+	HTEST_ASSERT(c[0] == 0 && c[1] == 3 && c[2] == 200 && c[3] == 255, "unsigned char");
+	harray<int64_t> l;
+	l += (int64_t)-5000000000LL;
+	l += (int64_t)5000000000LL;
+	l += (int64_t)-1;
+	l += (int64_t)7;
+	l.radixSort();
+	HTEST_ASSERT(_isSorted(l), "int64_t");
+	harray<float> f = _makeFloats(10000);
+	f += -0.5f;
+	f += 0.0f;
+	f += 0.5f;
+	harray<float> g = f.sorted();
+	f.radixSort();
+	HTEST_ASSERT(f == g, "float");
+	harray<double> d;
+	for_iter (i, 0, 1000)
+	{
+		d += hrandd(-1000000.0, 1000000.0);
+	}
+	d.radixSort();
+	HTEST_ASSERT(_isSorted(d), "double");
+	hdeque<int> q;
+	q += 5;
+	q += -5;
+	q += 0;
+	q.radixSort();
+	HTEST_ASSERT(q[0] == -5 && q[1] == 0 && q[2] == 5, "deque");
+	f.radixSort(&_negated);
+	HTEST_ASSERT(f == g.reversed(), "float key");
+}
+
+HTEST_CASE(radixSortStability)
+{
+	harray<Score> a;
+	Score score;
+	for_iter (i, 0, 1000)
+	{
+		score.points = hrand(10);
+		score.id = i;
+		a += score;
+	}
+	a.radixSort(&_scorePoints);
+	for_iter (i, 1, a.size())
+	{
+		HTEST_ASSERT(a[i - 1].points <= a[i].points, "");
+		if (a[i - 1].points == a[i].points)
+		{
+			HTEST_ASSERT(a[i - 1].id < a[i].id, "");
+		}
+	}
+}
+
+HTEST_CASE(benchmark)
+{
+	harray<int> ints = _makeInts(BENCHMARK_SIZE);
+	harray<float> floats = _makeFloats(BENCHMARK_SIZE);
+	harray<int> a;
+	harray<float> f;
+	int64_t time = 0;
+	HTEST_LOG(hsprintf("sorting %d elements", BENCHMARK_SIZE));
+	a = ints;
+	time = htickCount();
+	a.sort();
+	HTEST_LOG(hsprintf("int sort(): %d ms", (int)(htickCount() - time)));
+	a = ints;
+	time = htickCount();
+	a.sortUnstable();
+	HTEST_LOG(hsprintf("int sortUnstable(): %d ms", (int)(htickCount() - time)));
+	a = ints;
+	time = htickCount();
+	a.radixSort();
+	HTEST_LOG(hsprintf("int radixSort(): %d ms", (int)(htickCount() - time)));
+	HTEST_ASSERT(_isSorted(a), "");
+	a = ints;
+	time = htickCount();
+	a.partialSort(100);
+	HTEST_LOG(hsprintf("int partialSort(100): %d ms", (int)(htickCount() - time)));
+	a = ints;
+	time = htickCount();
+	a.nthElement(BENCHMARK_SIZE / 2);
+	HTEST_LOG(hsprintf("int nthElement(): %d ms", (int)(htickCount() - time)));
+	f = floats;
+	time = htickCount();
+	f.sort();
+	HTEST_LOG(hsprintf("float sort(): %d ms", (int)(htickCount() - time)));
+	f = floats;
+	time = htickCount();
+	f.sortUnstable();
+	HTEST_LOG(hsprintf("float sortUnstable(): %d ms", (int)(htickCount() - time)));
+	f = floats;
+	time = htickCount();
+	f.radixSort();
+	HTEST_LOG(hsprintf("float radixSort(): %d ms", (int)(htickCount() - time)));
+	HTEST_ASSERT(_isSorted(f), "");
+}
+
+HTEST_SUITE_END
+
@@ -0,0 +1,143 @@
+#define _HTEST_LIB hltypes
+#define _HTEST_CLASS Span
+#include <htest/htest.h>
+
+#include <type_traits>
+
+#include "harray.h"
+#include "hmap.h"
+#include "hspan.h"
+#include "hstream.h"
+#include "hstring.h"
+
+struct Base
+{
+	int value;
+};
+
+struct Derived : public Base
+{
+	int extra;
+};
+
+static int sum(hspan<const int> values)
+{
+	int result = 0;
+	for_iter (i, 0, values.size())
+	{
+		result += values[i];
+	}
+	return result;
+}
+
+HTEST_SUITE_BEGIN
+
+HTEST_CASE(basic)
+{
+	int raw[5] = { 1, 2, 3, 4, 5 };
+	hspan<int> a = raw;
+	HTEST_ASSERT(a.size() == 5 && a.data() == raw, "");
+	HTEST_ASSERT(a.first() == 1 && a.last() == 5 && a[-2] == 4, "");
+	HTEST_ASSERT(a.indexOf(3) == 2 && !a.has(6), "");
+	a[0] = 10;
+	HTEST_ASSERT(raw[0] == 10, "");
+	hspan<const int> b = a(1, 3);
+	HTEST_ASSERT(b.size() == 3 && b[0] == 2 && b.data() == raw + 1, "");
+	HTEST_ASSERT(b.sub(-1, 1)[0] == 4, "");
+	HTEST_ASSERT(b.toArray() == (harray<int>() << 2 << 3 << 4), "");
+	HTEST_ASSERT(sum(raw) == 24, "");
+	HTEST_ASSERT(hspan<int>().isEmpty() && sum(hspan<int>()) == 0, "");
+	try
+	{
+		a(3, 3);
+		HTEST_FAIL("sub() out of bounds didn't throw an exception");
+	}
+	catch (hexception&)
+	{
+	}
+	try
+	{
+		b[3];
+		HTEST_FAIL("operator[] out of bounds didn't throw an exception");
+	}
+	catch (hexception&)
+	{
+	}
+}
+
+HTEST_CASE(containers)
+{
+	harray<int> a;
+	a << 1 << 2 << 3 << 4;
+	HTEST_ASSERT(sum(a) == 10, "");
+	const harray<int>& c = a;
+	hspan<const int> b = c;
+	HTEST_ASSERT(b.data() == a.data() && b == a.span(), "");
+	a.span(1, 2)[1] = 30;
+	HTEST_ASSERT(a[2] == 30 && c.span(2, 2).size() == 2, "");
+	int raw[3] = { 7, 8, 9 };
+	harray<int> d;
+	d.add(raw);
+	d.add(a.span(0, 2));
+	d.addFirst(hspan<int>(raw, 1));
+	HTEST_ASSERT(d == (harray<int>() << 7 << 7 << 8 << 9 << 1 << 2), "");
+	HTEST_ASSERT(d.has(raw) && d.hasAny(a.span()) && !d.has(a.span()), "");
+	hmap<hstr, int> map;
+	map["a"] = 1;
+	map["b"] = 2;
+	map["c"] = 3;
+	harray<hstr> keys;
+	keys << "c" << "a";
+	HTEST_ASSERT(map.values(keys) == (harray<int>() << 3 << 1), "");
+	HTEST_ASSERT(map.keyValuePairs(keys.span(1, 1)).size() == 1, "");
+	harray<unsigned int> chars;
+	chars << 'a' << 0xE9 << 0x20AC;
+	HTEST_ASSERT(hstr::fromUnicode(chars) == hstr::fromUnicode(chars.span()), "");
+	HTEST_ASSERT(hstr::fromUnicode(chars.span(0, 1)) == "a", "");
+	HTEST_ASSERT(hstr::fromUnicode(harray<char>() << 'x' << 'y') == "xy", "");
+}
+
+HTEST_CASE(conversions)
+{
+	bool toConst = std::is_convertible<hspan<int>, hspan<const int> >::value;
+	HTEST_ASSERT(toConst, "");
+	bool fromConst = std::is_convertible<hspan<const int>, hspan<int> >::value;
+	HTEST_ASSERT(!fromConst, "");
+	bool constArray = std::is_convertible<const harray<int>&, hspan<int> >::value;
+	HTEST_ASSERT(!constArray, "");
+	// element sizes differ so indexing the elements through a base class Span would be wrong
+	bool derivedSpan = std::is_convertible<hspan<Derived>, hspan<Base> >::value;
+	HTEST_ASSERT(!derivedSpan, "");
+	bool derivedArray = std::is_convertible<harray<Derived>&, hspan<const Base> >::value;
+	HTEST_ASSERT(!derivedArray, "");
+	bool derivedRaw = std::is_convertible<Derived (&)[2], hspan<Base> >::value;
+	HTEST_ASSERT(!derivedRaw, "");
+}
+
+HTEST_CASE(stream)
+{
+	unsigned char raw[4] = { 1, 2, 3, 4 };
+	hstream stream;
+	stream.writeRaw(raw);
+	harray<unsigned char> bytes;
+	bytes << 5 << 6;
+	stream.writeRaw(bytes);
+	hspan<const unsigned char> data = stream;
+	HTEST_ASSERT(data.size() == 6 && data[0] == 1 && data[5] == 6, "");
+	harray<unsigned char> copy;
+	copy.add(stream);
+	HTEST_ASSERT(copy.size() == 6 && copy[4] == 5, "");
+	stream.rewind();
+	unsigned char result[3] = { 0, 0, 0 };
+	HTEST_ASSERT(stream.readRaw(result) == 3 && result[2] == 3, "");
+	hspan<unsigned char> writable = stream;
+	writable[0] = 9;
+	const hstream& constStream = stream;
+	hspan<const unsigned char> readOnly = constStream;
+	HTEST_ASSERT(readOnly[0] == 9, "");
+	bool constWritable = std::is_convertible<const hstream&, hspan<unsigned char> >::value;
+	HTEST_ASSERT(!constWritable, "a const Stream only converts to a read-only Span");
+}
+
+HTEST_SUITE_END
+
@@ -1,8 +1,13 @@
 #define _HTEST_LIB hltypes
 #define _HTEST_CLASS Stream
+#include <string.h>
+
 #include <htest/htest.h>
 #include "harray.h"
 #include "hexception.h"
+#include "hlinereader.h"
+#include "hmap.h"
+#include "hspan.h"
 #include "hstream.h"
 #include "hstring.h"
 
@@ -55,6 +60,40 @@ HTEST_CASE(readDelimiter)
 	HTEST_ASSERT(text == hstr('a', 4090), "");
 }
 
+HTEST_CASE(lineReader)
+{
+	hstream s;
+	s.writeLine("first");
+	s.write("second\r\n\nfo\rurth\n");
+	s.write(hstr('x', 100));
+	s.rewind();
+	// a tiny buffer forces refills and growing in the middle of lines
+	hlinereader reader(s, 4);
+	hstr line;
+	HTEST_ASSERT(reader.readLine(line) && line == "first", "");
+	HTEST_ASSERT(reader.position() == 6, "");
+	hspan<const char> view;
+	HTEST_ASSERT(reader.readLine(view) && hstr(view.data(), view.size()) == "second", "");
+	HTEST_ASSERT(reader.readLine() == "" && reader.readLine() == "fo\rurth", "");
+	HTEST_ASSERT(!reader.eof() && reader.readLine() == hstr('x', 100), "");
+	HTEST_ASSERT(reader.eof() && !reader.readLine(line) && line == "", "");
+	HTEST_ASSERT(reader.getLineCount() == 5, "");
+	hstream big;
+	for_iter (i, 0, 10000)
+	{
+		big.writeLine(hstr(i));
+	}
+	big.rewind();
+	hlinereader bigReader(big);
+	int count = 0;
+	while (bigReader.readLine(line))
+	{
+		HTEST_ASSERT(line == hstr(count), "");
+		++count;
+	}
+	HTEST_ASSERT(count == 10000, "");
+}
+
 HTEST_CASE(writef)
 {
 	hstream s;
@@ -83,6 +122,10 @@ HTEST_CASE(readWriteRaw)
 	s.readRaw(b, 5);
 	hstr str = hstr((char*)b);
 	HTEST_ASSERT(str == "Raw t", "");
+	long longIndex = 1;
+	unsigned int unsignedIndex = 2;
+	size_t sizeIndex = 3;
+	HTEST_ASSERT(s[0] == 'R' && s[longIndex] == 'a' && s[unsignedIndex] == 'w' && s[sizeIndex] == ' ' && s[-1] == 't', "indexing with any integer type");
 }
 
 HTEST_CASE(seekPositionSize)
@@ -137,4 +180,237 @@ HTEST_CASE(serialization)
 	HTEST_ASSERT(d == 1.23456789999999, "");
 	HTEST_ASSERT(!b, "");
 }
+
+HTEST_CASE(largeStream)
+{
+	const int64_t limit = 0x100000000LL; // 4 GB
+	const int64_t size = limit + 0x100000LL;
+	hstream s;
+	if (!s.setCapacity(size))
+	{
+		HTEST_LOG("Not enough memory for a stream larger than 4 GB, skipping.");
+		return;
+	}
+	HTEST_ASSERT(s.prepareManualWriteRaw(size) == size && s.size() == size && s.getCapacity() == size, "");
+	// the memory is not initialized so only bytes that were written are checked
+	const int64_t offsets[4] = { 0LL, 0x80000000LL - 2, limit - 2, size - 4 };
+	for_iter (i, 0, 4)
+	{
+		s.seek(offsets[i], hseek::Start);
+		s.dump(0x12345678);
+	}
+	HTEST_ASSERT(s[0] == 0x78 && s[3] == 0x12, "");
+	HTEST_ASSERT(s[0x80000000LL - 2] == 0x78 && s[0x80000000LL + 1] == 0x12, "subscript beyond 2 GB");
+	HTEST_ASSERT(s[limit - 2] == 0x78 && s[limit + 1] == 0x12, "subscript beyond 4 GB");
+	HTEST_ASSERT(s[-4] == 0x78 && s[-1] == 0x12, "negative subscript");
+	for_iter (i, 0, 4)
+	{
+		s.seek(offsets[i], hseek::Start);
+		HTEST_ASSERT(s.loadUint32() == 0x12345678, "");
+	}
+	s.seek(limit + 2, hseek::Start);
+	HTEST_ASSERT(s.fill(0xAB, 1000) == 1000 && s.position() == limit + 1002, "");
+	s.seek(limit + 2, hseek::Start);
+	unsigned char raw[1000] = { 0 };
+	HTEST_ASSERT(s.readRaw(raw, (int64_t)1000) == 1000 && raw[0] == 0xAB && raw[999] == 0xAB, "");
+	s.seek(limit - 2, hseek::Start);
+	hstream copy;
+	HTEST_ASSERT(copy.writeRaw(s, 1004) == 1004 && s.position() == limit - 2, "");
+	HTEST_ASSERT(hcrc32(&s, 1004) == hcrc32(&copy[0], 1004) && copy[0] == 0x78 && copy[4] == 0xAB, "");
+	s.seek(-10, hseek::End);
+	HTEST_ASSERT(s.readRaw(raw, (int64_t)1000) == 10 && s.eof() && raw[6] == 0x78 && raw[9] == 0x12, "");
+	bool thrown = false;
+	try
+	{
+		s.detachToString();
+	}
+	catch (hexception&)
+	{
+		thrown = true;
+	}
+	HTEST_ASSERT(thrown && s.size() == size, "detachToString() of more than INT_MAX bytes");
+	s.clear();
+	HTEST_ASSERT(s.size() == 0 && s.getCapacity() == MIN_HSTREAM_CAPACITY, "");
+}
+
+HTEST_CASE(bulkSerialization)
+{
+	harray<float> floats;
+	for_iter (i, 0, 1000)
+	{
+		floats += i * 0.5f;
+	}
+	hstream s;
+	s.dump(floats);
+	hstream single;
+	single.dump(floats.size());
+	for_iter (i, 0, floats.size())
+	{
+		single.dump(floats[i]);
+	}
+	HTEST_ASSERT(s.size() == single.size() && memcmp(&s[0], &single[0], (size_t)s.size()) == 0, "same format as dumping one by one");
+	harray<hstr> strings;
+	strings += "a";
+	strings += "bc";
+	harray<harray<int> > nested;
+	nested += harray<int>();
+	nested += harray<int>(1, 3);
+	hmap<hstr, int> map;
+	map["one"] = 1;
+	map["two"] = 2;
+	hmap<int, double> numbers;
+	numbers[5] = 0.25;
+	numbers[-3] = 1.5;
+	int64_t raw[3] = { 1LL, -2LL, 0x123456789LL };
+	s.dump(strings);
+	s.dump(nested);
+	s.dump(map);
+	s.dump(numbers);
+	HTEST_ASSERT(s.dumpRaw(hspan<int64_t>(raw, 3)) == 3, "");
+	s.rewind();
+	HTEST_ASSERT(s.loadArray<float>() == floats && s.loadArray<hstr>() == strings && s.loadArray<harray<int> >() == nested, "");
+	hmap<hstr, int> loadedMap = s.loadMap<hstr, int>();
+	hmap<int, double> loadedNumbers = s.loadMap<int, double>();
+	HTEST_ASSERT(loadedMap == map && loadedNumbers == numbers, "");
+	int64_t loaded[3] = { 0 };
+	HTEST_ASSERT(s.loadRaw(hspan<int64_t>(loaded, 3)) == 3 && memcmp(raw, loaded, sizeof(raw)) == 0 && s.eof(), "");
+	s.clear();
+	s.dump(-1);
+	s.rewind();
+	try
+	{
+		s.loadArray<int>();
+		HTEST_ASSERT(false, "negative count should throw an exception");
+	}
+	catch (hexception&)
+	{
+	}
+	// a truncated stream with a huge count must fail before anything is allocated
+	s.clear();
+	s.dump(0x7FFFFFFF);
+	s.dump(1);
+	s.rewind();
+	bool thrown = false;
+	try
+	{
+		s.loadArray<double>();
+	}
+	catch (hexception&)
+	{
+		thrown = true;
+	}
+	HTEST_ASSERT(thrown && s.position() == 4, "count larger than the remaining data");
+	s.clear();
+	s.dump(1000000);
+	s.dump(hstr("a"));
+	s.dump(1);
+	s.rewind();
+	thrown = false;
+	try
+	{
+		s.loadMap<hstr, int>();
+	}
+	catch (hexception&)
+	{
+		thrown = true;
+	}
+	HTEST_ASSERT(thrown && s.position() == 4, "");
+	unsigned int words[2] = { 0x11223344, 0xAABBCCDD };
+	hswapBytes(words, 2, 4);
+	HTEST_ASSERT(words[0] == 0x44332211 && words[1] == 0xDDCCBBAA, "");
+	uint64_t l = 0x0102030405060708ULL;
+	hswapBytes(&l, 1, 8);
+	HTEST_ASSERT(l == 0x0807060504030201ULL, "");
+}
+
+HTEST_CASE(varint)
+{
+	hstream s;
+	s.dumpVarint(0);
+	s.dumpVarint(127);
+	HTEST_ASSERT(s.size() == 2, "small values take 1 byte");
+	s.dumpVarint(300);
+	HTEST_ASSERT(s.size() == 4 && s[2] == 0xAC && s[3] == 0x02, "");
+	s.dumpVarint(0xFFFFFFFFFFFFFFFFULL);
+	HTEST_ASSERT(s.size() == 14, "largest values take 10 bytes");
+	s.dumpZigzag(-1);
+	s.dumpZigzag(1);
+	s.dumpZigzag(INT64_MIN);
+	HTEST_ASSERT(s[14] == 1 && s[15] == 2, "");
+	s.dumpVarintString("text");
+	unsigned char bytes[4] = { s[0], s[1], s[2], s[3] };
+	s.dumpBlob(bytes);
+	s.rewind();
+	HTEST_ASSERT(s.loadVarint() == 0 && s.loadVarint() == 127 && s.loadVarint() == 300 && s.loadVarint() == 0xFFFFFFFFFFFFFFFFULL, "");
+	HTEST_ASSERT(s.loadZigzag() == -1 && s.loadZigzag() == 1 && s.loadZigzag() == INT64_MIN, "");
+	HTEST_ASSERT(s.loadVarintString() == "text", "");
+	harray<unsigned char> blob = s.loadBlob();
+	HTEST_ASSERT(blob.size() == 4 && blob[2] == 0xAC && s.eof(), "");
+	s.clear();
+	s.dumpVarint(5000000000ULL);
+	hstream truncated;
+	truncated.writeRaw(hspan<const unsigned char>(&s[0], 3));
+	truncated.rewind();
+	try
+	{
+		truncated.loadVarint();
+		HTEST_ASSERT(false, "incomplete varint should throw an exception");
+	}
+	catch (hexception&)
+	{
+	}
+}
+
+HTEST_CASE(varintBatch)
+{
+	harray<uint64_t> values;
+	harray<int64_t> signedValues;
+	for_iter (i, 0, 5000)
+	{
+		values += (uint64_t)i * i * i;
+		signedValues += (int64_t)(i % 2 == 0 ? i : -i) * 1000;
+	}
+	hstream s;
+	s.dumpVarints(values);
+	s.dumpZigzags(signedValues);
+	s.dump(1234);
+	hstream single;
+	for_iter (i, 0, values.size())
+	{
+		single.dumpVarint(values[i]);
+	}
+	int64_t size = single.size();
+	HTEST_ASSERT(memcmp(&s[0], &single[0], (size_t)size) == 0, "same format as dumping one by one");
+	s.rewind();
+	harray<uint64_t> loaded((uint64_t)0, values.size());
+	harray<int64_t> signedLoaded((int64_t)0, signedValues.size());
+	HTEST_ASSERT(s.loadVarints(loaded) == values.size() && loaded == values && s.position() == size, "data read ahead is skipped back");
+	HTEST_ASSERT(s.loadZigzags(signedLoaded) == signedValues.size() && signedLoaded == signedValues, "");
+	HTEST_ASSERT(s.loadInt32() == 1234 && s.eof(), "");
+	s.seek(-4, hseek::End);
+	// 1234 is stored as D2 04 00 00 which are 3 varints
+	HTEST_ASSERT(s.loadVarints(loaded) == 3 && loaded[0] == 594 && loaded[1] == 0 && loaded[2] == 0 && s.eof(), "stops at the end of the stream");
+}
+
+HTEST_CASE(moveAdoptRelease)
+{
+	hstream a;
+	a.dump(1234);
+	unsigned char* data = (unsigned char*)&a[0];
+	hstream b(std::move(a));
+	HTEST_ASSERT(b.size() == 4 && &b[0] == data && !a.isOpen(), "moving does not copy");
+	a.clear();
+	a.dump(1);
+	a = std::move(b);
+	HTEST_ASSERT(a.size() == 4 && &a[0] == data && a.position() == 4, "");
+	unsigned char* released = a.release();
+	HTEST_ASSERT(released == data && a.size() == 0 && a.isOpen(), "releasing leaves an empty stream");
+	a.adopt(released, 4, 16);
+	HTEST_ASSERT(a.size() == 4 && a.position() == 0 && a.getCapacity() == 16 && &a[0] == data, "adopting does not copy");
+	HTEST_ASSERT(a.loadInt32() == 1234, "");
+	a.clear();
+	a.writeRaw(hspan<const unsigned char>((const unsigned char*)"data", 4));
+	HTEST_ASSERT(a.detachToString() == "data" && a.size() == 0, "");
+}
+
 HTEST_SUITE_END
@@ -0,0 +1,75 @@
+#define _HTEST_LIB hltypes
+#define _HTEST_CLASS StreamChain
+#include <htest/htest.h>
+
+#include "harray.h"
+#include "hexception.h"
+#include "hfile.h"
+#include "hstream.h"
+#include "hstreamchain.h"
+#include "hstring.h"
+
+HTEST_SUITE_BEGIN
+
+HTEST_CASE(readWrite)
+{
+	hstreamchain s(16);
+	HTEST_ASSERT(s.getBlockSize() == 16 && s.getBlockCount() == 0 && s.size() == 0, "");
+	for_iter (i, 0, 10)
+	{
+		s.dump(i);
+	}
+	s.dump(hstr("crossing block boundaries"));
+	HTEST_ASSERT(s.size() == 69 && s.getBlockCount() == 5 && s.getBlock(4).size() == 5, "");
+	s.seek(12, hseek::Start);
+	s.dump(1000);
+	HTEST_ASSERT(s.size() == 69 && s.position() == 16, "overwriting in place");
+	s.rewind();
+	for_iter (i, 0, 10)
+	{
+		HTEST_ASSERT(s.loadInt32() == (i == 3 ? 1000 : i), "");
+	}
+	HTEST_ASSERT(s.loadString() == "crossing block boundaries" && s.eof(), "");
+	s.seek(-9, hseek::End);
+	HTEST_ASSERT(s.read() == "oundaries", "");
+	try
+	{
+		s.getBlock(5);
+		HTEST_FAIL("getBlock() out of bounds didn't throw an exception");
+	}
+	catch (hexception&)
+	{
+	}
+	s.clear();
+	HTEST_ASSERT(s.size() == 0 && s.getBlockCount() == 0, "");
+}
+
+HTEST_CASE_WITH_DATA(output)
+{
+	hstreamchain s(100);
+	for_iter (i, 0, 1000)
+	{
+		s.writeLine(hstr(i));
+	}
+	s.seek(10, hseek::Start);
+	hstream stream = s.toStream();
+	HTEST_ASSERT(stream.size() == s.size() && stream.position() == 0 && s.position() == 10, "");
+	stream.seek(-4, hseek::End);
+	HTEST_ASSERT(stream.readLine() == "999", "");
+	hstr filename = tempDir + "/test.txt";
+	hfile f;
+	f.open(filename, hfaccess::Write);
+	f.write("header\n");
+	HTEST_ASSERT(s.writeTo(f) == s.size(), "");
+	f.write("footer");
+	HTEST_ASSERT(f.size() == s.size() + 13 && f.position() == f.size(), "");
+	f.close();
+	hstr text = hfile::hread(filename);
+	HTEST_ASSERT(text.startsWith("header\n0\n1\n") && text.endsWith("998\n999\nfooter"), "");
+	hstream copy;
+	HTEST_ASSERT(s.writeTo(copy) == s.size() && copy.size() == s.size(), "");
+	hfile::remove(filename);
+}
+
+HTEST_SUITE_END
+
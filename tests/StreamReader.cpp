@@ -0,0 +1,185 @@
+#define _HTEST_LIB hltypes
+#define _HTEST_CLASS StreamReader
+#include <htest/htest.h>
+
+#include <string.h>
+
+#include "hexception.h"
+#include "hspan.h"
+#include "hstream.h"
+#include "hstreamreader.h"
+#include "hstreamwriter.h"
+#include "hstring.h"
+
+HTEST_SUITE_BEGIN
+
+HTEST_CASE(load)
+{
+	hstream s;
+	s.dump(1234);
+	s.dump('c');
+	s.dump((unsigned short)65000);
+	s.dump((int64_t)-5000000000LL);
+	s.dump(1.5f);
+	s.dump(0.25);
+	s.dump(true);
+	s.dump(hstr("text"));
+	s.dumpVarint(300);
+	s.dumpZigzag(-2);
+	s.rewind();
+	s.seek(4);
+	hstreamreader r(s);
+	HTEST_ASSERT(r.getPosition() == 4 && r.getSize() == s.size() && s.position() == 4, "starts at the position of the Stream");
+	r.seek(0);
+	HTEST_ASSERT(r.loadInt32() == 1234 && r.loadInt8() == 'c' && r.loadUint16() == 65000 && r.loadInt64() == -5000000000LL, "");
+	HTEST_ASSERT(r.loadFloat() == 1.5f && r.loadDouble() == 0.25 && r.loadBool() && r.loadString() == "text", "");
+	HTEST_ASSERT(r.loadVarint() == 300 && r.loadZigzag() == -2 && r.eof() && r.remaining() == 0, "");
+	r.seek(4);
+	hspan<const unsigned char> view = r.readView(1);
+	HTEST_ASSERT(view.data() == &s[4] && view[0] == 'c', "no data is copied");
+	try
+	{
+		r.seek((int)s.size() - 2);
+		r.loadInt32();
+		HTEST_ASSERT(false, "reading past the end should throw an exception");
+	}
+	catch (hexception&)
+	{
+	}
+	HTEST_ASSERT(r.getPosition() == (int)s.size() - 2, "");
+}
+
+HTEST_CASE(require)
+{
+	unsigned char data[8] = { 1, 0, 0, 0, 2, 0, 0, 0 };
+	hstreamreader r(data);
+	r.setChecked(false);
+	int sum = 0;
+	while (r.remaining() >= 4)
+	{
+		r.require(4);
+		sum += r.loadInt32();
+	}
+	HTEST_ASSERT(sum == 3 && r.eof(), "");
+	try
+	{
+		r.require(1);
+		HTEST_ASSERT(false, "require() always checks");
+	}
+	catch (hexception&)
+	{
+	}
+	// negative counts are rejected even when checking is disabled
+	r.seek(4);
+	unsigned char buffer[4] = { 0 };
+	int failures = 0;
+	for_iter (i, 0, 2)
+	{
+		r.setChecked(i == 0);
+		try
+		{
+			r.skip(-4);
+		}
+		catch (hexception&)
+		{
+			++failures;
+		}
+		try
+		{
+			r.readRaw(buffer, -1);
+		}
+		catch (hexception&)
+		{
+			++failures;
+		}
+		try
+		{
+			r.readView(-1);
+		}
+		catch (hexception&)
+		{
+			++failures;
+		}
+	}
+	HTEST_ASSERT(failures == 6 && r.getPosition() == 4, "");
+}
+
+HTEST_CASE(writeStream)
+{
+	hstream expected;
+	hstream s(16);
+	s.dump(7);
+	{
+		hstreamwriter w(s);
+		for_iter (i, 0, 1000)
+		{
+			w.dump(i);
+			w.dump((unsigned char)i);
+			w.dump(i * 0.5);
+			expected.dump(i);
+			expected.dump((unsigned char)i);
+			expected.dump(i * 0.5);
+		}
+		w.dump(hstr("end"));
+		w.dumpVarint(5000000000ULL);
+		w.dumpZigzag(-300);
+		expected.dump(hstr("end"));
+		expected.dumpVarint(5000000000ULL);
+		expected.dumpZigzag(-300);
+		HTEST_ASSERT(s.size() == 4 && w.getPosition() == expected.size() + 4, "the Stream is only updated when finished");
+	}
+	HTEST_ASSERT(s.size() == expected.size() + 4 && s.position() == s.size(), "");
+	HTEST_ASSERT(memcmp(&s[4], &expected[0], (size_t)expected.size()) == 0, "same format as StreamBase");
+	s.rewind();
+	{
+		hstreamwriter w(s);
+		w.dump(8);
+	}
+	HTEST_ASSERT(s.size() == expected.size() + 4 && s.position() == 4, "overwriting keeps the size");
+	s.rewind();
+	HTEST_ASSERT(s.loadInt32() == 8 && s.loadInt32() == 0, "");
+}
+
+HTEST_CASE(writeSpan)
+{
+	unsigned char data[6] = { 0 };
+	hstreamwriter w(data);
+	w.setChecked(false);
+	w.require(4);
+	w.dump(0x04030201);
+	HTEST_ASSERT(data[0] == 1 && data[3] == 4 && w.remaining() == 2, "");
+	try
+	{
+		w.require(4);
+		HTEST_ASSERT(false, "fixed memory cannot grow");
+	}
+	catch (hexception&)
+	{
+	}
+	w.setChecked(true);
+	try
+	{
+		w.dump(1.0);
+		HTEST_ASSERT(false, "writing past the end should throw an exception");
+	}
+	catch (hexception&)
+	{
+	}
+	w.dump((short)0x0605);
+	HTEST_ASSERT(data[4] == 5 && data[5] == 6 && w.remaining() == 0, "");
+	hstream s;
+	hstreamwriter streamWriter(s);
+	streamWriter.setChecked(false);
+	bool thrown = false;
+	try
+	{
+		streamWriter.writeRaw(data, -1);
+	}
+	catch (hexception&)
+	{
+		thrown = true;
+	}
+	HTEST_ASSERT(thrown && streamWriter.getPosition() == 0, "negative counts are rejected even when checking is disabled");
+}
+
+HTEST_SUITE_END
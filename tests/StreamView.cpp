@@ -0,0 +1,44 @@
+#define _HTEST_LIB hltypes
+#define _HTEST_CLASS StreamView
+#include <htest/htest.h>
+
+#include "hexception.h"
+#include "hspan.h"
+#include "hstream.h"
+#include "hstreamview.h"
+#include "hstring.h"
+
+HTEST_SUITE_BEGIN
+
+HTEST_CASE(readSeek)
+{
+	hstream source;
+	source.dump(1234);
+	source.dump(hstr("view"));
+	hstreamview s(&source[0], source.size());
+	HTEST_ASSERT(s.size() == source.size() && s.position() == 0 && s.span().data() == &source[0], "no data is copied");
+	HTEST_ASSERT(s.loadInt32() == 1234 && s.loadString() == "view" && s.eof(), "");
+	s.seek(-100, hseek::Current);
+	HTEST_ASSERT(s.position() == 0, "");
+	s.seek(2, hseek::Start);
+	hspan<const unsigned char> view = s.readView(100);
+	HTEST_ASSERT(view.data() == &source[2] && view.size() == (int)source.size() - 2 && s.eof(), "");
+}
+
+HTEST_CASE(readOnly)
+{
+	unsigned char data[4] = { 1, 2, 3, 4 };
+	hstreamview s(hspan<const unsigned char>(data, 4));
+	try
+	{
+		s.dump(1);
+	}
+	catch (hexception&)
+	{
+		HTEST_ASSERT(s.size() == 4 && data[0] == 1, "");
+		return;
+	}
+	HTEST_ASSERT(false, "writing should throw an exception");
+}
+
+HTEST_SUITE_END
@@ -1,6 +1,9 @@
 #define _HTEST_LIB hltypes
 #define _HTEST_CLASS String
 #include <htest/htest.h>
+
+#include <utility>
+
 #include "harray.h"
 #include "hstring.h"
 
@@ -464,4 +467,19 @@ HTEST_CASE(formatting)
 	HTEST_ASSERT(text == "This is a 15 formatted 3.14 text.", "hsprintf");
 }
 
+HTEST_CASE(move)
+{
+	hstr source = hstr('x', 100);
+	const char* data = source.cStr();
+	hstr moved(std::move(source));
+	HTEST_ASSERT(moved.cStr() == data && moved.size() == 100, "the buffer is moved, not copied");
+	HTEST_ASSERT(source == "", "");
+	hstr assigned = "text";
+	assigned = std::move(moved);
+	HTEST_ASSERT(assigned.cStr() == data && assigned.size() == 100 && moved == "", "");
+	harray<hstr> strings;
+	strings += std::move(assigned);
+	HTEST_ASSERT(strings[0].cStr() == data && assigned == "", "Array elements are moved");
+}
+
 HTEST_SUITE_END
@@ -1,7 +1,11 @@
 #define _HTEST_LIB hltypes
 #define _HTEST_CLASS Thread
 #include <htest/htest.h>
+
+#include <stdexcept>
+
 #include "hthread.h"
+#include "hthreadpool.h"
 #include "hmutex.h"
 
 
@@ -42,6 +46,28 @@ static void f4(hthread* t)
 	}
 }
 
+static void poolJob(int index, void* data)
+{
+	((int*)data)[index] = index * 2;
+}
+
+static void poolFailingJob(int index, void* data)
+{
+	if (index == 3)
+	{
+		throw Exception("job failed");
+	}
+}
+
+static void poolStdFailingJob(int index, void* data)
+{
+	if (index == 5)
+	{
+		throw std::runtime_error("std job failed");
+	}
+	((int*)data)[index] = 1;
+}
+
 HTEST_SUITE_BEGIN
 
 HTEST_CASE(testThreadingBasic)
@@ -81,4 +107,52 @@ HTEST_CASE(testThreadingControl)
 	HTEST_ASSERT(output.count('2') == 10, "threading control 2");
 }
 
+HTEST_CASE(testThreadPool)
+{
+	hthreadpool pool(3, "test");
+	HTEST_ASSERT(pool.getWorkerCount() == 3, "");
+	int results[100] = { 0 };
+	pool.execute(&poolJob, results, 100);
+	bool correct = true;
+	for (int i = 0; i < 100; i++)
+	{
+		correct = (correct && results[i] == i * 2);
+	}
+	HTEST_ASSERT(correct, "thread pool results");
+	bool thrown = false;
+	try
+	{
+		pool.execute(&poolFailingJob, NULL, 10);
+	}
+	catch (hexception&)
+	{
+		thrown = true;
+	}
+	HTEST_ASSERT(thrown, "thread pool exception");
+	int finished[50] = { 0 };
+	thrown = false;
+	try
+	{
+		pool.execute(&poolStdFailingJob, finished, 50);
+	}
+	catch (hexception& e)
+	{
+		thrown = e.getMessage().contains("std job failed");
+	}
+	HTEST_ASSERT(thrown, "std::exception in a job");
+	int finishedCount = 0;
+	for (int i = 0; i < 50; i++)
+	{
+		finishedCount += finished[i];
+	}
+	HTEST_ASSERT(finishedCount == 49, "the remaining jobs are still executed");
+	pool.execute(&poolJob, results, 100);
+	HTEST_ASSERT(results[99] == 198, "the pool is usable after a failed batch");
+	hthreadpool serial(0);
+	HTEST_ASSERT(serial.getWorkerCount() == 0, "");
+	serial.execute(&poolJob, results, 10);
+	HTEST_ASSERT(results[9] == 18, "");
+	HTEST_ASSERT(hthreadpool::getShared() != NULL, "");
+}
+
 HTEST_SUITE_END
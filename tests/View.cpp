@@ -0,0 +1,62 @@
+#define _HTEST_LIB hltypes
+#define _HTEST_CLASS View
+#include <htest/htest.h>
+
+#include "harray.h"
+#include "hlist.h"
+#include "hmap.h"
+#include "hstring.h"
+#include "hview.h"
+
+static bool isOdd(int const& value)
+{
+	return (value % 2 != 0);
+}
+
+static hstr toString(int const& value)
+{
+	return hstr(value);
+}
+
+HTEST_SUITE_BEGIN
+
+HTEST_CASE(pipeline)
+{
+	harray<int> a;
+	for_iter (i, 0, 20)
+	{
+		a += i;
+	}
+	harray<hstr> b = a.view().where(&isOdd).select(&toString).take(3).toArray();
+	HTEST_ASSERT(b == (harray<hstr>() << "1" << "3" << "5"), "");
+	int limit = 10;
+	HTEST_ASSERT(a.view().where([limit](int value) { return (value >= limit); }).count() == 10, "");
+	HTEST_ASSERT(a.view().skip(18).toArray() == (harray<int>() << 18 << 19), "");
+	HTEST_ASSERT(a.view().skip(25).toArray().size() == 0 && a.view().take(0).count() == 0, "");
+	HTEST_ASSERT(a.view().select([](int value) { return value * 0.5f; }).take(2).toArray() == (harray<float>() << 0.0f << 0.5f), "");
+	// take() stops the whole pipeline early
+	int calls = 0;
+	a.view().where([&calls](int value) { ++calls; return true; }).take(4).toArray();
+	HTEST_ASSERT(calls == 4, "");
+	int sum = 0;
+	a.view().skip(1).take(3).forEach([&sum](int value) { sum += value; });
+	HTEST_ASSERT(sum == 6, "");
+	HTEST_ASSERT(a.view().take(5).take(3).skip(1).take(10).count() == 2, "");
+	hlist<int> list;
+	list << 5 << 6 << 7;
+	HTEST_ASSERT(list.view().where(&isOdd).toArray() == (harray<int>() << 5 << 7), "");
+}
+
+HTEST_CASE(map)
+{
+	hmap<hstr, int> map;
+	map["a"] = 1;
+	map["b"] = 2;
+	map["c"] = 3;
+	HTEST_ASSERT(map.keysView().toArray() == map.keys(), "");
+	HTEST_ASSERT(map.valuesView().where(&isOdd).toArray() == (harray<int>() << 1 << 3), "");
+	HTEST_ASSERT(map.keysView().skip(1).select([](const hstr& key) { return key.uppered(); }).toArray() == (harray<hstr>() << "B" << "C"), "");
+}
+
+HTEST_SUITE_END
+